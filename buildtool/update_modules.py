@@ -1,9 +1,14 @@
 import minify_html
 import gzip
+import hashlib
 import re
 import argparse
+import os
 
 modules = ['ota', 'wireless', 'ca', 'env', 'files', 'logging', 'md5']
+# ESP_CONP_MODULE_* bit of each page module, see esp-config-defines.h
+moduleBits = {'ota': 1 << 0, 'wireless': 1 << 1, 'files': 1 << 2, 'ca': 1 << 3, 'env': 1 << 4, 'logging': 1 << 6,
+              'md5': 1 << 7}
 
 parser = argparse.ArgumentParser(prog="esp-config-page html build tool.",
                                  description="Python script that can be used to manage the modules that will be included in the config page html.")
@@ -21,27 +26,83 @@ with open('../include/config_page.html', encoding="utf-8") as f:
         if not v:
             read_data = re.sub(f'<!--MARKER-{e.upper()}-->?(.*?)<!--END-{e.upper()}-->', '', read_data, flags=re.DOTALL)
 
+    moduleMask = sum(moduleBits[e] for e in args.__dict__ if args.__dict__[e])
+
     minified = minify_html.minify(read_data, minify_css=True, minify_js=True, remove_bangs=True,
                                   remove_processing_instructions=True)
 
 
+def toArray(name, data):
+    toWrite = "const uint8_t %s[] PROGMEM = {" % name
+
+    for byte in data:
+        toWrite = toWrite + str(int.from_bytes([byte], byteorder='big', signed=False))
+        toWrite = toWrite + ", "
+
+    return toWrite + "};\n"
+
+
 compressed = gzip.compress(minified.encode(), 9)
+# Used as the page ETag, changes only when the page content changes
+contentHash = hashlib.sha256(minified.encode()).hexdigest()[:16]
+
+try:
+    import brotli
+    compressedBr = brotli.compress(minified.encode(), mode=brotli.MODE_TEXT, quality=11)
+except ImportError:
+    print('Brotli module not installed, generating only the gzip page.')
+    compressedBr = None
+
+variantDir = '../include/config-html'
+os.makedirs(variantDir, exist_ok=True)
+
+with open('%s/config-html-%02x.h' % (variantDir, moduleMask), 'w') as f:
+    f.write('''#ifndef DX_ESP_CONFIG_PAGE_HTML_%02X_H
+#define ESP_CONFIG_HTML_MODULES 0x%02x
+#define ESP_CONFIG_HTML_LEN %s
+#define ESP_CONFIG_HTML_HASH "%s"
+''' % (moduleMask, moduleMask, len(compressed), contentHash))
+
+    if compressedBr is not None:
+        f.write('#define ESP_CONFIG_HTML_BR_LEN %s\n' % len(compressedBr))
+
+    f.write('#define DX_ESP_CONFIG_PAGE_HTML_%02X_H\n' % moduleMask)
+    f.write('#ifndef ESP_CONP_PAGE_BROTLI_ONLY\n')
+    f.write(toArray('ESP_CONFIG_HTML', compressed))
+    f.write('#endif\n')
+
+    if compressedBr is not None:
+        f.write('#ifndef ESP_CONP_PAGE_GZIP_ONLY\n')
+        f.write(toArray('ESP_CONFIG_HTML_BR', compressedBr))
+        f.write('#endif\n')
+
+    f.write("#endif")
+
+# Every page variant built so far, the firmware includes the one matching its ESP_CONP_MODULES
+variants = sorted(int(name[len('config-html-'):-2], 16) for name in os.listdir(variantDir)
+                  if re.fullmatch(r'config-html-[0-9a-f]{2}\.h', name))
 
 with open('../include/config-html.h', 'w') as f:
     f.write('''#ifndef DX_ESP_CONFIG_PAGE_HTML_H
-#define ESP_CONFIG_HTML_LEN %s
 #define DX_ESP_CONFIG_PAGE_HTML_H
-const uint8_t ESP_CONFIG_HTML[] PROGMEM = {''' % len(compressed))
+// Generated by buildtool/update_modules.py, includes the page built for the modules in ESP_CONP_MODULES.
+''')
 
-    toWrite = ""
+    for i, variant in enumerate(variants):
+        f.write('#%s ESP_CONP_PAGE_MODULES == 0x%02x\n' % ('if' if i == 0 else 'elif', variant))
+        f.write('#include "config-html/config-html-%02x.h"\n' % variant)
 
-    for byte in compressed:
-        toWrite = toWrite + str(int.from_bytes([byte], byteorder='big', signed=False))
-        toWrite = toWrite + ", "
+    f.write('''#else
+#error "No config page was built for ESP_CONP_MODULES, run buildtool/update_modules.py with the same modules."
+#endif
+#endif''')
 
-    f.write(toWrite)
-    f.write("}")
-    f.write(";")
-    f.write("\n#endif")
+print('Page size: %d bytes, minified: %d bytes.' % (len(read_data.encode()), len(minified.encode())))
+print('gzip: %d bytes (%.1f%% of minified).' % (len(compressed), len(compressed) * 100 / len(minified.encode())))
+if compressedBr is not None:
+    print('brotli: %d bytes (%.1f%% of minified, %.1f%% smaller than gzip).' %
+          (len(compressedBr), len(compressedBr) * 100 / len(minified.encode()), 100 - len(compressedBr) * 100 / len(compressed)))
 
-print('Updated enabled modules successfully.')
+print('Updated enabled modules successfully, build the firmware with:')
+flags = [('ESP_CONP_MODULE_' + {'ca': 'ACTIONS', 'env': 'ENVIRONMENT'}.get(e, e.upper())) for e in modules if args.__dict__[e]]
+print('#define ESP_CONP_MODULES (%s)' % ' | '.join(flags + ['ESP_CONP_MODULE_ATTRIBUTES', 'ESP_CONP_MODULE_SCHEDULING']))
@@ -0,0 +1,242 @@
+//
+// Compares LittleFSKeyValueStorage (one file per key) with LogKeyValueStorage (one append-only log and a RAM index) on
+// the host LittleFS folder: time per operation and the filesystem operations behind it from LittleFS.stats, which is
+// what costs metadata walks and block erases on the real flash. Lookups are opens, exists() calls and directory steps.
+//
+// Usage: esp-config-page-bench-kv [host folder] [keys] [rounds]
+//
+
+#include <Arduino.h>
+#include "esp-config-defines.h"
+#include "esp-config-page-env.h"
+
+#include <chrono>
+#include <string>
+
+using namespace ESP_CONFIG_PAGE;
+
+namespace
+{
+    volatile size_t sink = 0;
+
+    struct Result
+    {
+        double nsPerOp;
+        fs::FSStats stats;
+    };
+
+    template <typename Fn>
+    Result measure(long operations, Fn &&fn)
+    {
+        const fs::FSStats before = LittleFS.stats;
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        const fs::FSStats &after = LittleFS.stats;
+        fs::FSStats diff;
+        diff.opens = after.opens - before.opens;
+        diff.lookups = after.lookups - before.lookups;
+        diff.creates = after.creates - before.creates;
+        diff.removes = after.removes - before.removes;
+        diff.renames = after.renames - before.renames;
+        diff.dirScans = after.dirScans - before.dirScans;
+        diff.bytesRead = after.bytesRead - before.bytesRead;
+        diff.bytesWritten = after.bytesWritten - before.bytesWritten;
+        diff.flushes = after.flushes - before.flushes;
+        return {elapsed / operations, diff};
+    }
+
+    void printResult(const char *storage, const char *operation, long operations, const Result &result)
+    {
+        const double n = (double) operations;
+        printf("%-8s %-10s %12.0f %8.2f %8.2f %8.2f %10.1f %10.1f\n", storage, operation, result.nsPerOp,
+               (result.stats.opens + result.stats.lookups + result.stats.dirScans) / n, result.stats.creates / n,
+               (result.stats.removes + result.stats.renames) / n, result.stats.bytesWritten / n,
+               result.stats.bytesRead / n);
+    }
+
+    void keyName(int i, char *out)
+    {
+        sprintf(out, "ENV_VARIABLE_%d", i);
+    }
+
+    void valueOf(int i, int round, char *out)
+    {
+        sprintf(out, "value-%d-%d-%s", i, round, "abcdefghijklmnopqrstuvwxyz");
+    }
+
+    void run(const char *name, KeyValueStorage &storage, int keys, int rounds)
+    {
+        char key[32];
+        char value[64];
+
+        printResult(name, "save", (long) keys * rounds, measure((long) keys * rounds, [&]
+        {
+            for (int round = 0; round < rounds; round++)
+            {
+                for (int i = 0; i < keys; i++)
+                {
+                    keyName(i, key);
+                    valueOf(i, round, value);
+                    storage.save(key, value);
+                    tickModules();
+                }
+            }
+        }));
+
+        printResult(name, "recover", (long) keys * rounds, measure((long) keys * rounds, [&]
+        {
+            for (int round = 0; round < rounds; round++)
+            {
+                for (int i = 0; i < keys; i++)
+                {
+                    keyName(i, key);
+                    char *recovered = storage.recover(key);
+                    sink = sink + (recovered != nullptr ? strlen(recovered) : 0);
+                    free(recovered);
+                }
+            }
+        }));
+
+        printResult(name, "recover-b", (long) keys * rounds, measure((long) keys * rounds, [&]
+        {
+            for (int round = 0; round < rounds; round++)
+            {
+                for (int i = 0; i < keys; i++)
+                {
+                    keyName(i, key);
+                    sink = sink + storage.recover(key, value, sizeof(value));
+                }
+            }
+        }));
+
+        printResult(name, "for-each", rounds, measure(rounds, [&]
+        {
+            for (int round = 0; round < rounds; round++)
+            {
+                storage.doForEachKey([](const char *k, const char *v)
+                {
+                    sink = sink + strlen(k) + strlen(v);
+                    return true;
+                }, 64);
+            }
+        }));
+
+        printResult(name, "for-keys", rounds, measure(rounds, [&]
+        {
+            for (int round = 0; round < rounds; round++)
+            {
+                storage.doForEachKeyOnly([](const char *k)
+                {
+                    sink = sink + strlen(k);
+                    return true;
+                });
+            }
+        }));
+
+        printResult(name, "remove", keys, measure(keys, [&]
+        {
+            for (int i = 0; i < keys; i++)
+            {
+                keyName(i, key);
+                storage.remove(key);
+            }
+        }));
+    }
+
+    /**
+     * Boot restore of the registered env vars with each RestoreMode, one in savedEvery of them saved in the storage.
+     * lazy-get is the lazy restore plus reading every value afterwards.
+     */
+    void runRestore(const char *name, KeyValueStorage &storage, int savedEvery, int rounds)
+    {
+        char value[64];
+        for (uint8_t i = 0; i < envVarCount; i++)
+        {
+            storage.remove(envVars[i]->key);
+            if (i % savedEvery == 0)
+            {
+                valueOf(i, 0, value);
+                storage.save(envVars[i]->key, value);
+            }
+        }
+        tickModules();
+
+        const char *modeNames[] = {"each", "scan", "lazy", "lazy-get"};
+        const RestoreMode modes[] = {RESTORE_EACH, RESTORE_SCAN, RESTORE_LAZY, RESTORE_LAZY};
+        for (uint8_t mode = 0; mode < 4; mode++)
+        {
+            char operation[16];
+            snprintf(operation, sizeof(operation), "%s-1/%d", modeNames[mode], savedEvery);
+            printResult(name, operation, rounds, measure(rounds, [&]
+            {
+                for (int round = 0; round < rounds; round++)
+                {
+                    for (uint8_t i = 0; i < envVarCount; i++)
+                    {
+                        envVars[i]->clear();
+                    }
+
+                    setAndUpdateEnvVarStorage(&storage, modes[mode]);
+                    for (uint8_t i = 0; mode == 3 && i < envVarCount; i++)
+                    {
+                        sink = sink + (envVars[i]->getValue() != nullptr);
+                    }
+                }
+            }));
+        }
+
+        for (uint8_t i = 0; i < envVarCount; i++)
+        {
+            storage.remove(envVars[i]->key);
+        }
+    }
+
+    void runRestores(const char *name, KeyValueStorage &storage, int rounds)
+    {
+        runRestore(name, storage, 1, rounds);
+        runRestore(name, storage, 4, rounds);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const std::string root = argc > 1 ? argv[1] : "littlefs-bench";
+    const int keys = argc > 2 ? atoi(argv[2]) : 32;
+    const int rounds = argc > 3 ? atoi(argv[3]) : 50;
+
+    ::mkdir(root.c_str(), 0755);
+    LittleFS.setHostRoot(root.c_str());
+    LittleFS.remove("/bench-kv.log");
+    LittleFS.remove("/bench-kv.log.tmp");
+
+    printf("%d keys, %d rounds, per operation:\n", keys, rounds);
+    printf("%-8s %-10s %12s %8s %8s %8s %10s %10s\n", "storage", "operation", "ns", "lookups", "creates", "rm+mv",
+           "written B", "read B");
+
+    // Restore rows are per boot of all the keys as env vars
+    char key[32];
+    for (int i = 0; i < keys && i < UINT8_MAX; i++)
+    {
+        keyName(i, key);
+        addEnvVar(new EnvVar(strdup(key), nullptr));
+    }
+
+    {
+        LittleFSKeyValueStorage files("/bench-kv-files");
+        run("files", files, keys, rounds);
+        runRestores("files", files, rounds);
+    }
+
+    {
+        LogKeyValueStorage log("/bench-kv.log");
+        run("log", log, keys, rounds);
+        runRestores("log", log, rounds);
+        printf("log file %zu bytes after remove, %zu dead\n", log.fileSize(), log.deadBytes());
+    }
+
+    LittleFS.remove("/bench-kv.log");
+    LittleFS.rmdir("/bench-kv-files");
+    return sink == 0;
+}
@@ -0,0 +1,172 @@
+//
+// Compares the body parsing of saveEnv/setAttribute/wifiSet before the shared PairTokenizer (String copy, max line
+// length pass, per-handler VLA loop) with the tokenizer fed the whole body and fed in raw stream sized chunks.
+//
+// Usage: esp-config-page-bench-tokenizer [iterations]
+//
+
+#include <Arduino.h>
+#include "esp-config-defines.h"
+
+#include <chrono>
+#include <vector>
+
+using namespace ESP_CONFIG_PAGE;
+
+namespace
+{
+    volatile size_t sink = 0;
+
+    String makeBody(int pairs, int valueLength)
+    {
+        String body;
+        for (int i = 0; i < pairs; i++)
+        {
+            body += "ENV_VARIABLE_";
+            body += String(i);
+            body += '\n';
+            for (int j = 0; j < valueLength; j++)
+            {
+                body += (char) ('a' + (i + j) % 26);
+            }
+            body += '\n';
+        }
+        return body;
+    }
+
+    // The loop saveEnv used before the tokenizer, minus the storage writes
+    size_t legacyParse(const String &request)
+    {
+        String body = request;
+
+        unsigned int maxLineLength = getMaxLineLength(body.c_str()) + 1;
+        char buf[maxLineLength];
+        unsigned int currentChar = 0;
+        unsigned int bodyLen = body.length();
+
+        char currentKey[maxLineLength];
+        bool isKey = true;
+        size_t pairs = 0;
+
+        for (unsigned int i = 0; i < bodyLen; i++)
+        {
+            char c = body[i];
+
+            if (c == '\n')
+            {
+                buf[currentChar] = 0;
+
+                if (isKey)
+                {
+                    strcpy(currentKey, buf);
+                }
+                else
+                {
+                    pairs += currentKey[0] + buf[0] > 0;
+                }
+
+                isKey = !isKey;
+                currentChar = 0;
+            }
+            else
+            {
+                buf[currentChar] = c;
+                currentChar++;
+            }
+        }
+
+        return pairs;
+    }
+
+    bool countPair(const char *key, size_t keyLength, char *value, size_t valueLength)
+    {
+        sink = sink + keyLength + valueLength;
+        return true;
+    }
+
+    size_t tokenizerParse(const String &request, PairTokenizer &tokenizer)
+    {
+        String body = request;
+        tokenizer.reset();
+        tokenizer.feed(&body[0], body.length(), countPair);
+        return tokenizer.pairs();
+    }
+
+    size_t streamParse(const String &request, PairTokenizer &tokenizer)
+    {
+        char chunk[HTTP_RAW_BUFLEN];
+        tokenizer.reset();
+
+        for (size_t offset = 0; offset < request.length(); offset += HTTP_RAW_BUFLEN)
+        {
+            size_t length = min((size_t) HTTP_RAW_BUFLEN, request.length() - offset);
+            memcpy(chunk, request.c_str() + offset, length);
+            tokenizer.feed(chunk, length, countPair);
+        }
+
+        return tokenizer.pairs();
+    }
+
+    template <typename Fn>
+    double nsPerByte(const String &body, long iterations, Fn &&fn)
+    {
+        size_t pairs = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (long i = 0; i < iterations; i++)
+        {
+            pairs += fn(body);
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        sink = sink + pairs;
+        return elapsed / ((double) iterations * body.length());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const long iterations = argc > 1 ? atol(argv[1]) : 20000;
+
+    struct Case
+    {
+        const char *name;
+        int pairs;
+        int valueLength;
+    };
+
+    const Case cases[] = {
+        {"10 pairs x 16B", 10, 16},
+        {"100 pairs x 32B", 100, 32},
+        {"4 pairs x 900B", 4, 900},
+        {"16 pairs x 512B", 16, 512},
+    };
+
+    PairTokenizer tokenizer;
+
+    printf("%-18s %10s %14s %14s %14s %12s %12s\n", "body", "bytes", "legacy ns/B", "whole ns/B", "stream ns/B",
+           "legacy RAM", "stream RAM");
+
+    for (const Case &c : cases)
+    {
+        String body = makeBody(c.pairs, c.valueLength);
+        const long n = max(1L, iterations * 1000 / (long) body.length());
+
+        if (legacyParse(body) != tokenizerParse(body, tokenizer) || streamParse(body, tokenizer) != (size_t) c.pairs)
+        {
+            printf("%s: parsers disagree\n", c.name);
+            return 1;
+        }
+
+        double legacy = nsPerByte(body, n, legacyParse);
+        double whole = nsPerByte(body, n, [&](const String &b) { return tokenizerParse(b, tokenizer); });
+        double stream = nsPerByte(body, n, [&](const String &b) { return streamParse(b, tokenizer); });
+
+        // Request body bytes held at once: the arg("plain") copy plus two line buffers, or one raw chunk plus the carry
+        size_t legacyRam = body.length() * 2 + (getMaxLineLength(body.c_str()) + 1) * 2;
+        size_t streamRam = HTTP_RAW_BUFLEN + (c.valueLength + 32);
+
+        printf("%-18s %10u %14.3f %14.3f %14.3f %12zu %12zu\n", c.name, body.length(), legacy, whole, stream,
+               legacyRam, streamRam);
+    }
+
+    return sink == 0;
+}
@@ -0,0 +1,50 @@
+//
+// Runs the config page on the host. Usage: esp-config-page-host [port] [filesystem root]
+// Then open http://localhost:8080/config (admin/admin).
+//
+
+#include <Arduino.h>
+#include "esp-config-page.h"
+
+ESP_CONFIG_PAGE::WEBSERVER_T *server;
+ESP_CONFIG_PAGE_LOGGING::ConfigPageSerial webserial;
+
+int main(int argc, char **argv)
+{
+    int port = argc > 1 ? atoi(argv[1]) : 8080;
+    LittleFS.setHostRoot(argc > 2 ? argv[2] : "littlefs-host");
+    LittleFS.begin(true);
+    WiFi.hostAddNetwork("host-network", "password");
+
+    webserial.begin(115200);
+    ESP_CONFIG_PAGE::setSerial(&webserial);
+
+    auto *hostVar = new ESP_CONFIG_PAGE::EnvVar("HOST_VAR", nullptr);
+    hostVar->onChange = [](ESP_CONFIG_PAGE::EnvVar *var)
+    {
+        ESP_CONP_LOGI("env", "%s is now %s", var->key, var->value);
+    };
+    ESP_CONFIG_PAGE::addEnvVar(hostVar);
+    ESP_CONFIG_PAGE::setAndUpdateEnvVarStorage(new ESP_CONFIG_PAGE::LittleFSKeyValueStorage("/env"));
+
+    server = new ESP_CONFIG_PAGE::WEBSERVER_T(port);
+    ESP_CONFIG_PAGE::initModules(server, "admin", "admin", "HOST");
+    ESP_CONFIG_PAGE::addCustomAction("Restart", [](ESP_CONFIG_PAGE::WEBSERVER_T &server)
+    {
+        ESP.restart();
+    });
+
+    ESP_CONFIG_PAGE_LOGGING::enableLogging("admin", "admin", webserial);
+    ESP_CONFIG_PAGE_LOGGING::setLogRetention("/logs.txt", 4096);
+
+    server->begin();
+    webserial.printf("Serving on http://localhost:%d/config\n", port);
+
+    while (true)
+    {
+        server->handleClient();
+        ESP_CONFIG_PAGE::loop();
+        ESP_CONFIG_PAGE_LOGGING::loop();
+        delay(1);
+    }
+}
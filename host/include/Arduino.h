@@ -0,0 +1,563 @@
+//
+// Host (Linux) implementation of the subset of the ESP32 Arduino core used by esp-config-page.
+// Only meant for building, benchmarking and profiling the library off-device.
+//
+
+#ifndef ESP_CONP_HOST_ARDUINO_H
+#define ESP_CONP_HOST_ARDUINO_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <malloc.h>
+#include <random>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#ifndef ESP_CONP_HOST
+#define ESP_CONP_HOST
+#endif
+
+using std::min;
+using std::max;
+
+// Flash helpers, flash and RAM are the same thing on the host.
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper *>(p))
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define pgm_read_byte(addr) (*(const uint8_t *) (addr))
+#define pgm_read_word(addr) (*(const uint16_t *) (addr))
+#define pgm_read_dword(addr) (*(const uint32_t *) (addr))
+#define pgm_read_ptr(addr) (*(void * const *) (addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+
+class __FlashStringHelper;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+namespace esp_conp_host
+{
+    inline std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+}
+
+inline unsigned long millis()
+{
+    return (unsigned long) std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - esp_conp_host::bootTime).count();
+}
+
+inline unsigned long micros()
+{
+    return (unsigned long) std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - esp_conp_host::bootTime).count();
+}
+
+inline void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline void delayMicroseconds(unsigned int us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+inline void yield() {}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+
+// FreeRTOS critical section, a spin lock between the host threads
+struct portMUX_TYPE
+{
+    std::atomic_flag locked = ATOMIC_FLAG_INIT;
+};
+#define portMUX_INITIALIZER_UNLOCKED {}
+
+inline void portENTER_CRITICAL(portMUX_TYPE *mux)
+{
+    while (mux->locked.test_and_set(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+inline void portEXIT_CRITICAL(portMUX_TYPE *mux)
+{
+    mux->locked.clear(std::memory_order_release);
+}
+
+inline uint32_t esp_random()
+{
+    static std::mt19937 rng(std::random_device{}());
+    return rng();
+}
+
+inline void esp_fill_random(void *buf, size_t len)
+{
+    auto *bytes = (uint8_t *) buf;
+    for (size_t i = 0; i < len; i++)
+    {
+        bytes[i] = (uint8_t) esp_random();
+    }
+}
+
+inline long random(long max)
+{
+    return max <= 0 ? 0 : (long) (esp_random() % (uint32_t) max);
+}
+
+inline long random(long min, long max)
+{
+    return min >= max ? min : min + random(max - min);
+}
+
+/**
+ * Arduino String, backed by std::string.
+ */
+class String
+{
+public:
+    String() = default;
+    String(const char *cstr) : str(cstr == nullptr ? "" : cstr) {}
+    String(const char *cstr, unsigned int length) : str(cstr, length) {}
+    String(const std::string &s) : str(s) {}
+    String(const __FlashStringHelper *fstr) : String(reinterpret_cast<const char *>(fstr)) {}
+    explicit String(char c) : str(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10) : String((unsigned long) value, base) {}
+    explicit String(int value, unsigned char base = 10) : String((long) value, base) {}
+    explicit String(unsigned int value, unsigned char base = 10) : String((unsigned long) value, base) {}
+    explicit String(long value, unsigned char base = 10)
+    {
+        if (base == 10)
+        {
+            str = std::to_string(value);
+        }
+        else
+        {
+            str = value < 0 ? "-" + toBase((unsigned long) -value, base) : toBase((unsigned long) value, base);
+        }
+    }
+    explicit String(unsigned long value, unsigned char base = 10) : str(toBase(value, base)) {}
+    explicit String(long long value) : str(std::to_string(value)) {}
+    explicit String(unsigned long long value) : str(std::to_string(value)) {}
+    explicit String(float value, unsigned int decimalPlaces = 2) : String((double) value, decimalPlaces) {}
+    explicit String(double value, unsigned int decimalPlaces = 2)
+    {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+        str = buf;
+    }
+
+    const char *c_str() const { return str.c_str(); }
+    unsigned int length() const { return str.length(); }
+    bool isEmpty() const { return str.empty(); }
+    bool reserve(unsigned int size) { str.reserve(size); return true; }
+    char charAt(unsigned int index) const { return index < str.length() ? str[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char &operator[](unsigned int index) { return str[index]; }
+    explicit operator bool() const { return true; }
+
+    bool concat(const String &s) { str += s.str; return true; }
+    bool concat(const char *cstr) { if (cstr != nullptr) str += cstr; return true; }
+    bool concat(const char *cstr, unsigned int length) { str.append(cstr, length); return true; }
+    bool concat(char c) { str += c; return true; }
+
+    String &operator+=(const String &rhs) { concat(rhs); return *this; }
+    String &operator+=(const char *cstr) { concat(cstr); return *this; }
+    String &operator+=(const __FlashStringHelper *fstr) { concat(reinterpret_cast<const char *>(fstr)); return *this; }
+    String &operator+=(char c) { concat(c); return *this; }
+    String &operator+=(int num) { return *this += String(num); }
+    String &operator+=(unsigned int num) { return *this += String(num); }
+    String &operator+=(long num) { return *this += String(num); }
+    String &operator+=(unsigned long num) { return *this += String(num); }
+    String &operator+=(float num) { return *this += String(num); }
+    String &operator+=(double num) { return *this += String(num); }
+
+    bool equals(const String &s) const { return str == s.str; }
+    bool equals(const char *cstr) const { return str == (cstr == nullptr ? "" : cstr); }
+    bool equalsIgnoreCase(const String &s) const { return strcasecmp(str.c_str(), s.c_str()) == 0; }
+    bool operator==(const String &rhs) const { return equals(rhs); }
+    bool operator==(const char *cstr) const { return equals(cstr); }
+    bool operator!=(const String &rhs) const { return !equals(rhs); }
+    bool operator!=(const char *cstr) const { return !equals(cstr); }
+    bool operator<(const String &rhs) const { return str < rhs.str; }
+    int compareTo(const String &s) const { return str.compare(s.str); }
+
+    bool startsWith(const String &prefix) const { return str.rfind(prefix.str, 0) == 0; }
+    bool endsWith(const String &suffix) const
+    {
+        return str.length() >= suffix.str.length() &&
+            str.compare(str.length() - suffix.str.length(), suffix.str.length(), suffix.str) == 0;
+    }
+
+    int indexOf(char c, unsigned int from = 0) const { return toIndex(str.find(c, from)); }
+    int indexOf(const String &s, unsigned int from = 0) const { return toIndex(str.find(s.str, from)); }
+    int lastIndexOf(char c) const { return toIndex(str.rfind(c)); }
+    int lastIndexOf(const String &s) const { return toIndex(str.rfind(s.str)); }
+
+    String substring(unsigned int from) const { return from >= str.length() ? String() : String(str.substr(from)); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > to)
+        {
+            std::swap(from, to);
+        }
+        return from >= str.length() ? String() : String(str.substr(from, to - from));
+    }
+
+    void replace(const String &find, const String &replace)
+    {
+        if (find.isEmpty())
+        {
+            return;
+        }
+
+        size_t pos = 0;
+        while ((pos = str.find(find.str, pos)) != std::string::npos)
+        {
+            str.replace(pos, find.length(), replace.str);
+            pos += replace.length();
+        }
+    }
+
+    void remove(unsigned int index) { if (index < str.length()) str.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < str.length()) str.erase(index, count); }
+    void toLowerCase() { for (char &c : str) c = (char) tolower(c); }
+    void toUpperCase() { for (char &c : str) c = (char) toupper(c); }
+    void trim()
+    {
+        const char *ws = " \t\r\n";
+        str.erase(0, str.find_first_not_of(ws));
+        str.erase(str.find_last_not_of(ws) + 1);
+    }
+
+    long toInt() const { return atol(str.c_str()); }
+    float toFloat() const { return (float) atof(str.c_str()); }
+    double toDouble() const { return atof(str.c_str()); }
+
+    void getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index = 0) const
+    {
+        if (bufsize == 0)
+        {
+            return;
+        }
+
+        size_t n = index < str.length() ? std::min<size_t>(bufsize - 1, str.length() - index) : 0;
+        memcpy(buf, str.data() + index, n);
+        buf[n] = 0;
+    }
+
+    void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const
+    {
+        getBytes((unsigned char *) buf, bufsize, index);
+    }
+
+    const std::string &std() const { return str; }
+
+private:
+    static int toIndex(size_t pos) { return pos == std::string::npos ? -1 : (int) pos; }
+
+    static std::string toBase(unsigned long value, unsigned char base)
+    {
+        if (base < 2 || base > 36)
+        {
+            base = 10;
+        }
+
+        std::string out;
+        do
+        {
+            out.insert(out.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[value % base]);
+            value /= base;
+        }
+        while (value != 0);
+        return out;
+    }
+
+    std::string str;
+};
+
+inline String operator+(const String &lhs, const String &rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, const char *rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const char *lhs, const String &rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, const __FlashStringHelper *rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, char rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, int rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, unsigned int rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, long rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, unsigned long rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, float rhs) { String s(lhs); s += rhs; return s; }
+inline String operator+(const String &lhs, double rhs) { String s(lhs); s += rhs; return s; }
+
+/**
+ * Arduino Print, everything funnels into write(const uint8_t*, size_t).
+ */
+class Print
+{
+public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t c) = 0;
+
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+        {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+
+    size_t write(const char *str) { return str == nullptr ? 0 : write((const uint8_t *) str, strlen(str)); }
+    size_t write(const char *buffer, size_t size) { return write((const uint8_t *) buffer, size); }
+
+    virtual void flush() {}
+
+    size_t print(const __FlashStringHelper *s) { return write(reinterpret_cast<const char *>(s)); }
+    size_t print(const String &s) { return write(s.c_str(), s.length()); }
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t) c); }
+    size_t print(unsigned char n, int base = 10) { return print(String(n, base)); }
+    size_t print(int n, int base = 10) { return print(String(n, base)); }
+    size_t print(unsigned int n, int base = 10) { return print(String(n, base)); }
+    size_t print(long n, int base = 10) { return print(String(n, base)); }
+    size_t print(unsigned long n, int base = 10) { return print(String(n, base)); }
+    size_t print(long long n) { return print(String(n)); }
+    size_t print(unsigned long long n) { return print(String(n)); }
+    size_t print(double n, int digits = 2) { return print(String(n, digits)); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T &v) { size_t n = print(v); return n + println(); }
+    template <typename T>
+    size_t println(const T &v, int base) { size_t n = print(v, base); return n + println(); }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char small[128];
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(small, sizeof(small), format, args);
+        va_end(args);
+
+        if (len < 0)
+        {
+            return 0;
+        }
+
+        if ((size_t) len < sizeof(small))
+        {
+            return write((const uint8_t *) small, len);
+        }
+
+        std::string big(len + 1, '\0');
+        va_start(args, format);
+        vsnprintf(&big[0], big.size(), format, args);
+        va_end(args);
+        return write((const uint8_t *) big.data(), len);
+    }
+};
+
+/**
+ * Arduino Stream, only the blocking read helpers the library uses.
+ */
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(char *buffer, size_t length)
+    {
+        size_t count = 0;
+        while (count < length)
+        {
+            int c = read();
+            if (c < 0)
+            {
+                break;
+            }
+            *buffer++ = (char) c;
+            count++;
+        }
+        return count;
+    }
+
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *) buffer, length); }
+
+    size_t readBytesUntil(char terminator, char *buffer, size_t length)
+    {
+        size_t count = 0;
+        while (count < length)
+        {
+            int c = read();
+            if (c < 0 || c == terminator)
+            {
+                break;
+            }
+            *buffer++ = (char) c;
+            count++;
+        }
+        return count;
+    }
+
+    String readString()
+    {
+        String ret;
+        int c;
+        while ((c = read()) >= 0)
+        {
+            ret += (char) c;
+        }
+        return ret;
+    }
+
+    void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+
+protected:
+    unsigned long timeout = 1000;
+};
+
+/**
+ * Serial port, output goes to stdout and input is never available.
+ */
+class HardwareSerial : public Stream
+{
+public:
+    HardwareSerial() = default;
+    explicit HardwareSerial(int) {}
+
+    void begin(unsigned long) {}
+    void end() {}
+
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    void flush() override { fflush(stdout); }
+
+    using Print::write;
+    explicit operator bool() const { return true; }
+};
+
+inline HardwareSerial Serial;
+
+class IPAddress
+{
+public:
+    IPAddress() = default;
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+    IPAddress(uint32_t address) { memcpy(bytes, &address, 4); }
+
+    operator uint32_t() const
+    {
+        uint32_t ret;
+        memcpy(&ret, bytes, 4);
+        return ret;
+    }
+
+    bool operator==(const IPAddress &other) const { return memcmp(bytes, other.bytes, 4) == 0; }
+    bool operator!=(const IPAddress &other) const { return !(*this == other); }
+    uint8_t operator[](int index) const { return bytes[index]; }
+    uint8_t &operator[](int index) { return bytes[index]; }
+
+    String toString() const
+    {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+        return {buf};
+    }
+
+    bool fromString(const char *address)
+    {
+        unsigned int a, b, c, d;
+        if (sscanf(address, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255)
+        {
+            return false;
+        }
+
+        *this = IPAddress(a, b, c, d);
+        return true;
+    }
+
+private:
+    uint8_t bytes[4]{};
+};
+
+/**
+ * Chip information and control. Heap numbers are a simulated ESP32 heap so the library's reports stay meaningful.
+ */
+class EspClass
+{
+public:
+    uint32_t getHeapSize() { return heapSize; }
+
+    uint32_t getFreeHeap()
+    {
+        size_t used = mallinfo2().uordblks;
+        return used >= heapSize ? 0 : heapSize - (uint32_t) used;
+    }
+
+    uint32_t getMinFreeHeap() { return getFreeHeap(); }
+    uint32_t getMaxAllocHeap() { return getFreeHeap(); }
+    uint32_t getFreeSketchSpace() { return 0x180000; }
+    uint32_t getSketchSize() { return 0x100000; }
+    uint32_t getFlashChipSize() { return 0x400000; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    const char *getChipModel() { return "host"; }
+    uint64_t getEfuseMac() { return 0x0000AABBCCDDEEFFULL; }
+
+    /**
+     * There is no chip to reset on the host, restarts are counted and reported to stderr.
+     * Set onRestart to take over, e.g. to exit the process.
+     */
+    void restart()
+    {
+        restartCount++;
+        fprintf(stderr, "[host] ESP.restart() requested (%lu).\n", restartCount);
+        if (onRestart)
+        {
+            onRestart();
+        }
+    }
+
+    void reset() { restart(); }
+
+    uint32_t heapSize = 320 * 1024;
+    unsigned long restartCount = 0;
+    std::function<void()> onRestart = nullptr;
+};
+
+inline EspClass ESP;
+
+inline void esp_restart()
+{
+    ESP.restart();
+}
+
+#endif //ESP_CONP_HOST_ARDUINO_H
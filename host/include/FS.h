@@ -0,0 +1,450 @@
+//
+// Host implementation of the ESP32 fs::FS / fs::File API, backed by a directory on the host filesystem.
+//
+
+#ifndef ESP_CONP_HOST_FS_H
+#define ESP_CONP_HOST_FS_H
+
+#include <Arduino.h>
+
+#include <dirent.h>
+#include <memory>
+#include <sys/stat.h>
+
+namespace fs
+{
+    enum SeekMode
+    {
+        SeekSet = 0,
+        SeekCur = 1,
+        SeekEnd = 2
+    };
+
+    /**
+     * Operation counters, the host has no flash so these stand in for the cost model when comparing storage code.
+     */
+    struct FSStats
+    {
+        unsigned long opens = 0;
+        unsigned long lookups = 0;
+        unsigned long creates = 0;
+        unsigned long removes = 0;
+        unsigned long renames = 0;
+        unsigned long dirScans = 0;
+        unsigned long bytesRead = 0;
+        unsigned long bytesWritten = 0;
+        unsigned long flushes = 0;
+    };
+
+    struct FileImpl
+    {
+        ~FileImpl()
+        {
+            close();
+        }
+
+        void close()
+        {
+            if (fp != nullptr)
+            {
+                fclose(fp);
+                fp = nullptr;
+            }
+
+            if (dir != nullptr)
+            {
+                closedir(dir);
+                dir = nullptr;
+            }
+        }
+
+        FILE *fp = nullptr;
+        DIR *dir = nullptr;
+        std::string path;
+        std::string hostPath;
+        FSStats *stats = nullptr;
+    };
+
+    class File : public Stream
+    {
+    public:
+        File() = default;
+        explicit File(std::shared_ptr<FileImpl> impl) : impl(std::move(impl)) {}
+
+        size_t write(uint8_t c) override { return write(&c, 1); }
+
+        size_t write(const uint8_t *buf, size_t size) override
+        {
+            if (!impl || impl->fp == nullptr)
+            {
+                return 0;
+            }
+
+            size_t written = fwrite(buf, 1, size, impl->fp);
+            impl->stats->bytesWritten += written;
+            return written;
+        }
+
+        using Print::write;
+
+        int available() override
+        {
+            if (!impl || impl->fp == nullptr)
+            {
+                return 0;
+            }
+
+            return (int) (size() - position());
+        }
+
+        int read() override
+        {
+            uint8_t c;
+            return read(&c, 1) == 1 ? c : -1;
+        }
+
+        size_t read(uint8_t *buf, size_t size)
+        {
+            if (!impl || impl->fp == nullptr)
+            {
+                return 0;
+            }
+
+            size_t n = fread(buf, 1, size, impl->fp);
+            impl->stats->bytesRead += n;
+            return n;
+        }
+
+        size_t readBytes(char *buffer, size_t length) override
+        {
+            return read((uint8_t *) buffer, length);
+        }
+
+        int peek() override
+        {
+            if (!impl || impl->fp == nullptr)
+            {
+                return -1;
+            }
+
+            int c = fgetc(impl->fp);
+            if (c != EOF)
+            {
+                ungetc(c, impl->fp);
+            }
+            return c == EOF ? -1 : c;
+        }
+
+        void flush() override
+        {
+            if (impl && impl->fp != nullptr)
+            {
+                fflush(impl->fp);
+                impl->stats->flushes++;
+            }
+        }
+
+        bool seek(uint32_t pos, SeekMode mode = SeekSet)
+        {
+            return impl && impl->fp != nullptr && fseek(impl->fp, pos, mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END) == 0;
+        }
+
+        size_t position() const
+        {
+            return impl && impl->fp != nullptr ? (size_t) ftell(impl->fp) : 0;
+        }
+
+        size_t size() const
+        {
+            if (!impl || impl->fp == nullptr)
+            {
+                return 0;
+            }
+
+            fflush(impl->fp);
+            struct stat st{};
+            return fstat(fileno(impl->fp), &st) == 0 ? (size_t) st.st_size : 0;
+        }
+
+        void close()
+        {
+            if (impl)
+            {
+                impl->close();
+                impl.reset();
+            }
+        }
+
+        explicit operator bool() const
+        {
+            return impl && (impl->fp != nullptr || impl->dir != nullptr);
+        }
+
+        const char *path() const
+        {
+            return impl ? impl->path.c_str() : "";
+        }
+
+        /**
+         * File name without the folder, same as ESP32 core 2.x and later.
+         */
+        const char *name() const
+        {
+            if (!impl)
+            {
+                return "";
+            }
+
+            size_t slash = impl->path.find_last_of('/');
+            return impl->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+        }
+
+        bool isDirectory() const
+        {
+            return impl && impl->dir != nullptr;
+        }
+
+        File openNextFile(const char *mode = "r");
+
+        /**
+         * Path of the next entry without opening it, empty at the end of the folder. Same as ESP32 core 2.0.8 and later.
+         */
+        String getNextFileName(bool *isDir = nullptr);
+
+        void rewindDirectory()
+        {
+            if (impl && impl->dir != nullptr)
+            {
+                rewinddir(impl->dir);
+            }
+        }
+
+        time_t getLastWrite()
+        {
+            struct stat st{};
+            return impl && stat(impl->hostPath.c_str(), &st) == 0 ? st.st_mtime : 0;
+        }
+
+    private:
+        std::shared_ptr<FileImpl> impl;
+    };
+
+    class FS
+    {
+    public:
+        virtual ~FS() = default;
+
+        File open(const char *path, const char *mode = "r", bool create = false)
+        {
+            std::string host = hostPath(path);
+            auto impl = std::make_shared<FileImpl>();
+            impl->path = normalize(path);
+            impl->hostPath = host;
+            impl->stats = &stats;
+            stats.opens++;
+
+            struct stat st{};
+            bool exists = stat(host.c_str(), &st) == 0;
+
+            if (exists && S_ISDIR(st.st_mode))
+            {
+                impl->dir = opendir(host.c_str());
+                return impl->dir == nullptr ? File() : File(impl);
+            }
+
+            if (!exists && mode[0] != 'r')
+            {
+                stats.creates++;
+                if (create)
+                {
+                    makeParents(host);
+                }
+            }
+
+            std::string fmode = mode;
+            if (fmode.find('b') == std::string::npos)
+            {
+                fmode += 'b';
+            }
+
+            impl->fp = fopen(host.c_str(), fmode.c_str());
+            return impl->fp == nullptr ? File() : File(impl);
+        }
+
+        File open(const String &path, const char *mode = "r", bool create = false)
+        {
+            return open(path.c_str(), mode, create);
+        }
+
+        bool exists(const char *path)
+        {
+            stats.lookups++;
+            struct stat st{};
+            return stat(hostPath(path).c_str(), &st) == 0;
+        }
+
+        bool exists(const String &path) { return exists(path.c_str()); }
+
+        bool remove(const char *path)
+        {
+            stats.removes++;
+            return ::remove(hostPath(path).c_str()) == 0;
+        }
+
+        bool remove(const String &path) { return remove(path.c_str()); }
+
+        bool rename(const char *from, const char *to)
+        {
+            stats.renames++;
+            return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+        }
+
+        bool rename(const String &from, const String &to) { return rename(from.c_str(), to.c_str()); }
+
+        bool mkdir(const char *path)
+        {
+            stats.creates++;
+            return ::mkdir(hostPath(path).c_str(), 0755) == 0;
+        }
+
+        bool mkdir(const String &path) { return mkdir(path.c_str()); }
+
+        bool rmdir(const char *path)
+        {
+            stats.removes++;
+            return ::rmdir(hostPath(path).c_str()) == 0;
+        }
+
+        bool rmdir(const String &path) { return rmdir(path.c_str()); }
+
+        /**
+         * Host directory that stands in for the root of the filesystem.
+         */
+        void setHostRoot(const char *path)
+        {
+            root = path;
+            while (root.size() > 1 && root.back() == '/')
+            {
+                root.pop_back();
+            }
+        }
+
+        const std::string &getHostRoot() const
+        {
+            return root;
+        }
+
+        FSStats stats;
+
+    protected:
+        std::string hostPath(const char *path) const
+        {
+            return root + normalize(path);
+        }
+
+        static std::string normalize(const char *path)
+        {
+            std::string p = path == nullptr ? "/" : path;
+            if (p.empty() || p[0] != '/')
+            {
+                p.insert(p.begin(), '/');
+            }
+
+            while (p.size() > 1 && p.back() == '/')
+            {
+                p.pop_back();
+            }
+
+            return p;
+        }
+
+        static void makeParents(const std::string &host)
+        {
+            for (size_t pos = host.find('/', 1); pos != std::string::npos; pos = host.find('/', pos + 1))
+            {
+                ::mkdir(host.substr(0, pos).c_str(), 0755);
+            }
+        }
+
+        std::string root = "littlefs-host";
+    };
+
+    inline File File::openNextFile(const char *mode)
+    {
+        if (!impl || impl->dir == nullptr)
+        {
+            return {};
+        }
+
+        impl->stats->dirScans++;
+
+        dirent *entry;
+        while ((entry = readdir(impl->dir)) != nullptr)
+        {
+            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            {
+                continue;
+            }
+
+            auto next = std::make_shared<FileImpl>();
+            next->path = (impl->path == "/" ? "" : impl->path) + "/" + entry->d_name;
+            next->hostPath = impl->hostPath + "/" + entry->d_name;
+            next->stats = impl->stats;
+            impl->stats->opens++;
+
+            struct stat st{};
+            if (stat(next->hostPath.c_str(), &st) == 0 && S_ISDIR(st.st_mode))
+            {
+                next->dir = opendir(next->hostPath.c_str());
+            }
+            else
+            {
+                std::string fmode = std::string(mode) + "b";
+                next->fp = fopen(next->hostPath.c_str(), fmode.c_str());
+            }
+
+            return File(next);
+        }
+
+        return {};
+    }
+
+    inline String File::getNextFileName(bool *isDir)
+    {
+        if (!impl || impl->dir == nullptr)
+        {
+            return "";
+        }
+
+        impl->stats->dirScans++;
+
+        dirent *entry;
+        while ((entry = readdir(impl->dir)) != nullptr)
+        {
+            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            {
+                continue;
+            }
+
+            if (isDir != nullptr)
+            {
+                struct stat st{};
+                *isDir = stat((impl->hostPath + "/" + entry->d_name).c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+            }
+
+            std::string path = (impl->path == "/" ? "" : impl->path) + "/" + entry->d_name;
+            return String(path.c_str());
+        }
+
+        return "";
+    }
+}
+
+using fs::File;
+using fs::FS;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif //ESP_CONP_HOST_FS_H
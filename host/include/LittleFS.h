@@ -0,0 +1,88 @@
+//
+// Host LittleFS, a directory on the host filesystem. Point it at a tmpfs (e.g. /dev/shm) for a RAM-backed filesystem.
+// The root can be set with LittleFS.setHostRoot() or the ESP_CONP_HOST_FS_ROOT environment variable.
+//
+
+#ifndef ESP_CONP_HOST_LITTLEFS_H
+#define ESP_CONP_HOST_LITTLEFS_H
+
+#include <FS.h>
+
+#include <ftw.h>
+
+namespace fs
+{
+    class LittleFSFS : public FS
+    {
+    public:
+        LittleFSFS()
+        {
+            const char *envRoot = getenv("ESP_CONP_HOST_FS_ROOT");
+            if (envRoot != nullptr && envRoot[0] != 0)
+            {
+                setHostRoot(envRoot);
+            }
+        }
+
+        bool begin(bool formatOnFail = false, const char * = "/littlefs", uint8_t = 10, const char * = "spiffs")
+        {
+            struct stat st{};
+            if (stat(root.c_str(), &st) == 0)
+            {
+                return S_ISDIR(st.st_mode);
+            }
+
+            if (!formatOnFail && ::mkdir(root.c_str(), 0755) != 0)
+            {
+                return false;
+            }
+
+            return formatOnFail ? format() : true;
+        }
+
+        void end() {}
+
+        bool format()
+        {
+            nftw(root.c_str(), [](const char *path, const struct stat *, int, FTW *)
+            {
+                return ::remove(path);
+            }, 16, FTW_DEPTH | FTW_PHYS);
+
+            return ::mkdir(root.c_str(), 0755) == 0;
+        }
+
+        size_t totalBytes() const
+        {
+            return capacity;
+        }
+
+        size_t usedBytes() const
+        {
+            hostUsedBytes = 0;
+            nftw(root.c_str(), [](const char *, const struct stat *st, int flag, FTW *)
+            {
+                if (flag == FTW_F)
+                {
+                    // LittleFS allocates whole 4 KiB blocks.
+                    hostUsedBytes += ((st->st_size + 4095) / 4096) * 4096;
+                }
+                return 0;
+            }, 16, FTW_PHYS);
+
+            return hostUsedBytes;
+        }
+
+        /**
+         * Reported capacity, defaults to the size of the common 1.5 MiB ESP32 LittleFS partition.
+         */
+        size_t capacity = 0x160000;
+
+    private:
+        static inline size_t hostUsedBytes = 0;
+    };
+}
+
+inline fs::LittleFSFS LittleFS;
+
+#endif //ESP_CONP_HOST_LITTLEFS_H
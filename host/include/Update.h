@@ -0,0 +1,106 @@
+//
+// Host Update, writes the received image to a file (when a path is set) and counts bytes.
+//
+
+#ifndef ESP_CONP_HOST_UPDATE_H
+#define ESP_CONP_HOST_UPDATE_H
+
+#include <Arduino.h>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+#define U_FLASH 0
+#define U_SPIFFS 100
+#define U_AUTH 200
+
+class UpdateClass
+{
+public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN, int command = U_FLASH, int = -1, uint8_t = LOW, const char * = nullptr)
+    {
+        abort();
+        maxSize = size;
+        this->command = command;
+        written = 0;
+        error = nullptr;
+        running = true;
+
+        if (!outputPath.empty())
+        {
+            out = fopen(outputPath.c_str(), "wb");
+        }
+        return true;
+    }
+
+    size_t write(uint8_t *data, size_t len)
+    {
+        if (!running)
+        {
+            error = "Update not started";
+            return 0;
+        }
+
+        if (maxSize != UPDATE_SIZE_UNKNOWN && written + len > maxSize)
+        {
+            error = "Not enough space";
+            return 0;
+        }
+
+        if (out != nullptr)
+        {
+            fwrite(data, 1, len, out);
+        }
+
+        written += len;
+        return len;
+    }
+
+    bool end(bool = false)
+    {
+        if (!running)
+        {
+            error = "Update not started";
+            return false;
+        }
+
+        running = false;
+        if (out != nullptr)
+        {
+            fclose(out);
+            out = nullptr;
+        }
+        return true;
+    }
+
+    void abort()
+    {
+        running = false;
+        if (out != nullptr)
+        {
+            fclose(out);
+            out = nullptr;
+        }
+    }
+
+    bool isRunning() const { return running; }
+    bool hasError() const { return error != nullptr; }
+    const char *errorString() const { return error == nullptr ? "No Error" : error; }
+    size_t progress() const { return written; }
+    int getCommand() const { return command; }
+
+    /**
+     * File the next image is written to, empty to only count bytes.
+     */
+    std::string outputPath;
+
+private:
+    FILE *out = nullptr;
+    size_t maxSize = UPDATE_SIZE_UNKNOWN;
+    size_t written = 0;
+    int command = U_FLASH;
+    const char *error = nullptr;
+    bool running = false;
+};
+
+inline UpdateClass Update;
+
+#endif //ESP_CONP_HOST_UPDATE_H
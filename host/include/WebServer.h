@@ -0,0 +1,905 @@
+//
+// Host implementation of the ESP32 WebServer API.
+//
+// Requests can be injected in-process with hostRequest()/hostUpload() (deterministic, used by benchmarks), or served
+// over a real TCP socket with begin()/handleClient(), one blocking HTTP/1.1 request per connection.
+//
+
+#ifndef ESP_CONP_HOST_WEBSERVER_H
+#define ESP_CONP_HOST_WEBSERVER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <WiFi.h>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <utility>
+#include <vector>
+
+#define HTTP_UPLOAD_BUFLEN 1436
+#define HTTP_RAW_BUFLEN 1436
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+enum HTTPMethod
+{
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_HEAD = 2,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+    HTTP_OPTIONS = 6,
+    HTTP_PATCH = 28,
+    HTTP_ANY = 255,
+};
+
+enum HTTPUploadStatus
+{
+    UPLOAD_FILE_START,
+    UPLOAD_FILE_WRITE,
+    UPLOAD_FILE_END,
+    UPLOAD_FILE_ABORTED
+};
+
+enum HTTPRawStatus
+{
+    RAW_START,
+    RAW_WRITE,
+    RAW_END,
+    RAW_ABORTED
+};
+
+enum HTTPAuthMethod
+{
+    BASIC_AUTH,
+    DIGEST_AUTH
+};
+
+typedef struct
+{
+    HTTPUploadStatus status;
+    String filename;
+    String name;
+    String type;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[HTTP_UPLOAD_BUFLEN];
+} HTTPUpload;
+
+typedef struct
+{
+    HTTPRawStatus status;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[HTTP_RAW_BUFLEN];
+} HTTPRaw;
+
+class WebServer;
+
+class RequestHandler
+{
+public:
+    virtual ~RequestHandler() = default;
+    virtual bool canHandle(HTTPMethod, const String &) { return false; }
+    virtual bool canUpload(const String &) { return false; }
+    virtual bool canRaw(const String &) { return false; }
+    virtual bool handle(WebServer &, HTTPMethod, const String &) { return false; }
+    virtual void upload(WebServer &, const String &, HTTPUpload &) {}
+    virtual void raw(WebServer &, const String &, HTTPRaw &) {}
+
+    RequestHandler *next() { return _next; }
+    void next(RequestHandler *r) { _next = r; }
+
+private:
+    RequestHandler *_next = nullptr;
+};
+
+class Uri
+{
+public:
+    Uri(const char *uri) : uri(uri) {}
+    Uri(const String &uri) : uri(uri) {}
+    Uri(const __FlashStringHelper *uri) : uri(uri) {}
+
+    const String &str() const { return uri; }
+
+private:
+    String uri;
+};
+
+/**
+ * What the server wrote for the last injected request, with the body already de-chunked.
+ */
+struct HostResponse
+{
+    int code = 0;
+    std::vector<std::pair<String, String>> headers;
+    std::string body;
+    size_t wireBytes = 0;
+    size_t chunks = 0;
+    bool chunked = false;
+
+    String header(const char *name) const
+    {
+        for (auto &h : headers)
+        {
+            if (strcasecmp(h.first.c_str(), name) == 0)
+            {
+                return h.second;
+            }
+        }
+        return {};
+    }
+};
+
+class WebServer
+{
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80) : port(port) {}
+
+    ~WebServer()
+    {
+        close();
+
+        RequestHandler *handler = firstHandler;
+        while (handler != nullptr)
+        {
+            RequestHandler *next = handler->next();
+            if (ownsHandler(handler))
+            {
+                delete handler;
+            }
+            handler = next;
+        }
+    }
+
+    void on(const Uri &uri, THandlerFunction fn) { on(uri, HTTP_ANY, std::move(fn)); }
+    void on(const Uri &uri, HTTPMethod method, THandlerFunction fn) { on(uri, method, std::move(fn), nullptr); }
+
+    void on(const Uri &uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn)
+    {
+        auto *handler = new FunctionRequestHandler(std::move(fn), std::move(ufn), uri.str(), method);
+        owned.push_back(handler);
+        addHandler(handler);
+    }
+
+    void addHandler(RequestHandler *handler)
+    {
+        if (lastHandler == nullptr)
+        {
+            firstHandler = handler;
+        }
+        else
+        {
+            lastHandler->next(handler);
+        }
+        lastHandler = handler;
+    }
+
+    void onNotFound(THandlerFunction fn) { notFoundHandler = std::move(fn); }
+    void onFileUpload(THandlerFunction fn) { fileUploadHandler = std::move(fn); }
+
+    String uri() const { return currentUri; }
+    HTTPMethod method() const { return currentMethod; }
+    WiFiClient &client() { return currentClient; }
+    HTTPUpload &upload() { return currentUpload; }
+    HTTPRaw &raw() { return currentRaw; }
+
+    String arg(const String &name) const
+    {
+        for (auto &a : args_)
+        {
+            if (a.first == name)
+            {
+                return a.second;
+            }
+        }
+        return {};
+    }
+
+    String arg(int i) const { return i >= 0 && (size_t) i < args_.size() ? args_[i].second : String(); }
+    String argName(int i) const { return i >= 0 && (size_t) i < args_.size() ? args_[i].first : String(); }
+    int args() const { return (int) args_.size(); }
+    bool hasArg(const String &name) const
+    {
+        for (auto &a : args_)
+        {
+            if (a.first == name)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Same semantics as the ESP32 core: only the listed headers (plus Authorization) are kept, and each call replaces
+     * the previous list.
+     */
+    void collectHeaders(const char *headerKeys[], const size_t headerKeysCount)
+    {
+        collected.clear();
+        collected.emplace_back("Authorization");
+        for (size_t i = 0; i < headerKeysCount; i++)
+        {
+            collected.emplace_back(headerKeys[i]);
+        }
+    }
+
+    String header(const String &name) const
+    {
+        if (!isCollected(name))
+        {
+            return {};
+        }
+
+        for (auto &h : requestHeaders)
+        {
+            if (h.first.equalsIgnoreCase(name))
+            {
+                return h.second;
+            }
+        }
+        return {};
+    }
+
+    bool hasHeader(const String &name) const { return !header(name).isEmpty(); }
+    String hostHeader() const { return header("Host"); }
+
+    bool authenticate(const char *username, const char *password)
+    {
+        String auth = header("Authorization");
+        if (!auth.startsWith("Basic "))
+        {
+            return false;
+        }
+
+        std::string credentials = std::string(username) + ":" + password;
+        return auth.substring(6) == String(base64(credentials));
+    }
+
+    void requestAuthentication(HTTPAuthMethod = BASIC_AUTH, const char *realm = nullptr, const String &authFailMsg = String(""))
+    {
+        sendHeader("WWW-Authenticate", String("Basic realm=\"") + (realm == nullptr ? "Login Required" : realm) + "\"");
+        send(401, "text/html", authFailMsg);
+    }
+
+    void setContentLength(const size_t contentLength) { contentLength_ = contentLength; }
+
+    void sendHeader(const String &name, const String &value, bool first = false)
+    {
+        String line = name + ": " + value + "\r\n";
+        responseHeaders = first ? line + responseHeaders : responseHeaders + line;
+        response.headers.emplace_back(name, value);
+    }
+
+    void send(int code, const char *contentType = nullptr, const String &content = String(""))
+    {
+        send(code, contentType, content.c_str(), content.length());
+    }
+
+    void send(int code, char *contentType, const String &content) { send(code, (const char *) contentType, content); }
+    void send(int code, const String &contentType, const String &content) { send(code, contentType.c_str(), content); }
+    void send(int code, const char *contentType, const char *content) { send(code, contentType, content, strlen(content)); }
+
+    void send(int code, const char *contentType, const char *content, size_t length)
+    {
+        String head;
+        prepareHeader(head, code, contentType, length);
+        writeWire(head.c_str(), head.length());
+
+        if (length > 0 && currentMethod != HTTP_HEAD)
+        {
+            writeContent(content, length);
+        }
+    }
+
+    void send_P(int code, PGM_P contentType, PGM_P content) { send(code, contentType, content); }
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength) { send(code, contentType, content, contentLength); }
+
+    void sendContent(const String &content) { sendContent(content.c_str(), content.length()); }
+
+    void sendContent(const char *content, size_t size)
+    {
+        if (chunked)
+        {
+            char chunkSize[sizeof(size_t) * 2 + 3];
+            snprintf(chunkSize, sizeof(chunkSize), "%zx\r\n", size);
+            writeWire(chunkSize, strlen(chunkSize));
+        }
+
+        if (size > 0)
+        {
+            writeContent(content, size);
+        }
+
+        if (chunked)
+        {
+            writeWire("\r\n", 2);
+            if (size == 0)
+            {
+                chunked = false;
+            }
+        }
+    }
+
+    void sendContent_P(PGM_P content) { sendContent(content, strlen(content)); }
+    void sendContent_P(PGM_P content, size_t size) { sendContent(content, size); }
+
+    template <typename T>
+    size_t streamFile(T &file, const String &contentType, const int code = 200)
+    {
+        setContentLength(file.size());
+        send(code, contentType.c_str(), "", 0);
+
+        uint8_t buf[1024];
+        size_t total = 0, n;
+        while ((n = file.read(buf, sizeof(buf))) > 0)
+        {
+            writeContent((const char *) buf, n);
+            total += n;
+        }
+        return total;
+    }
+
+    void begin()
+    {
+        listenFd = socket(AF_INET, SOCK_STREAM, 0);
+        if (listenFd < 0)
+        {
+            return;
+        }
+
+        int yes = 1;
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port);
+
+        if (bind(listenFd, (sockaddr *) &addr, sizeof(addr)) != 0 || listen(listenFd, 8) != 0)
+        {
+            fprintf(stderr, "[host] WebServer could not listen on port %d.\n", port);
+            ::close(listenFd);
+            listenFd = -1;
+            return;
+        }
+
+        fcntl(listenFd, F_SETFL, O_NONBLOCK);
+    }
+
+    void begin(uint16_t newPort)
+    {
+        port = newPort;
+        begin();
+    }
+
+    void close()
+    {
+        if (listenFd >= 0)
+        {
+            ::close(listenFd);
+            listenFd = -1;
+        }
+    }
+
+    void stop() { close(); }
+
+    /**
+     * Serves at most one pending TCP connection, never blocks when there is none.
+     */
+    void handleClient()
+    {
+        if (listenFd < 0)
+        {
+            return;
+        }
+
+        sockaddr_in peer{};
+        socklen_t peerLen = sizeof(peer);
+        int fd = accept(listenFd, (sockaddr *) &peer, &peerLen);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        std::string data;
+        size_t headerEnd = std::string::npos;
+        size_t bodyLength = 0;
+        char buf[4096];
+
+        while (true)
+        {
+            pollfd p{fd, POLLIN, 0};
+            if (poll(&p, 1, 2000) <= 0)
+            {
+                break;
+            }
+
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0)
+            {
+                break;
+            }
+            data.append(buf, n);
+
+            if (headerEnd == std::string::npos && (headerEnd = data.find("\r\n\r\n")) != std::string::npos)
+            {
+                String lower(data.substr(0, headerEnd));
+                lower.toLowerCase();
+                int cl = lower.indexOf("content-length:");
+                bodyLength = cl < 0 ? 0 : strtoul(lower.c_str() + cl + 15, nullptr, 10);
+            }
+
+            if (headerEnd != std::string::npos && data.size() >= headerEnd + 4 + bodyLength)
+            {
+                break;
+            }
+        }
+
+        if (headerEnd != std::string::npos)
+        {
+            WiFiClient client(IPAddress(peer.sin_addr.s_addr), ntohs(peer.sin_port));
+            serveWire(fd, data, headerEnd, client);
+        }
+
+        ::close(fd);
+    }
+
+    /**
+     * Dispatches a request in-process, exactly as handleClient() would for a request read from a socket.
+     */
+    const HostResponse &hostRequest(HTTPMethod method, const char *uri, const char *body = "",
+                                    std::vector<std::pair<String, String>> headers = {},
+                                    WiFiClient client = WiFiClient())
+    {
+        startRequest(method, uri, std::move(headers), client);
+        const String contentType = rawHeader("Content-Type");
+        RequestHandler *handler = findHandler();
+
+        if (handler != nullptr && !contentType.startsWith("application/x-www-form-urlencoded") && handler->canRaw(currentUri))
+        {
+            streamRaw(handler, body, strlen(body));
+        }
+        else
+        {
+            args_.emplace_back("plain", body);
+        }
+
+        dispatch(handler);
+        return response;
+    }
+
+    /**
+     * Injects a file upload (as a multipart form would be delivered) in chunks of at most HTTP_UPLOAD_BUFLEN bytes.
+     */
+    const HostResponse &hostUpload(HTTPMethod method, const char *uri, const uint8_t *data, size_t length,
+                                   std::vector<std::pair<String, String>> headers = {},
+                                   const char *filename = "upload.bin", size_t chunkSize = HTTP_UPLOAD_BUFLEN,
+                                   WiFiClient client = WiFiClient())
+    {
+        startRequest(method, uri, std::move(headers), client);
+        RequestHandler *handler = findHandler();
+
+        if (handler != nullptr && handler->canUpload(currentUri))
+        {
+            currentUpload.filename = filename;
+            currentUpload.name = "file";
+            currentUpload.type = "application/octet-stream";
+            currentUpload.totalSize = 0;
+            currentUpload.currentSize = 0;
+            currentUpload.status = UPLOAD_FILE_START;
+            handler->upload(*this, currentUri, currentUpload);
+
+            chunkSize = std::min<size_t>(std::max<size_t>(chunkSize, 1), HTTP_UPLOAD_BUFLEN);
+            for (size_t offset = 0; offset < length; offset += chunkSize)
+            {
+                currentUpload.status = UPLOAD_FILE_WRITE;
+                currentUpload.currentSize = std::min(chunkSize, length - offset);
+                memcpy(currentUpload.buf, data + offset, currentUpload.currentSize);
+                handler->upload(*this, currentUri, currentUpload);
+                currentUpload.totalSize += currentUpload.currentSize;
+            }
+
+            currentUpload.status = UPLOAD_FILE_END;
+            currentUpload.currentSize = 0;
+            handler->upload(*this, currentUri, currentUpload);
+        }
+
+        dispatch(handler);
+        return response;
+    }
+
+    const HostResponse &lastResponse() const { return response; }
+
+    static std::string base64(const std::string &in)
+    {
+        static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::string out;
+        size_t i = 0;
+
+        for (; i + 2 < in.size(); i += 3)
+        {
+            uint32_t v = ((uint8_t) in[i] << 16) | ((uint8_t) in[i + 1] << 8) | (uint8_t) in[i + 2];
+            out += table[(v >> 18) & 63];
+            out += table[(v >> 12) & 63];
+            out += table[(v >> 6) & 63];
+            out += table[v & 63];
+        }
+
+        if (i < in.size())
+        {
+            uint32_t v = (uint8_t) in[i] << 16;
+            if (i + 1 < in.size())
+            {
+                v |= (uint8_t) in[i + 1] << 8;
+            }
+
+            out += table[(v >> 18) & 63];
+            out += table[(v >> 12) & 63];
+            out += i + 1 < in.size() ? table[(v >> 6) & 63] : '=';
+            out += '=';
+        }
+
+        return out;
+    }
+
+private:
+    class FunctionRequestHandler : public RequestHandler
+    {
+    public:
+        FunctionRequestHandler(THandlerFunction fn, THandlerFunction ufn, const String &uri, HTTPMethod method)
+            : fn(std::move(fn)), ufn(std::move(ufn)), uri(uri), method(method) {}
+
+        bool canHandle(HTTPMethod requestMethod, const String &requestUri) override
+        {
+            return (method == HTTP_ANY || method == requestMethod) && requestUri == uri;
+        }
+
+        bool canUpload(const String &requestUri) override
+        {
+            return ufn && requestUri == uri;
+        }
+
+        bool canRaw(const String &requestUri) override
+        {
+            return ufn && requestUri == uri;
+        }
+
+        bool handle(WebServer &, HTTPMethod requestMethod, const String &requestUri) override
+        {
+            if (!canHandle(requestMethod, requestUri))
+            {
+                return false;
+            }
+
+            fn();
+            return true;
+        }
+
+        void upload(WebServer &, const String &requestUri, HTTPUpload &) override
+        {
+            if (canUpload(requestUri))
+            {
+                ufn();
+            }
+        }
+
+        void raw(WebServer &, const String &requestUri, HTTPRaw &) override
+        {
+            if (canRaw(requestUri))
+            {
+                ufn();
+            }
+        }
+
+    private:
+        THandlerFunction fn;
+        THandlerFunction ufn;
+        String uri;
+        HTTPMethod method;
+    };
+
+    bool ownsHandler(RequestHandler *handler) const
+    {
+        return std::find(owned.begin(), owned.end(), handler) != owned.end();
+    }
+
+    bool isCollected(const String &name) const
+    {
+        for (auto &c : collected)
+        {
+            if (c.equalsIgnoreCase(name))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    String rawHeader(const char *name) const
+    {
+        for (auto &h : requestHeaders)
+        {
+            if (h.first.equalsIgnoreCase(name))
+            {
+                return h.second;
+            }
+        }
+        return {};
+    }
+
+    void startRequest(HTTPMethod method, const char *uri, std::vector<std::pair<String, String>> headers, WiFiClient client)
+    {
+        response = HostResponse();
+        responseHeaders = "";
+        contentLength_ = CONTENT_LENGTH_NOT_SET;
+        chunked = false;
+        currentMethod = method;
+        currentClient = client;
+        requestHeaders = std::move(headers);
+        args_.clear();
+
+        String full(uri);
+        int query = full.indexOf('?');
+        currentUri = query < 0 ? full : full.substring(0, query);
+
+        if (query >= 0)
+        {
+            String rest = full.substring(query + 1);
+            while (!rest.isEmpty())
+            {
+                int amp = rest.indexOf('&');
+                String pair = amp < 0 ? rest : rest.substring(0, amp);
+                int eq = pair.indexOf('=');
+                args_.emplace_back(eq < 0 ? pair : pair.substring(0, eq), eq < 0 ? String() : urlDecode(pair.substring(eq + 1)));
+                rest = amp < 0 ? String() : rest.substring(amp + 1);
+            }
+        }
+    }
+
+    RequestHandler *findHandler()
+    {
+        for (RequestHandler *h = firstHandler; h != nullptr; h = h->next())
+        {
+            if (h->canHandle(currentMethod, currentUri))
+            {
+                return h;
+            }
+        }
+        return nullptr;
+    }
+
+    void dispatch(RequestHandler *handler)
+    {
+        if (handler != nullptr && handler->handle(*this, currentMethod, currentUri))
+        {
+            return;
+        }
+
+        if (notFoundHandler)
+        {
+            notFoundHandler();
+        }
+        else
+        {
+            send(404, "text/plain", String("Not found: ") + currentUri);
+        }
+    }
+
+    void streamRaw(RequestHandler *handler, const char *body, size_t length)
+    {
+        currentRaw.totalSize = 0;
+        currentRaw.currentSize = 0;
+        currentRaw.status = RAW_START;
+        handler->raw(*this, currentUri, currentRaw);
+
+        for (size_t offset = 0; offset < length; offset += HTTP_RAW_BUFLEN)
+        {
+            currentRaw.status = RAW_WRITE;
+            currentRaw.currentSize = std::min<size_t>(HTTP_RAW_BUFLEN, length - offset);
+            memcpy(currentRaw.buf, body + offset, currentRaw.currentSize);
+            handler->raw(*this, currentUri, currentRaw);
+            currentRaw.totalSize += currentRaw.currentSize;
+        }
+
+        currentRaw.status = RAW_END;
+        currentRaw.currentSize = 0;
+        handler->raw(*this, currentUri, currentRaw);
+    }
+
+    void prepareHeader(String &head, int code, const char *contentType, size_t length)
+    {
+        head = String("HTTP/1.1 ") + code + " " + statusText(code) + "\r\n";
+        response.code = code;
+
+        if (contentType != nullptr && contentType[0] != 0)
+        {
+            head += String("Content-Type: ") + contentType + "\r\n";
+            response.headers.emplace_back("Content-Type", contentType);
+        }
+
+        if (contentLength_ == CONTENT_LENGTH_NOT_SET)
+        {
+            head += String("Content-Length: ") + (unsigned long) length + "\r\n";
+        }
+        else if (contentLength_ != CONTENT_LENGTH_UNKNOWN)
+        {
+            head += String("Content-Length: ") + (unsigned long) contentLength_ + "\r\n";
+        }
+        else
+        {
+            chunked = true;
+            response.chunked = true;
+            head += "Transfer-Encoding: chunked\r\n";
+        }
+
+        head += responseHeaders;
+        head += "Connection: close\r\n\r\n";
+        responseHeaders = "";
+        contentLength_ = CONTENT_LENGTH_NOT_SET;
+    }
+
+    void writeContent(const char *data, size_t length)
+    {
+        response.body.append(data, length);
+        response.chunks++;
+        writeWire(data, length);
+    }
+
+    void writeWire(const char *data, size_t length)
+    {
+        response.wireBytes += length;
+
+        while (socketFd >= 0 && length > 0)
+        {
+            ssize_t n = ::send(socketFd, data, length, MSG_NOSIGNAL);
+            if (n <= 0)
+            {
+                break;
+            }
+            data += n;
+            length -= n;
+        }
+    }
+
+    void serveWire(int fd, const std::string &data, size_t headerEnd, const WiFiClient &client)
+    {
+        size_t lineEnd = data.find("\r\n");
+        String requestLine(data.substr(0, lineEnd));
+        int s1 = requestLine.indexOf(' ');
+        int s2 = requestLine.indexOf(' ', s1 + 1);
+        if (s1 < 0 || s2 < 0)
+        {
+            return;
+        }
+
+        String methodStr = requestLine.substring(0, s1);
+        String uriStr = requestLine.substring(s1 + 1, s2);
+        HTTPMethod method = methodStr == "POST" ? HTTP_POST : methodStr == "PUT" ? HTTP_PUT : methodStr == "DELETE" ? HTTP_DELETE :
+            methodStr == "HEAD" ? HTTP_HEAD : methodStr == "OPTIONS" ? HTTP_OPTIONS : methodStr == "PATCH" ? HTTP_PATCH : HTTP_GET;
+
+        std::vector<std::pair<String, String>> headers;
+        size_t pos = lineEnd + 2;
+        while (pos < headerEnd)
+        {
+            size_t end = data.find("\r\n", pos);
+            String line(data.substr(pos, end - pos));
+            int colon = line.indexOf(':');
+            if (colon > 0)
+            {
+                String value = line.substring(colon + 1);
+                value.trim();
+                headers.emplace_back(line.substring(0, colon), value);
+            }
+            pos = end + 2;
+        }
+
+        std::string body = data.substr(headerEnd + 4);
+        socketFd = fd;
+
+        String contentType;
+        for (auto &h : headers)
+        {
+            if (h.first.equalsIgnoreCase("Content-Type"))
+            {
+                contentType = h.second;
+            }
+        }
+
+        int boundaryPos = contentType.indexOf("boundary=");
+        if (contentType.startsWith("multipart/form-data") && boundaryPos >= 0)
+        {
+            std::string boundary = "--" + contentType.substring(boundaryPos + 9).std();
+            size_t partStart = body.find("\r\n\r\n", body.find(boundary));
+            size_t partEnd = body.find("\r\n" + boundary, partStart == std::string::npos ? 0 : partStart);
+
+            if (partStart != std::string::npos && partEnd != std::string::npos)
+            {
+                partStart += 4;
+                hostUpload(method, uriStr.c_str(), (const uint8_t *) body.data() + partStart, partEnd - partStart,
+                           std::move(headers), "upload.bin", HTTP_UPLOAD_BUFLEN, client);
+            }
+        }
+        else
+        {
+            hostRequest(method, uriStr.c_str(), body.c_str(), std::move(headers), client);
+        }
+
+        socketFd = -1;
+    }
+
+    static String urlDecode(const String &in)
+    {
+        String out;
+        for (unsigned int i = 0; i < in.length(); i++)
+        {
+            char c = in[i];
+            if (c == '+')
+            {
+                out += ' ';
+            }
+            else if (c == '%' && i + 2 < in.length())
+            {
+                char hex[3] = {in[i + 1], in[i + 2], 0};
+                out += (char) strtol(hex, nullptr, 16);
+                i += 2;
+            }
+            else
+            {
+                out += c;
+            }
+        }
+        return out;
+    }
+
+    static const char *statusText(int code)
+    {
+        switch (code)
+        {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 401: return "Unauthorized";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 429: return "Too Many Requests";
+        case 500: return "Internal Server Error";
+        default: return "";
+        }
+    }
+
+    int port;
+    int listenFd = -1;
+    int socketFd = -1;
+
+    RequestHandler *firstHandler = nullptr;
+    RequestHandler *lastHandler = nullptr;
+    std::vector<RequestHandler *> owned;
+    THandlerFunction notFoundHandler = nullptr;
+    THandlerFunction fileUploadHandler = nullptr;
+
+    String currentUri;
+    HTTPMethod currentMethod = HTTP_GET;
+    WiFiClient currentClient;
+    HTTPUpload currentUpload{};
+    HTTPRaw currentRaw{};
+    std::vector<std::pair<String, String>> args_;
+    std::vector<std::pair<String, String>> requestHeaders;
+    std::vector<String> collected{String("Authorization")};
+
+    String responseHeaders;
+    size_t contentLength_ = CONTENT_LENGTH_NOT_SET;
+    bool chunked = false;
+    HostResponse response;
+};
+
+#endif //ESP_CONP_HOST_WEBSERVER_H
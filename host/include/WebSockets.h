@@ -0,0 +1,21 @@
+#ifndef ESP_CONP_HOST_WEBSOCKETS_H
+#define ESP_CONP_HOST_WEBSOCKETS_H
+
+#include <Arduino.h>
+
+typedef enum
+{
+    WStype_ERROR,
+    WStype_DISCONNECTED,
+    WStype_CONNECTED,
+    WStype_TEXT,
+    WStype_BIN,
+    WStype_FRAGMENT_TEXT_START,
+    WStype_FRAGMENT_BIN_START,
+    WStype_FRAGMENT,
+    WStype_FRAGMENT_FIN,
+    WStype_PING,
+    WStype_PONG,
+} WStype_t;
+
+#endif //ESP_CONP_HOST_WEBSOCKETS_H
@@ -0,0 +1,6 @@
+#ifndef ESP_CONP_HOST_WEBSOCKETSCLIENT_H
+#define ESP_CONP_HOST_WEBSOCKETSCLIENT_H
+
+#include <WebSockets.h>
+
+#endif //ESP_CONP_HOST_WEBSOCKETSCLIENT_H
@@ -0,0 +1,167 @@
+//
+// Host implementation of the arduinoWebSockets server API.
+//
+// There is no socket behind it: clients are simulated with hostConnect()/hostReceive()/hostDisconnect(), and every
+// frame the library sends is handed to onHostSend (when set) and counted.
+//
+
+#ifndef ESP_CONP_HOST_WEBSOCKETSSERVER_H
+#define ESP_CONP_HOST_WEBSOCKETSSERVER_H
+
+#include <WebSockets.h>
+
+#ifndef WEBSOCKETS_SERVER_CLIENT_MAX
+#define WEBSOCKETS_SERVER_CLIENT_MAX 5
+#endif
+
+class WebSocketsServer
+{
+public:
+    typedef std::function<void(uint8_t num, WStype_t type, uint8_t *payload, size_t length)> WebSocketServerEvent;
+    typedef std::function<void(uint8_t num, bool binary, const uint8_t *payload, size_t length)> HostSendCallback;
+
+    explicit WebSocketsServer(uint16_t port, const String & = "", const String & = "arduino") : port(port) {}
+
+    void begin() { running = true; }
+
+    void close()
+    {
+        for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+        {
+            disconnect(i);
+        }
+        running = false;
+    }
+
+    void loop() {}
+
+    void onEvent(WebSocketServerEvent cbEvent) { event = std::move(cbEvent); }
+    void setMaxDataSize(size_t size) { maxDataSize = size; }
+
+    bool sendTXT(uint8_t num, const uint8_t *payload, size_t length = 0, bool = false)
+    {
+        return sendFrame(num, false, payload, length == 0 ? strlen((const char *) payload) : length);
+    }
+
+    bool sendTXT(uint8_t num, const char *payload, size_t length = 0, bool headerToPayload = false)
+    {
+        return sendTXT(num, (const uint8_t *) payload, length, headerToPayload);
+    }
+
+    bool sendTXT(uint8_t num, const String &payload) { return sendTXT(num, payload.c_str(), payload.length()); }
+
+    bool sendBIN(uint8_t num, const uint8_t *payload, size_t length, bool = false)
+    {
+        return sendFrame(num, true, payload, length);
+    }
+
+    bool broadcastTXT(const char *payload, size_t length = 0)
+    {
+        bool ret = true;
+        for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+        {
+            if (connected[i])
+            {
+                ret = sendTXT(i, payload, length) && ret;
+            }
+        }
+        return ret;
+    }
+
+    void disconnect(uint8_t num)
+    {
+        if (num < WEBSOCKETS_SERVER_CLIENT_MAX && connected[num])
+        {
+            connected[num] = false;
+            if (event)
+            {
+                event(num, WStype_DISCONNECTED, nullptr, 0);
+            }
+        }
+    }
+
+    void disconnect() { close(); }
+
+    bool clientIsConnected(uint8_t num) const
+    {
+        return num < WEBSOCKETS_SERVER_CLIENT_MAX && connected[num];
+    }
+
+    int connectedClients(bool = false) const
+    {
+        int count = 0;
+        for (bool c : connected)
+        {
+            count += c;
+        }
+        return count;
+    }
+
+    IPAddress remoteIP(uint8_t) const { return {127, 0, 0, 1}; }
+
+    /**
+     * Simulates a client connecting, returns its number or -1 when the server is full.
+     */
+    int hostConnect()
+    {
+        for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+        {
+            if (!connected[i])
+            {
+                connected[i] = true;
+                if (event)
+                {
+                    event(i, WStype_CONNECTED, nullptr, 0);
+                }
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Simulates a frame from a client. The payload is copied (and NUL terminated, like the real library does).
+     */
+    void hostReceive(uint8_t num, const void *payload, size_t length, bool binary = false)
+    {
+        if (!clientIsConnected(num) || !event || length > maxDataSize)
+        {
+            return;
+        }
+
+        std::string copy((const char *) payload, length);
+        event(num, binary ? WStype_BIN : WStype_TEXT, (uint8_t *) copy.data(), length);
+    }
+
+    void hostReceive(uint8_t num, const char *text) { hostReceive(num, text, strlen(text)); }
+    void hostDisconnect(uint8_t num) { disconnect(num); }
+
+    HostSendCallback onHostSend = nullptr;
+    unsigned long framesSent = 0;
+    unsigned long bytesSent = 0;
+
+private:
+    bool sendFrame(uint8_t num, bool binary, const uint8_t *payload, size_t length)
+    {
+        if (!clientIsConnected(num))
+        {
+            return false;
+        }
+
+        framesSent++;
+        bytesSent += length;
+        if (onHostSend)
+        {
+            onHostSend(num, binary, payload, length);
+        }
+        return true;
+    }
+
+    uint16_t port;
+    bool running = false;
+    size_t maxDataSize = 15 * 1024;
+    bool connected[WEBSOCKETS_SERVER_CLIENT_MAX]{};
+    WebSocketServerEvent event = nullptr;
+};
+
+#endif //ESP_CONP_HOST_WEBSOCKETSSERVER_H
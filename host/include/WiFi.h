@@ -0,0 +1,170 @@
+//
+// Host WiFi, a simulated station/AP state machine. Networks that can be "joined" are added with hostAddNetwork().
+//
+
+#ifndef ESP_CONP_HOST_WIFI_H
+#define ESP_CONP_HOST_WIFI_H
+
+#include <Arduino.h>
+
+#include <vector>
+
+typedef enum
+{
+    WL_NO_SHIELD = 255,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum
+{
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+} wifi_mode_t;
+
+typedef struct
+{
+    uint8_t bssid[6];
+    uint8_t ssid[33];
+    uint8_t primary;
+    int8_t rssi;
+} wifi_ap_record_t;
+
+/**
+ * TCP client handle, on the host only the peer address is tracked.
+ */
+class WiFiClient
+{
+public:
+    WiFiClient() = default;
+    WiFiClient(IPAddress remote, uint16_t port) : remote(remote), port(port) {}
+
+    IPAddress remoteIP() const { return remote; }
+    uint16_t remotePort() const { return port; }
+    IPAddress localIP() const { return {127, 0, 0, 1}; }
+    bool connected() const { return true; }
+    void stop() {}
+
+    IPAddress remote{127, 0, 0, 1};
+    uint16_t port = 0;
+};
+
+class WiFiClass
+{
+public:
+    wl_status_t begin(const char *ssid, const char *pass = nullptr)
+    {
+        currentSsid = ssid == nullptr ? "" : ssid;
+        currentStatus = WL_DISCONNECTED;
+
+        for (auto &n : networks)
+        {
+            if (n.ssid == currentSsid)
+            {
+                currentStatus = pass != nullptr && n.pass == pass ? WL_CONNECTED : WL_CONNECT_FAILED;
+                return currentStatus;
+            }
+        }
+
+        currentStatus = WL_NO_SSID_AVAIL;
+        return currentStatus;
+    }
+
+    wl_status_t begin(const String &ssid, const String &pass) { return begin(ssid.c_str(), pass.c_str()); }
+
+    bool disconnect(bool wifioff = false, bool = false)
+    {
+        currentStatus = WL_DISCONNECTED;
+        if (wifioff)
+        {
+            currentMode = currentMode == WIFI_AP_STA ? WIFI_AP : currentMode;
+        }
+        return true;
+    }
+
+    uint8_t waitForConnectResult(unsigned long = 60000) { return currentStatus; }
+    wl_status_t status() const { return currentStatus; }
+    bool isConnected() const { return currentStatus == WL_CONNECTED; }
+
+    bool mode(wifi_mode_t m) { currentMode = m; return true; }
+    wifi_mode_t getMode() const { return currentMode; }
+    bool setAutoReconnect(bool) { return true; }
+    void persistent(bool) {}
+
+    bool softAP(const char *ssid, const char * = nullptr)
+    {
+        apSsid = ssid == nullptr ? "" : ssid;
+        return true;
+    }
+
+    bool softAP(const String &ssid, const String &pass) { return softAP(ssid.c_str(), pass.c_str()); }
+
+    bool softAPConfig(IPAddress local, IPAddress, IPAddress)
+    {
+        apIp = local;
+        return true;
+    }
+
+    IPAddress softAPIP() const { return apIp; }
+    IPAddress localIP() const { return currentStatus == WL_CONNECTED ? IPAddress(127, 0, 0, 1) : IPAddress(); }
+    String macAddress() const { return "AA:BB:CC:DD:EE:FF"; }
+    String SSID() const { return currentStatus == WL_CONNECTED ? String(currentSsid) : String(); }
+    int8_t RSSI() const { return currentStatus == WL_CONNECTED ? -50 : 0; }
+
+    int16_t scanNetworks()
+    {
+        scanResults.clear();
+        for (auto &n : networks)
+        {
+            wifi_ap_record_t record{};
+            strncpy((char *) record.ssid, n.ssid.c_str(), sizeof(record.ssid) - 1);
+            record.rssi = n.rssi;
+            scanResults.push_back(record);
+        }
+        return (int16_t) scanResults.size();
+    }
+
+    void *getScanInfoByIndex(int i)
+    {
+        return i >= 0 && (size_t) i < scanResults.size() ? &scanResults[i] : nullptr;
+    }
+
+    String SSID(uint8_t i) const { return i < scanResults.size() ? String((const char *) scanResults[i].ssid) : String(); }
+    int32_t RSSI(uint8_t i) const { return i < scanResults.size() ? scanResults[i].rssi : 0; }
+    void scanDelete() { scanResults.clear(); }
+
+    /**
+     * Adds a simulated access point that shows up in scans and accepts the given password.
+     */
+    void hostAddNetwork(const char *ssid, const char *pass, int8_t rssi = -60)
+    {
+        networks.push_back({ssid, pass, rssi});
+    }
+
+private:
+    struct HostNetwork
+    {
+        std::string ssid;
+        std::string pass;
+        int8_t rssi;
+    };
+
+    std::vector<HostNetwork> networks;
+    std::vector<wifi_ap_record_t> scanResults;
+    std::string currentSsid;
+    std::string apSsid;
+    IPAddress apIp{192, 168, 4, 1};
+    wl_status_t currentStatus = WL_IDLE_STATUS;
+    wifi_mode_t currentMode = WIFI_OFF;
+};
+
+inline WiFiClass WiFi;
+
+#endif //ESP_CONP_HOST_WIFI_H
@@ -0,0 +1,12 @@
+#ifndef ESP_CONP_HOST_WIFIUDP_H
+#define ESP_CONP_HOST_WIFIUDP_H
+
+#include <WiFi.h>
+
+class WiFiUDP
+{
+public:
+    static void stopAll() {}
+};
+
+#endif //ESP_CONP_HOST_WIFIUDP_H
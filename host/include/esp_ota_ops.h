@@ -0,0 +1,75 @@
+//
+// Host ESP-IDF OTA API on top of the host partitions.
+//
+
+#ifndef ESP_CONP_HOST_ESP_OTA_OPS_H
+#define ESP_CONP_HOST_ESP_OTA_OPS_H
+
+#include <esp_partition.h>
+
+typedef uint32_t esp_ota_handle_t;
+
+#define OTA_SIZE_UNKNOWN 0xffffffff
+#define ESP_ERR_OTA_VALIDATE_FAILED 0x1503
+
+namespace esp_conp_host
+{
+    inline const esp_partition_t *otaPartition = nullptr;
+    inline size_t otaWritten = 0;
+    inline const esp_partition_t *bootPartition = nullptr;
+}
+
+inline const esp_partition_t *esp_ota_get_next_update_partition(const esp_partition_t *)
+{
+    return &esp_conp_host::appPartition;
+}
+
+inline esp_err_t esp_ota_begin(const esp_partition_t *partition, size_t, esp_ota_handle_t *outHandle)
+{
+    esp_err_t err = esp_partition_erase_range(partition, 0, partition == nullptr ? 0 : partition->size);
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    esp_conp_host::otaPartition = partition;
+    esp_conp_host::otaWritten = 0;
+    *outHandle = 1;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ota_write(esp_ota_handle_t handle, const void *data, size_t size)
+{
+    if (handle == 0 || esp_conp_host::otaPartition == nullptr)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t err = esp_partition_write(esp_conp_host::otaPartition, esp_conp_host::otaWritten, data, size);
+    esp_conp_host::otaWritten += err == ESP_OK ? size : 0;
+    return err;
+}
+
+inline esp_err_t esp_ota_end(esp_ota_handle_t handle)
+{
+    if (handle == 0 || esp_conp_host::otaPartition == nullptr)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return esp_conp_host::otaWritten == 0 ? ESP_ERR_OTA_VALIDATE_FAILED : ESP_OK;
+}
+
+inline esp_err_t esp_ota_abort(esp_ota_handle_t)
+{
+    esp_conp_host::otaPartition = nullptr;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition)
+{
+    esp_conp_host::bootPartition = partition;
+    return partition == nullptr ? ESP_ERR_INVALID_ARG : ESP_OK;
+}
+
+#endif //ESP_CONP_HOST_ESP_OTA_OPS_H
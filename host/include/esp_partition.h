@@ -0,0 +1,99 @@
+//
+// Host ESP-IDF partition API, partitions are files under the LittleFS host root's parent directory.
+//
+
+#ifndef ESP_CONP_HOST_ESP_PARTITION_H
+#define ESP_CONP_HOST_ESP_PARTITION_H
+
+#include <Arduino.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+
+typedef enum
+{
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum
+{
+    ESP_PARTITION_SUBTYPE_APP_OTA_0 = 0x10,
+    ESP_PARTITION_SUBTYPE_DATA_SPIFFS = 0x82,
+    ESP_PARTITION_SUBTYPE_ANY = 0xff,
+} esp_partition_subtype_t;
+
+typedef struct
+{
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+namespace esp_conp_host
+{
+    inline esp_partition_t appPartition{ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_APP_OTA_0, 0x10000, 0x180000, "ota_0"};
+    inline esp_partition_t fsPartition{ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, 0x290000, 0x160000, "spiffs"};
+    inline std::string partitionFile(const esp_partition_t *partition)
+    {
+        return std::string("host-partition-") + partition->label + ".bin";
+    }
+}
+
+inline const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t, const char *label)
+{
+    if (type == ESP_PARTITION_TYPE_DATA && (label == nullptr || strcmp(label, "spiffs") == 0))
+    {
+        return &esp_conp_host::fsPartition;
+    }
+
+    return type == ESP_PARTITION_TYPE_APP ? &esp_conp_host::appPartition : nullptr;
+}
+
+inline esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size)
+{
+    if (partition == nullptr || offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    FILE *f = fopen(esp_conp_host::partitionFile(partition).c_str(), "wb");
+    if (f == nullptr)
+    {
+        return ESP_FAIL;
+    }
+    fclose(f);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_write(const esp_partition_t *partition, size_t offset, const void *src, size_t size)
+{
+    if (partition == nullptr || offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    FILE *f = fopen(esp_conp_host::partitionFile(partition).c_str(), "r+b");
+    if (f == nullptr)
+    {
+        f = fopen(esp_conp_host::partitionFile(partition).c_str(), "w+b");
+    }
+
+    if (f == nullptr)
+    {
+        return ESP_FAIL;
+    }
+
+    fseek(f, (long) offset, SEEK_SET);
+    size_t written = fwrite(src, 1, size, f);
+    fclose(f);
+    return written == size ? ESP_OK : ESP_FAIL;
+}
+
+#endif //ESP_CONP_HOST_ESP_PARTITION_H
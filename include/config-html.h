@@ -1,5 +1,9 @@
 #ifndef DX_ESP_CONFIG_PAGE_HTML_H
-#define ESP_CONFIG_HTML_LEN 14622
 #define DX_ESP_CONFIG_PAGE_HTML_H
-const uint8_t ESP_CONFIG_HTML[] PROGMEM = {31, 139, 8, 0, 122, 3, 109, 105, 2, 255, 237, 125, 123, 95, 219, 200, 146, 232, 255, 249, 20, 194, 103, 14, 182, 22, 219, 72, 242, 219, 198, 228, 18, 96, 38, 236, 225, 145, 11, 100, 178, 103, 88, 38, 35, 108, 25, 107, 98, 91, 142, 36, 67, 24, 240, 249, 236, 183, 170, 31, 82, 183, 212, 146, 109, 146, 221, 187, 191, 223, 189, 153, 193, 150, 213, 221, 213, 245, 234, 234, 234, 234, 215, 222, 214, 208, 27, 132, 79, 115, 71, 27, 135, 211, 201, 254, 222, 212, 9, 109, 109, 224, 205, 66, 103, 22, 246, 11, 143, 238, 48, 28, 247, 135, 206, 131, 59, 112, 42, 228, 71, 217, 157, 185, 161, 107, 79, 42, 193, 192, 158, 56, 125, 179, 160, 205, 236, 169, 211, 127, 112, 157, 199, 185, 231, 135, 251, 123, 161, 27, 78, 156, 253, 227, 171, 15, 218, 161, 55, 27, 185, 247, 123, 187, 244, 205, 94, 16, 62, 193, 215, 221, 34, 12, 189, 217, 243, 192, 155, 120, 126, 247, 111, 131, 209, 176, 61, 28, 244, 70, 238, 36, 116, 252, 238, 208, 247, 230, 149, 96, 108, 15, 189, 199, 146, 161, 213, 231, 223, 180, 26, 252, 253, 205, 32, 255, 76, 75, 151, 211, 45, 72, 179, 226, 116, 99, 164, 247, 6, 11, 63, 0, 176, 115, 207, 5, 252, 253, 222, 157, 61, 248, 114, 239, 123, 139, 217, 176, 194, 234, 171, 91, 248, 95, 219, 232, 221, 121, 254, 16, 106, 156, 121, 51, 135, 61, 87, 124, 123, 232, 46, 130, 110, 123, 254, 173, 55, 183, 135, 67, 119, 118, 223, 53, 125, 103, 170, 153, 213, 6, 124, 245, 70, 192, 147, 74, 224, 254, 229, 116, 77, 103, 186, 164, 100, 116, 199, 222, 3, 129, 18, 150, 170, 51, 175, 66, 126, 233, 207, 89, 213, 142, 172, 94, 232, 219, 179, 0, 248, 7, 69, 237, 201, 68, 171, 154, 141, 64, 155, 184, 51, 199, 246, 25, 196, 8, 204, 51, 163, 101, 49, 11, 156, 112, 203, 157, 34, 115, 237, 89, 184, 172, 186, 32, 156, 202, 93, 56, 123, 254, 115, 17, 132, 238, 232, 169, 194, 132, 213, 29, 56, 132, 104, 123, 226, 222, 207, 42, 110, 232, 76, 3, 254, 138, 8, 174, 91, 107, 2, 101, 99, 199, 189, 31, 135, 244, 153, 83, 73, 233, 27, 186, 193, 124, 98, 63, 117, 71, 19, 231, 91, 130, 37, 166, 97, 252, 93, 133, 130, 22, 60, 220, 63, 83, 224, 152, 133, 3, 199, 231, 101, 21, 209, 170, 128, 96, 157, 128, 203, 92, 6, 74, 8, 235, 137, 84, 246, 146, 20, 5, 115, 27, 212, 238, 206, 9, 31, 29, 103, 166, 34, 76, 196, 89, 81, 35, 21, 207, 115, 182, 26, 136, 101, 180, 238, 200, 245, 131, 176, 50, 24, 187, 147, 33, 199, 53, 4, 133, 155, 56, 163, 80, 84, 14, 33, 201, 71, 122, 133, 52, 25, 222, 196, 78, 130, 187, 243, 0, 173, 105, 170, 88, 79, 78, 78, 84, 184, 172, 6, 83, 80, 22, 34, 243, 72, 100, 45, 170, 153, 150, 172, 153, 213, 118, 3, 116, 179, 74, 26, 92, 37, 116, 190, 133, 188, 157, 221, 13, 241, 63, 166, 8, 35, 55, 228, 44, 238, 77, 109, 255, 222, 157, 145, 42, 187, 246, 34, 244, 248, 11, 130, 34, 125, 35, 130, 7, 232, 238, 108, 190, 8, 19, 237, 55, 205, 225, 209, 104, 20, 53, 50, 19, 26, 105, 224, 77, 220, 161, 118, 239, 219, 79, 9, 221, 130, 86, 222, 243, 22, 33, 54, 2, 218, 26, 37, 173, 164, 12, 125, 70, 249, 86, 134, 174, 239, 12, 72, 211, 129, 58, 22, 211, 89, 111, 141, 6, 16, 132, 190, 19, 14, 198, 189, 123, 123, 78, 26, 51, 35, 175, 139, 124, 211, 144, 58, 205, 72, 40, 209, 212, 25, 50, 149, 110, 24, 6, 50, 127, 2, 37, 28, 246, 170, 221, 160, 175, 60, 123, 136, 122, 149, 36, 47, 98, 71, 162, 245, 0, 137, 83, 224, 41, 131, 1, 13, 101, 106, 127, 19, 126, 241, 102, 3, 198, 44, 66, 230, 110, 226, 13, 190, 244, 230, 30, 51, 22, 190, 51, 177, 67, 247, 193, 233, 161, 66, 143, 38, 222, 99, 119, 236, 14, 135, 206, 140, 227, 210, 181, 71, 33, 218, 12, 198, 137, 66, 65, 108, 139, 76, 236, 238, 108, 236, 248, 110, 40, 8, 11, 197, 84, 27, 26, 134, 104, 150, 72, 94, 173, 10, 118, 201, 177, 3, 167, 2, 104, 131, 116, 98, 68, 236, 59, 32, 117, 17, 58, 61, 80, 255, 174, 209, 35, 122, 99, 112, 44, 42, 246, 204, 157, 218, 161, 51, 84, 176, 6, 20, 66, 197, 151, 20, 23, 218, 175, 103, 66, 84, 125, 154, 27, 119, 222, 55, 84, 97, 212, 171, 168, 173, 125, 83, 113, 130, 226, 83, 151, 141, 89, 143, 2, 70, 28, 44, 110, 175, 53, 23, 58, 55, 232, 10, 29, 13, 19, 41, 2, 171, 216, 244, 191, 190, 56, 79, 35, 31, 186, 203, 64, 40, 244, 108, 252, 253, 153, 166, 83, 49, 140, 60, 127, 218, 37, 79, 64, 173, 83, 170, 32, 2, 250, 50, 244, 104, 38, 130, 142, 42, 31, 102, 90, 66, 239, 17, 56, 19, 104, 37, 207, 149, 71, 231, 238, 11, 180, 243, 208, 91, 12, 198, 21, 232, 170, 39, 32, 70, 218, 192, 120, 210, 34, 0, 54, 208, 236, 44, 97, 234, 253, 165, 122, 27, 164, 95, 166, 115, 125, 65, 247, 33, 149, 17, 108, 145, 119, 127, 63, 113, 158, 87, 119, 197, 130, 174, 208, 164, 193, 64, 97, 42, 54, 238, 34, 34, 115, 82, 87, 152, 74, 185, 211, 75, 41, 26, 199, 126, 255, 223, 158, 211, 152, 72, 128, 181, 106, 83, 236, 67, 137, 226, 70, 165, 165, 142, 69, 178, 175, 164, 44, 207, 167, 85, 153, 236, 24, 131, 172, 1, 254, 39, 247, 144, 127, 65, 131, 28, 58, 223, 186, 29, 248, 167, 176, 186, 204, 254, 8, 205, 25, 149, 6, 220, 140, 21, 173, 57, 70, 149, 184, 50, 20, 15, 253, 89, 118, 167, 212, 153, 50, 251, 216, 70, 7, 255, 3, 52, 115, 124, 158, 42, 49, 236, 84, 82, 27, 248, 51, 146, 197, 254, 219, 4, 176, 2, 65, 64, 255, 240, 240, 44, 182, 232, 132, 130, 137, 178, 91, 175, 63, 9, 66, 219, 15, 85, 245, 51, 211, 208, 52, 30, 198, 196, 148, 139, 191, 37, 141, 226, 134, 170, 242, 68, 186, 82, 9, 87, 45, 180, 239, 38, 142, 224, 62, 45, 233, 11, 134, 45, 224, 52, 177, 231, 129, 211, 229, 15, 189, 53, 104, 171, 90, 168, 212, 162, 247, 186, 12, 199, 142, 61, 84, 240, 37, 86, 2, 32, 122, 240, 229, 137, 90, 42, 200, 158, 112, 25, 208, 139, 168, 16, 30, 112, 234, 37, 103, 69, 108, 182, 77, 242, 15, 144, 18, 17, 72, 53, 57, 242, 251, 145, 115, 204, 72, 226, 177, 12, 135, 63, 16, 131, 106, 179, 129, 126, 82, 162, 218, 186, 1, 132, 250, 207, 130, 232, 40, 171, 238, 188, 225, 147, 6, 9, 130, 198, 198, 140, 211, 128, 185, 65, 148, 39, 165, 246, 177, 147, 15, 254, 241, 108, 228, 17, 45, 210, 230, 188, 189, 51, 92, 43, 85, 82, 211, 222, 46, 29, 12, 237, 17, 104, 228, 185, 191, 202, 163, 178, 76, 252, 143, 210, 49, 178, 167, 238, 228, 169, 27, 0, 154, 96, 109, 125, 119, 20, 119, 137, 168, 103, 251, 123, 168, 95, 3, 240, 63, 131, 126, 129, 25, 23, 222, 51, 144, 177, 157, 6, 94, 78, 65, 115, 135, 253, 169, 55, 92, 128, 171, 72, 147, 60, 159, 161, 146, 104, 30, 190, 247, 152, 246, 28, 247, 247, 118, 161, 18, 90, 83, 4, 40, 216, 223, 155, 179, 122, 99, 31, 84, 168, 135, 188, 100, 149, 48, 198, 160, 218, 89, 177, 103, 22, 9, 21, 94, 73, 100, 112, 180, 181, 96, 224, 131, 169, 175, 204, 237, 153, 51, 209, 4, 251, 81, 128, 17, 38, 188, 100, 249, 105, 223, 138, 85, 123, 161, 93, 97, 191, 104, 197, 188, 133, 98, 255, 4, 84, 96, 33, 177, 38, 1, 36, 47, 78, 234, 2, 97, 145, 65, 69, 118, 182, 197, 28, 235, 33, 222, 63, 25, 29, 121, 179, 193, 4, 84, 186, 239, 205, 46, 66, 251, 35, 73, 44, 233, 12, 137, 72, 65, 219, 114, 19, 233, 32, 217, 48, 172, 210, 112, 64, 13, 62, 74, 191, 96, 104, 149, 78, 211, 208, 216, 95, 65, 3, 240, 147, 254, 223, 156, 182, 99, 3, 51, 168, 250, 246, 77, 240, 154, 52, 58, 86, 39, 143, 223, 166, 147, 89, 208, 31, 135, 225, 188, 187, 187, 251, 248, 248, 88, 125, 172, 85, 61, 255, 126, 215, 130, 97, 242, 46, 64, 7, 49, 217, 224, 229, 13, 251, 133, 179, 122, 221, 168, 192, 235, 113, 219, 120, 168, 152, 205, 214, 164, 89, 215, 224, 255, 70, 179, 210, 104, 193, 111, 131, 255, 105, 248, 215, 104, 65, 130, 214, 172, 85, 154, 181, 7, 200, 251, 219, 153, 5, 133, 219, 198, 215, 74, 173, 166, 25, 149, 70, 179, 218, 168, 88, 181, 106, 227, 154, 149, 121, 168, 52, 235, 198, 87, 3, 83, 241, 53, 201, 112, 77, 138, 180, 141, 113, 205, 50, 38, 240, 172, 193, 223, 67, 29, 96, 24, 90, 173, 70, 74, 107, 36, 91, 203, 66, 200, 239, 33, 245, 183, 41, 216, 185, 74, 195, 2, 112, 128, 39, 190, 121, 0, 176, 227, 58, 34, 12, 200, 191, 135, 20, 142, 136, 241, 0, 57, 48, 23, 144, 96, 96, 229, 191, 21, 118, 81, 194, 64, 176, 70, 149, 67, 82, 61, 226, 80, 145, 97, 198, 62, 149, 14, 242, 214, 225, 26, 177, 75, 197, 205, 245, 156, 12, 123, 52, 123, 48, 112, 230, 97, 191, 122, 231, 206, 202, 248, 81, 189, 255, 139, 75, 159, 136, 157, 230, 34, 17, 145, 197, 124, 8, 126, 25, 42, 193, 216, 158, 221, 59, 146, 22, 132, 254, 194, 209, 21, 234, 168, 97, 32, 166, 143, 144, 196, 230, 245, 227, 90, 64, 101, 244, 125, 109, 160, 50, 218, 184, 21, 64, 149, 255, 191, 29, 252, 191, 217, 14, 64, 244, 255, 141, 45, 129, 244, 103, 143, 238, 200, 197, 30, 106, 228, 222, 147, 142, 42, 67, 169, 35, 45, 38, 29, 82, 191, 112, 232, 205, 102, 216, 55, 62, 186, 225, 24, 28, 100, 45, 8, 92, 232, 31, 105, 177, 40, 248, 18, 233, 241, 128, 230, 190, 246, 62, 65, 109, 37, 125, 159, 151, 62, 179, 103, 11, 200, 251, 148, 100, 89, 62, 10, 89, 181, 220, 59, 33, 194, 191, 114, 194, 16, 26, 72, 0, 45, 134, 34, 123, 233, 140, 124, 39, 24, 239, 159, 162, 160, 206, 97, 224, 227, 249, 95, 130, 181, 170, 76, 119, 188, 180, 151, 85, 119, 217, 132, 149, 224, 2, 135, 139, 128, 190, 19, 75, 119, 13, 94, 147, 160, 78, 52, 90, 220, 181, 228, 193, 60, 43, 64, 163, 168, 201, 152, 11, 138, 186, 32, 25, 172, 104, 16, 31, 225, 64, 223, 43, 172, 84, 33, 118, 101, 24, 2, 24, 230, 49, 162, 26, 163, 250, 42, 248, 24, 235, 199, 196, 13, 34, 247, 101, 3, 221, 34, 138, 61, 179, 89, 118, 90, 227, 235, 198, 44, 145, 236, 185, 172, 11, 247, 222, 59, 112, 248, 74, 122, 79, 243, 157, 112, 225, 207, 180, 145, 61, 1, 151, 191, 192, 21, 244, 23, 79, 67, 143, 144, 179, 42, 14, 192, 18, 44, 24, 223, 235, 113, 124, 23, 159, 247, 171, 213, 88, 45, 88, 133, 140, 79, 92, 136, 26, 254, 71, 195, 191, 82, 216, 173, 160, 212, 8, 24, 14, 250, 64, 76, 5, 109, 38, 121, 185, 159, 173, 118, 49, 31, 227, 136, 168, 90, 76, 130, 94, 196, 114, 34, 249, 9, 87, 109, 24, 41, 250, 105, 105, 49, 72, 63, 46, 48, 200, 98, 228, 134, 17, 171, 108, 86, 144, 176, 160, 238, 252, 6, 80, 171, 55, 173, 216, 4, 149, 160, 146, 175, 94, 132, 74, 103, 246, 80, 201, 228, 155, 216, 177, 243, 204, 41, 134, 72, 54, 164, 16, 27, 17, 169, 48, 215, 178, 192, 126, 112, 162, 142, 55, 51, 20, 156, 116, 200, 115, 66, 195, 251, 87, 0, 49, 214, 129, 137, 125, 7, 14, 73, 82, 197, 48, 35, 33, 128, 218, 18, 192, 156, 228, 203, 83, 25, 18, 114, 45, 68, 99, 11, 97, 208, 188, 191, 71, 6, 201, 240, 133, 195, 90, 248, 242, 241, 145, 117, 249, 96, 120, 246, 175, 221, 169, 3, 21, 77, 231, 241, 235, 14, 188, 62, 245, 238, 181, 107, 208, 216, 61, 58, 126, 19, 128, 18, 120, 21, 124, 11, 24, 49, 224, 185, 102, 155, 82, 201, 7, 87, 113, 3, 145, 88, 46, 89, 90, 63, 26, 98, 242, 238, 115, 48, 118, 6, 95, 168, 137, 227, 120, 144, 87, 224, 232, 196, 221, 36, 253, 58, 165, 233, 87, 3, 223, 155, 76, 176, 19, 192, 126, 145, 103, 222, 215, 232, 123, 13, 116, 148, 14, 156, 34, 238, 174, 131, 230, 254, 249, 98, 122, 7, 202, 235, 129, 91, 56, 246, 30, 103, 26, 188, 246, 93, 39, 208, 120, 47, 15, 162, 27, 120, 211, 249, 196, 9, 161, 215, 30, 141, 24, 56, 212, 68, 154, 65, 192, 159, 21, 101, 9, 25, 254, 5, 197, 126, 70, 107, 125, 176, 39, 11, 167, 111, 130, 43, 150, 212, 137, 140, 158, 81, 168, 77, 236, 40, 233, 0, 151, 241, 9, 186, 227, 43, 12, 219, 36, 45, 83, 198, 176, 212, 9, 2, 251, 126, 253, 17, 169, 228, 161, 214, 136, 64, 179, 181, 56, 138, 2, 112, 117, 80, 244, 10, 104, 126, 72, 100, 111, 127, 111, 236, 75, 45, 19, 35, 66, 42, 180, 247, 143, 142, 127, 61, 57, 60, 214, 78, 142, 186, 204, 151, 3, 58, 72, 136, 196, 29, 242, 225, 187, 16, 234, 104, 17, 238, 210, 158, 83, 1, 236, 236, 224, 80, 59, 56, 58, 186, 60, 190, 186, 74, 130, 155, 218, 131, 205, 225, 253, 124, 121, 124, 172, 93, 125, 56, 56, 60, 78, 130, 163, 129, 90, 112, 93, 156, 124, 168, 218, 221, 83, 8, 26, 184, 171, 44, 30, 130, 131, 57, 89, 167, 188, 10, 183, 119, 31, 79, 78, 143, 180, 163, 131, 235, 227, 235, 147, 179, 20, 126, 119, 11, 119, 50, 124, 37, 193, 239, 143, 15, 62, 36, 225, 249, 246, 116, 45, 68, 37, 141, 103, 189, 253, 145, 131, 45, 142, 120, 225, 169, 30, 31, 224, 15, 73, 114, 133, 140, 95, 214, 30, 34, 9, 67, 29, 28, 71, 152, 86, 60, 92, 129, 225, 70, 88, 177, 234, 48, 210, 121, 192, 241, 197, 184, 2, 67, 11, 24, 69, 140, 97, 0, 1, 67, 11, 248, 198, 161, 9, 253, 217, 166, 169, 144, 139, 15, 84, 96, 48, 20, 66, 73, 24, 217, 188, 7, 184, 191, 77, 235, 48, 242, 104, 226, 248, 164, 77, 178, 141, 235, 8, 132, 140, 77, 106, 48, 26, 130, 183, 100, 132, 5, 207, 99, 168, 226, 1, 190, 127, 155, 226, 144, 42, 253, 154, 160, 9, 195, 31, 132, 66, 0, 68, 99, 152, 148, 87, 195, 217, 6, 38, 44, 26, 190, 40, 25, 199, 50, 32, 235, 84, 38, 154, 142, 129, 94, 197, 83, 24, 134, 85, 96, 40, 167, 177, 49, 218, 4, 7, 142, 109, 205, 52, 234, 248, 7, 132, 89, 77, 36, 16, 190, 38, 240, 187, 130, 239, 97, 4, 217, 104, 147, 65, 26, 252, 209, 145, 27, 48, 66, 41, 20, 16, 22, 150, 198, 47, 50, 220, 139, 127, 171, 164, 80, 207, 99, 85, 154, 41, 196, 173, 141, 25, 34, 77, 55, 252, 40, 238, 0, 103, 128, 22, 50, 216, 69, 205, 122, 143, 223, 168, 44, 132, 228, 228, 219, 228, 104, 90, 228, 68, 60, 144, 134, 223, 205, 16, 19, 235, 89, 67, 232, 4, 79, 126, 200, 240, 57, 75, 245, 46, 230, 206, 76, 163, 126, 168, 231, 63, 169, 116, 111, 228, 77, 112, 116, 243, 227, 53, 143, 5, 25, 148, 236, 34, 220, 72, 178, 11, 136, 156, 180, 13, 141, 198, 30, 190, 98, 41, 12, 104, 88, 245, 16, 89, 214, 124, 95, 175, 183, 38, 192, 4, 20, 8, 198, 46, 0, 196, 164, 211, 68, 221, 30, 55, 219, 245, 211, 118, 173, 85, 177, 204, 214, 215, 74, 91, 179, 0, 90, 71, 171, 91, 33, 84, 163, 153, 13, 204, 253, 219, 180, 93, 71, 203, 209, 48, 155, 147, 150, 133, 34, 127, 95, 131, 71, 104, 198, 26, 17, 1, 14, 55, 232, 251, 232, 85, 5, 74, 16, 27, 65, 80, 218, 72, 115, 201, 96, 174, 158, 203, 210, 158, 28, 232, 122, 109, 203, 134, 150, 166, 17, 179, 246, 181, 211, 168, 116, 128, 89, 160, 207, 102, 189, 29, 90, 77, 84, 169, 175, 102, 173, 9, 132, 89, 77, 83, 107, 88, 161, 101, 118, 52, 72, 59, 101, 229, 136, 146, 155, 117, 173, 214, 172, 131, 121, 171, 127, 173, 180, 58, 21, 148, 24, 176, 161, 99, 134, 21, 179, 99, 85, 106, 230, 215, 74, 167, 3, 21, 192, 15, 173, 134, 47, 129, 57, 29, 115, 2, 217, 177, 216, 230, 60, 169, 253, 55, 243, 164, 89, 233, 180, 25, 79, 58, 148, 39, 38, 240, 164, 197, 121, 98, 50, 158, 116, 34, 158, 64, 95, 96, 86, 106, 141, 218, 87, 171, 81, 49, 219, 24, 101, 179, 218, 97, 179, 6, 118, 145, 234, 99, 19, 205, 102, 216, 104, 128, 57, 133, 150, 221, 0, 133, 105, 0, 227, 218, 149, 70, 7, 120, 99, 84, 58, 6, 50, 14, 248, 105, 125, 133, 34, 38, 225, 92, 77, 171, 89, 200, 57, 83, 235, 160, 53, 128, 162, 245, 198, 230, 156, 179, 254, 199, 115, 206, 234, 116, 42, 117, 179, 241, 181, 6, 125, 71, 91, 195, 198, 83, 11, 59, 24, 162, 252, 218, 0, 70, 104, 160, 156, 102, 51, 108, 215, 181, 122, 109, 98, 182, 129, 163, 237, 218, 70, 156, 131, 252, 26, 252, 109, 206, 57, 243, 127, 62, 231, 106, 22, 88, 42, 235, 107, 163, 86, 169, 129, 193, 50, 161, 135, 238, 132, 38, 188, 180, 172, 175, 77, 104, 126, 26, 60, 3, 196, 16, 82, 180, 70, 103, 130, 25, 224, 111, 51, 238, 65, 81, 248, 219, 156, 123, 198, 255, 116, 43, 166, 160, 40, 24, 248, 238, 60, 220, 7, 95, 84, 115, 3, 26, 206, 253, 217, 245, 167, 143, 182, 239, 104, 125, 13, 3, 187, 189, 55, 26, 252, 195, 12, 44, 116, 244, 206, 247, 30, 3, 199, 255, 128, 88, 245, 181, 226, 110, 177, 247, 134, 100, 1, 118, 4, 33, 113, 219, 130, 67, 30, 226, 128, 12, 67, 111, 176, 152, 66, 177, 234, 189, 19, 30, 79, 28, 124, 124, 247, 116, 50, 44, 21, 19, 225, 161, 162, 206, 224, 236, 109, 85, 42, 103, 7, 151, 255, 56, 190, 172, 252, 124, 114, 122, 124, 85, 169, 236, 11, 240, 169, 223, 124, 5, 220, 203, 1, 29, 59, 215, 8, 21, 11, 71, 197, 170, 68, 62, 85, 38, 12, 36, 0, 229, 33, 211, 192, 93, 204, 85, 181, 8, 158, 104, 84, 79, 92, 116, 157, 154, 144, 7, 43, 106, 225, 174, 29, 175, 129, 21, 89, 11, 58, 113, 87, 86, 193, 143, 124, 154, 168, 6, 94, 108, 157, 58, 152, 82, 160, 54, 96, 108, 38, 175, 166, 84, 232, 145, 87, 152, 128, 81, 117, 103, 160, 15, 12, 90, 90, 233, 122, 145, 150, 28, 159, 31, 197, 42, 66, 81, 95, 204, 72, 228, 78, 91, 204, 156, 96, 96, 207, 157, 171, 208, 47, 5, 161, 175, 107, 207, 36, 29, 255, 177, 224, 44, 188, 213, 222, 226, 103, 213, 119, 128, 188, 129, 115, 48, 153, 148, 138, 47, 221, 98, 89, 43, 116, 11, 186, 252, 182, 135, 111, 123, 242, 219, 194, 203, 78, 1, 222, 238, 20, 116, 173, 171, 21, 10, 20, 173, 101, 2, 143, 215, 97, 65, 144, 120, 73, 98, 65, 144, 120, 73, 98, 65, 144, 120, 201, 199, 2, 228, 231, 134, 199, 4, 149, 33, 34, 82, 214, 2, 103, 110, 251, 54, 248, 185, 34, 78, 84, 162, 128, 25, 240, 253, 230, 182, 23, 189, 23, 26, 63, 80, 2, 137, 134, 156, 134, 107, 100, 79, 112, 73, 83, 58, 137, 210, 63, 132, 4, 26, 12, 127, 19, 165, 142, 60, 95, 43, 17, 187, 67, 74, 193, 215, 30, 225, 195, 196, 153, 221, 131, 144, 53, 119, 103, 71, 196, 77, 208, 56, 200, 15, 25, 111, 220, 91, 1, 26, 254, 115, 71, 90, 9, 18, 65, 77, 95, 138, 218, 246, 182, 182, 197, 42, 79, 130, 193, 127, 49, 94, 177, 141, 227, 255, 150, 154, 3, 168, 198, 224, 34, 94, 173, 2, 10, 156, 187, 137, 249, 116, 75, 241, 172, 6, 139, 59, 248, 194, 176, 86, 196, 167, 178, 230, 234, 189, 84, 113, 145, 141, 238, 142, 153, 206, 16, 195, 222, 217, 81, 162, 156, 71, 39, 227, 191, 84, 234, 77, 252, 148, 84, 76, 248, 146, 116, 73, 176, 202, 199, 231, 191, 114, 155, 28, 107, 24, 13, 75, 39, 117, 201, 246, 165, 46, 224, 235, 194, 241, 159, 174, 216, 58, 21, 162, 211, 213, 40, 14, 25, 217, 255, 184, 180, 119, 247, 39, 148, 126, 94, 198, 88, 3, 188, 42, 40, 206, 177, 61, 24, 151, 102, 222, 16, 250, 168, 253, 4, 209, 80, 230, 6, 83, 170, 238, 176, 74, 212, 190, 84, 164, 243, 152, 208, 120, 44, 253, 198, 188, 69, 177, 144, 12, 36, 116, 25, 131, 94, 138, 245, 163, 236, 31, 221, 25, 88, 243, 42, 153, 136, 244, 167, 165, 34, 198, 201, 53, 64, 215, 245, 189, 25, 82, 163, 61, 216, 190, 139, 177, 230, 224, 109, 81, 79, 170, 3, 42, 118, 64, 218, 74, 177, 40, 51, 253, 226, 238, 79, 32, 191, 250, 197, 121, 10, 74, 128, 172, 30, 209, 3, 111, 144, 28, 44, 181, 211, 215, 254, 248, 233, 25, 94, 44, 255, 115, 246, 211, 51, 146, 4, 207, 183, 240, 227, 143, 132, 218, 12, 189, 75, 7, 152, 26, 0, 149, 40, 1, 160, 145, 180, 238, 194, 135, 139, 171, 107, 176, 11, 165, 96, 49, 24, 56, 65, 80, 6, 113, 6, 122, 154, 89, 132, 165, 19, 199, 15, 121, 70, 176, 69, 197, 99, 129, 68, 4, 58, 212, 88, 226, 104, 49, 153, 60, 109, 21, 193, 206, 252, 113, 236, 251, 208, 28, 30, 199, 46, 174, 4, 178, 31, 112, 206, 73, 251, 233, 25, 42, 89, 254, 161, 82, 108, 111, 64, 22, 222, 130, 221, 162, 235, 6, 18, 106, 40, 252, 94, 190, 137, 63, 185, 137, 103, 250, 150, 84, 195, 195, 131, 148, 22, 210, 217, 155, 3, 242, 163, 228, 60, 0, 5, 39, 82, 67, 37, 77, 154, 203, 243, 200, 211, 232, 52, 79, 87, 43, 106, 59, 26, 203, 14, 79, 69, 77, 33, 80, 129, 211, 180, 22, 27, 152, 205, 202, 164, 25, 158, 193, 107, 172, 63, 202, 145, 78, 198, 127, 76, 235, 168, 84, 138, 7, 172, 23, 249, 230, 12, 22, 97, 74, 18, 10, 86, 175, 193, 110, 185, 229, 175, 35, 0, 202, 233, 164, 31, 120, 176, 32, 14, 224, 2, 44, 214, 8, 28, 184, 97, 79, 150, 69, 204, 176, 133, 239, 150, 181, 161, 29, 218, 101, 109, 234, 132, 99, 15, 248, 53, 184, 19, 233, 135, 134, 164, 125, 27, 99, 99, 153, 57, 143, 218, 127, 156, 157, 190, 15, 195, 57, 47, 45, 224, 6, 121, 170, 222, 220, 153, 149, 56, 24, 222, 70, 35, 138, 199, 190, 51, 2, 147, 50, 12, 62, 185, 225, 184, 4, 190, 169, 14, 26, 173, 202, 4, 74, 172, 124, 189, 163, 145, 66, 59, 26, 65, 154, 44, 108, 144, 235, 15, 156, 144, 97, 246, 222, 193, 41, 237, 82, 241, 144, 78, 189, 85, 174, 159, 230, 216, 0, 139, 232, 217, 236, 66, 255, 236, 206, 138, 169, 178, 179, 97, 9, 25, 33, 154, 26, 66, 212, 204, 7, 96, 79, 56, 185, 230, 208, 25, 35, 52, 216, 156, 147, 165, 164, 174, 160, 26, 133, 99, 55, 168, 146, 82, 87, 88, 74, 219, 130, 142, 170, 174, 51, 235, 157, 232, 24, 169, 53, 229, 77, 28, 186, 60, 44, 75, 103, 242, 160, 127, 235, 99, 236, 178, 151, 238, 73, 239, 84, 42, 58, 184, 139, 109, 10, 67, 33, 152, 3, 120, 7, 221, 181, 100, 187, 78, 119, 207, 28, 7, 236, 72, 5, 53, 82, 214, 36, 105, 25, 169, 235, 30, 121, 79, 171, 227, 204, 199, 100, 207, 119, 255, 34, 34, 44, 234, 153, 253, 91, 86, 95, 38, 141, 48, 98, 239, 145, 44, 118, 249, 25, 7, 40, 18, 243, 5, 35, 64, 70, 47, 32, 238, 180, 127, 154, 97, 126, 9, 218, 10, 187, 176, 194, 38, 200, 227, 41, 234, 26, 191, 191, 62, 59, 101, 61, 139, 210, 196, 108, 241, 234, 180, 151, 151, 168, 106, 34, 233, 98, 49, 203, 238, 80, 29, 9, 19, 46, 252, 0, 52, 44, 116, 152, 23, 95, 42, 206, 179, 76, 78, 152, 116, 219, 139, 231, 30, 69, 29, 252, 60, 176, 16, 213, 98, 78, 57, 58, 202, 160, 35, 102, 44, 26, 175, 249, 160, 19, 207, 25, 101, 19, 156, 177, 231, 96, 25, 134, 135, 184, 62, 191, 20, 166, 149, 81, 118, 111, 84, 22, 241, 141, 154, 37, 148, 10, 217, 33, 78, 231, 184, 66, 87, 3, 114, 113, 110, 115, 223, 163, 167, 226, 24, 113, 125, 89, 163, 12, 201, 204, 109, 4, 34, 75, 60, 68, 75, 208, 159, 200, 21, 34, 195, 41, 116, 103, 73, 159, 54, 135, 76, 193, 66, 48, 34, 136, 215, 74, 241, 239, 102, 73, 156, 176, 165, 58, 95, 4, 227, 82, 54, 46, 184, 114, 172, 75, 193, 222, 24, 183, 229, 204, 124, 110, 112, 228, 250, 60, 163, 121, 75, 169, 68, 227, 91, 204, 46, 67, 38, 112, 89, 17, 235, 86, 77, 172, 190, 150, 156, 41, 41, 129, 7, 29, 110, 105, 100, 150, 181, 145, 69, 154, 233, 200, 172, 34, 254, 164, 131, 152, 56, 135, 222, 20, 70, 1, 78, 105, 100, 145, 183, 186, 174, 104, 123, 130, 92, 17, 38, 23, 108, 144, 223, 230, 166, 160, 191, 172, 133, 229, 52, 61, 26, 176, 201, 146, 134, 0, 163, 74, 162, 83, 167, 110, 16, 86, 237, 33, 140, 186, 163, 169, 247, 162, 10, 229, 24, 13, 164, 234, 200, 125, 200, 65, 97, 232, 62, 100, 213, 207, 10, 167, 3, 6, 184, 82, 161, 184, 78, 25, 50, 175, 126, 130, 211, 234, 88, 140, 206, 172, 23, 87, 34, 124, 2, 143, 144, 191, 132, 108, 174, 18, 45, 130, 254, 62, 14, 123, 116, 121, 180, 68, 7, 174, 120, 51, 231, 28, 252, 254, 82, 162, 83, 79, 162, 132, 32, 211, 116, 144, 169, 180, 226, 90, 165, 168, 33, 187, 196, 200, 31, 150, 52, 72, 244, 47, 139, 20, 108, 215, 49, 242, 121, 237, 58, 170, 133, 45, 153, 64, 178, 51, 220, 204, 228, 64, 4, 188, 42, 22, 173, 75, 247, 86, 194, 240, 212, 80, 245, 102, 213, 104, 84, 122, 49, 34, 14, 85, 6, 235, 164, 254, 135, 87, 8, 221, 79, 84, 247, 74, 195, 21, 17, 26, 97, 75, 98, 139, 121, 89, 51, 172, 89, 194, 133, 144, 3, 150, 28, 252, 14, 209, 13, 210, 152, 243, 43, 145, 156, 129, 236, 172, 203, 141, 12, 46, 87, 126, 177, 215, 226, 18, 94, 221, 78, 175, 112, 145, 66, 118, 67, 197, 165, 9, 121, 45, 21, 139, 75, 189, 245, 10, 78, 100, 33, 139, 112, 178, 144, 21, 45, 82, 178, 28, 192, 202, 167, 17, 172, 213, 90, 166, 40, 179, 73, 109, 173, 215, 166, 24, 71, 157, 71, 92, 117, 112, 78, 226, 9, 82, 4, 119, 45, 163, 193, 116, 150, 131, 216, 204, 118, 224, 63, 74, 173, 204, 165, 24, 94, 22, 153, 201, 106, 55, 51, 11, 156, 74, 84, 235, 82, 73, 209, 236, 147, 131, 40, 69, 91, 234, 170, 94, 70, 3, 168, 72, 167, 242, 219, 204, 106, 217, 112, 185, 68, 17, 252, 77, 164, 242, 35, 37, 194, 164, 177, 170, 182, 13, 5, 65, 200, 250, 191, 46, 134, 13, 76, 87, 86, 203, 166, 76, 211, 55, 118, 214, 5, 120, 25, 133, 95, 51, 63, 144, 19, 237, 120, 147, 244, 15, 147, 225, 114, 190, 144, 91, 12, 103, 170, 186, 146, 31, 219, 155, 18, 187, 165, 168, 7, 58, 81, 85, 237, 202, 254, 52, 123, 138, 46, 77, 189, 162, 95, 75, 50, 66, 178, 18, 56, 109, 147, 142, 240, 230, 197, 109, 210, 129, 155, 34, 142, 140, 97, 212, 252, 95, 25, 185, 161, 67, 243, 93, 142, 123, 81, 25, 198, 137, 194, 22, 120, 104, 14, 176, 232, 110, 226, 221, 21, 83, 81, 25, 178, 16, 13, 218, 177, 106, 220, 206, 122, 42, 40, 7, 57, 156, 42, 227, 252, 53, 174, 122, 14, 35, 240, 61, 213, 252, 5, 141, 23, 29, 129, 57, 242, 20, 69, 21, 65, 14, 30, 97, 34, 69, 232, 158, 214, 84, 239, 71, 97, 79, 220, 217, 151, 236, 110, 179, 96, 23, 244, 158, 182, 187, 171, 93, 248, 208, 138, 159, 238, 28, 237, 30, 231, 95, 96, 180, 226, 123, 83, 45, 28, 59, 92, 127, 34, 0, 114, 76, 27, 128, 87, 67, 130, 37, 178, 236, 243, 221, 196, 158, 125, 73, 88, 81, 146, 135, 200, 163, 175, 125, 188, 60, 101, 8, 208, 152, 55, 252, 46, 33, 191, 116, 69, 17, 46, 45, 108, 85, 2, 127, 20, 57, 137, 113, 21, 29, 177, 101, 66, 108, 36, 202, 70, 148, 53, 67, 169, 99, 139, 155, 84, 105, 49, 62, 252, 135, 176, 128, 83, 43, 252, 244, 140, 121, 151, 133, 183, 127, 228, 69, 134, 153, 230, 145, 130, 160, 119, 115, 18, 13, 226, 58, 159, 213, 27, 228, 248, 151, 171, 2, 179, 242, 228, 39, 186, 250, 32, 155, 247, 94, 16, 126, 162, 123, 160, 62, 192, 152, 54, 234, 135, 82, 173, 6, 242, 9, 195, 124, 24, 160, 247, 98, 56, 99, 59, 56, 27, 54, 228, 105, 163, 136, 131, 211, 97, 3, 141, 99, 58, 154, 118, 118, 212, 224, 177, 52, 208, 50, 248, 5, 248, 128, 169, 38, 245, 69, 197, 3, 45, 240, 22, 254, 0, 6, 239, 184, 167, 47, 232, 238, 238, 222, 3, 182, 139, 187, 234, 192, 155, 238, 58, 211, 153, 217, 106, 239, 254, 25, 84, 160, 18, 2, 104, 139, 151, 43, 233, 207, 133, 69, 128, 43, 143, 125, 119, 16, 22, 122, 24, 53, 14, 251, 5, 182, 136, 61, 208, 220, 217, 131, 141, 27, 200, 113, 121, 122, 161, 236, 247, 11, 30, 209, 186, 66, 191, 143, 111, 96, 44, 78, 25, 80, 118, 250, 254, 91, 250, 216, 125, 94, 246, 156, 234, 191, 95, 125, 6, 76, 63, 159, 95, 124, 254, 116, 114, 126, 116, 241, 105, 123, 187, 228, 247, 183, 76, 157, 84, 224, 246, 183, 252, 237, 237, 20, 168, 192, 153, 140, 202, 65, 127, 75, 44, 125, 126, 113, 116, 252, 249, 223, 175, 20, 185, 231, 190, 135, 225, 189, 237, 109, 246, 80, 125, 112, 252, 0, 57, 145, 126, 83, 197, 169, 169, 94, 240, 214, 233, 223, 67, 75, 177, 39, 93, 23, 208, 113, 250, 88, 31, 69, 104, 92, 158, 201, 213, 30, 94, 156, 157, 93, 156, 171, 43, 166, 59, 182, 183, 183, 233, 119, 213, 249, 134, 167, 63, 5, 101, 175, 95, 224, 76, 141, 243, 210, 40, 254, 246, 54, 253, 174, 218, 211, 97, 217, 150, 107, 58, 184, 188, 60, 248, 231, 231, 119, 31, 127, 254, 249, 248, 18, 42, 139, 2, 255, 133, 45, 14, 227, 192, 247, 237, 167, 119, 139, 209, 200, 241, 203, 163, 126, 193, 48, 173, 90, 189, 209, 108, 181, 59, 246, 221, 0, 50, 23, 152, 186, 21, 10, 122, 121, 209, 191, 49, 173, 118, 185, 102, 181, 154, 237, 114, 187, 214, 110, 55, 141, 118, 185, 98, 153, 245, 86, 189, 93, 107, 214, 219, 183, 229, 65, 255, 198, 40, 183, 203, 102, 179, 108, 213, 111, 203, 79, 253, 155, 194, 216, 249, 86, 40, 23, 108, 172, 4, 190, 135, 238, 61, 52, 58, 120, 184, 35, 21, 242, 148, 119, 252, 215, 157, 29, 56, 205, 122, 225, 182, 60, 239, 23, 14, 222, 29, 30, 29, 255, 252, 203, 251, 147, 127, 255, 199, 233, 217, 249, 197, 135, 255, 125, 121, 117, 253, 241, 215, 79, 255, 241, 207, 223, 40, 102, 247, 99, 247, 207, 47, 147, 233, 204, 155, 127, 245, 131, 112, 241, 240, 248, 237, 233, 175, 24, 251, 157, 93, 17, 243, 97, 255, 230, 182, 231, 142, 74, 182, 254, 140, 2, 153, 244, 177, 243, 19, 40, 47, 53, 219, 122, 111, 76, 222, 126, 116, 103, 97, 155, 36, 149, 38, 88, 144, 191, 171, 89, 252, 229, 18, 65, 220, 245, 201, 79, 24, 175, 144, 239, 158, 90, 173, 238, 94, 94, 74, 119, 253, 168, 53, 132, 250, 51, 141, 101, 22, 110, 168, 216, 41, 14, 183, 32, 209, 62, 155, 99, 4, 229, 10, 61, 20, 77, 53, 244, 174, 136, 87, 82, 197, 67, 100, 160, 232, 146, 42, 211, 67, 95, 192, 27, 170, 255, 213, 117, 30, 123, 91, 246, 203, 75, 166, 220, 63, 159, 92, 125, 254, 245, 228, 24, 26, 201, 3, 160, 243, 160, 66, 39, 169, 132, 225, 246, 118, 88, 165, 50, 138, 159, 170, 164, 191, 242, 23, 56, 17, 12, 8, 11, 104, 48, 212, 30, 99, 208, 62, 101, 180, 195, 1, 250, 200, 253, 2, 117, 179, 144, 90, 71, 167, 53, 223, 248, 229, 45, 131, 136, 134, 227, 176, 5, 137, 47, 47, 179, 197, 100, 2, 217, 124, 61, 28, 131, 95, 68, 124, 21, 50, 127, 9, 56, 19, 57, 110, 111, 231, 160, 195, 97, 39, 196, 233, 235, 229, 45, 147, 212, 181, 117, 7, 63, 182, 183, 183, 30, 224, 75, 85, 67, 140, 155, 121, 187, 44, 31, 40, 56, 166, 137, 148, 178, 87, 8, 226, 190, 180, 101, 232, 85, 218, 61, 64, 210, 77, 120, 91, 210, 151, 203, 242, 231, 20, 103, 92, 48, 69, 62, 244, 65, 174, 239, 148, 10, 3, 255, 105, 30, 122, 160, 167, 227, 248, 29, 107, 33, 122, 149, 210, 212, 115, 251, 227, 42, 246, 249, 128, 182, 40, 104, 38, 226, 159, 47, 47, 206, 222, 210, 12, 93, 5, 182, 136, 218, 24, 117, 168, 151, 68, 223, 209, 159, 37, 201, 48, 121, 113, 249, 104, 1, 115, 7, 222, 219, 193, 184, 84, 0, 3, 95, 136, 200, 115, 202, 133, 69, 56, 106, 195, 11, 218, 172, 75, 164, 177, 19, 249, 80, 241, 57, 217, 188, 69, 23, 42, 75, 124, 196, 122, 38, 100, 231, 232, 122, 249, 14, 62, 95, 94, 30, 200, 103, 178, 248, 248, 109, 14, 162, 46, 22, 151, 145, 236, 250, 240, 14, 4, 243, 46, 95, 182, 101, 71, 98, 225, 180, 132, 234, 26, 51, 128, 203, 183, 23, 15, 67, 16, 12, 48, 32, 212, 135, 208, 57, 247, 135, 55, 102, 147, 124, 226, 135, 133, 31, 53, 252, 168, 227, 71, 3, 63, 72, 106, 11, 63, 218, 248, 209, 33, 153, 105, 65, 82, 198, 36, 133, 76, 82, 202, 36, 197, 76, 40, 103, 148, 201, 220, 26, 57, 237, 40, 232, 15, 217, 47, 194, 188, 118, 127, 220, 99, 75, 97, 184, 181, 243, 149, 214, 78, 42, 147, 110, 41, 98, 5, 73, 19, 232, 235, 75, 82, 133, 152, 7, 236, 254, 138, 255, 110, 105, 149, 99, 163, 79, 191, 77, 246, 109, 177, 239, 90, 159, 207, 113, 250, 33, 125, 36, 27, 117, 88, 234, 59, 242, 204, 8, 135, 46, 12, 220, 134, 191, 156, 33, 75, 4, 145, 195, 243, 150, 201, 83, 161, 63, 232, 111, 25, 203, 216, 249, 41, 133, 101, 110, 145, 202, 110, 255, 145, 89, 145, 176, 239, 226, 20, 135, 11, 226, 161, 137, 1, 52, 192, 155, 91, 232, 173, 67, 182, 164, 9, 186, 93, 163, 55, 2, 197, 117, 224, 219, 217, 155, 245, 118, 118, 28, 189, 4, 56, 85, 7, 99, 219, 63, 132, 126, 255, 32, 68, 229, 218, 131, 126, 241, 237, 248, 198, 219, 217, 185, 237, 7, 221, 96, 207, 50, 234, 237, 183, 37, 246, 194, 236, 88, 47, 193, 254, 254, 126, 179, 204, 95, 88, 237, 151, 102, 109, 59, 208, 33, 103, 163, 97, 117, 154, 47, 144, 222, 111, 180, 106, 245, 122, 84, 200, 178, 234, 164, 144, 105, 137, 165, 8, 152, 237, 102, 45, 13, 9, 144, 106, 54, 26, 181, 230, 78, 169, 100, 26, 22, 190, 218, 219, 51, 141, 23, 242, 44, 97, 139, 20, 232, 188, 188, 85, 55, 104, 45, 237, 100, 45, 166, 149, 168, 38, 179, 234, 94, 216, 31, 47, 57, 195, 246, 155, 117, 104, 190, 97, 63, 101, 11, 67, 189, 74, 186, 250, 146, 78, 251, 10, 27, 25, 61, 194, 110, 57, 102, 111, 179, 78, 248, 75, 68, 177, 232, 135, 55, 206, 237, 203, 139, 209, 179, 225, 187, 223, 177, 126, 95, 148, 71, 248, 212, 168, 255, 190, 88, 242, 78, 17, 196, 93, 230, 202, 202, 42, 26, 177, 159, 222, 63, 156, 167, 15, 246, 176, 111, 211, 159, 36, 254, 0, 74, 65, 127, 5, 192, 15, 103, 120, 230, 76, 61, 255, 169, 239, 3, 184, 184, 219, 165, 96, 36, 179, 128, 170, 34, 169, 93, 202, 174, 21, 120, 146, 102, 79, 200, 4, 191, 134, 248, 129, 155, 69, 137, 245, 169, 202, 133, 125, 31, 61, 118, 36, 152, 169, 34, 118, 2, 160, 125, 160, 118, 134, 172, 117, 66, 211, 2, 46, 137, 109, 181, 55, 6, 53, 140, 113, 162, 186, 143, 60, 151, 91, 130, 135, 230, 199, 67, 243, 83, 38, 159, 248, 140, 31, 22, 126, 212, 240, 163, 142, 31, 13, 252, 32, 169, 45, 252, 104, 227, 71, 135, 100, 166, 197, 73, 25, 147, 20, 50, 73, 41, 147, 20, 35, 70, 72, 47, 7, 58, 177, 50, 72, 144, 43, 180, 94, 68, 113, 123, 219, 165, 242, 28, 235, 32, 93, 73, 3, 199, 172, 189, 140, 110, 92, 84, 36, 167, 235, 176, 246, 194, 94, 96, 123, 113, 72, 123, 225, 47, 168, 170, 57, 58, 228, 100, 237, 197, 137, 218, 11, 203, 131, 237, 197, 161, 237, 69, 40, 229, 112, 165, 77, 65, 2, 164, 164, 246, 226, 100, 183, 23, 192, 151, 151, 199, 246, 226, 208, 246, 146, 168, 133, 182, 151, 117, 170, 166, 230, 249, 149, 60, 243, 110, 92, 128, 107, 221, 190, 244, 157, 189, 189, 193, 77, 109, 27, 97, 71, 12, 140, 83, 75, 17, 19, 245, 56, 95, 89, 76, 231, 232, 196, 201, 74, 246, 10, 69, 98, 22, 231, 192, 228, 100, 111, 82, 237, 134, 178, 16, 81, 138, 228, 177, 2, 37, 34, 158, 31, 139, 182, 208, 205, 174, 16, 38, 211, 128, 240, 102, 124, 187, 150, 240, 227, 138, 177, 72, 92, 37, 237, 64, 49, 28, 137, 189, 33, 9, 73, 246, 221, 114, 220, 85, 238, 244, 221, 74, 12, 180, 236, 238, 247, 155, 32, 65, 161, 87, 117, 43, 205, 122, 57, 50, 20, 37, 189, 44, 25, 13, 67, 239, 138, 121, 151, 204, 241, 137, 225, 239, 215, 173, 78, 189, 211, 108, 89, 157, 70, 100, 112, 222, 209, 138, 227, 76, 187, 81, 166, 230, 222, 158, 81, 78, 118, 228, 228, 241, 239, 113, 30, 138, 195, 178, 44, 154, 96, 110, 76, 251, 66, 24, 1, 189, 246, 132, 17, 126, 78, 248, 2, 91, 6, 139, 47, 136, 198, 211, 239, 167, 153, 214, 11, 111, 124, 198, 224, 5, 176, 214, 191, 45, 251, 160, 239, 77, 217, 136, 190, 188, 72, 140, 66, 115, 26, 18, 115, 74, 62, 241, 25, 63, 44, 252, 168, 225, 71, 29, 63, 26, 248, 65, 82, 91, 248, 209, 198, 143, 14, 201, 76, 139, 147, 50, 38, 41, 100, 146, 82, 38, 41, 198, 204, 41, 251, 25, 177, 105, 111, 175, 86, 166, 137, 2, 175, 225, 229, 139, 32, 18, 32, 163, 35, 138, 116, 41, 179, 18, 95, 138, 108, 36, 12, 42, 131, 95, 139, 125, 79, 25, 3, 19, 2, 179, 122, 177, 251, 244, 214, 239, 151, 74, 248, 23, 146, 191, 25, 144, 95, 105, 182, 141, 118, 171, 217, 169, 181, 160, 21, 180, 94, 66, 172, 186, 161, 87, 172, 150, 217, 170, 213, 218, 173, 14, 72, 91, 255, 29, 154, 114, 9, 255, 226, 215, 191, 131, 166, 151, 240, 175, 2, 47, 172, 70, 187, 110, 118, 234, 191, 91, 134, 81, 175, 153, 109, 163, 101, 110, 135, 250, 206, 12, 120, 89, 49, 205, 86, 187, 102, 180, 12, 108, 201, 166, 245, 66, 90, 128, 161, 239, 132, 8, 118, 91, 132, 23, 234, 88, 194, 194, 18, 86, 179, 14, 133, 90, 13, 44, 210, 162, 237, 188, 161, 239, 184, 180, 136, 203, 114, 214, 32, 103, 205, 108, 90, 141, 142, 101, 116, 32, 167, 101, 189, 160, 244, 77, 0, 14, 54, 212, 232, 150, 152, 194, 140, 13, 174, 44, 99, 179, 236, 112, 231, 180, 76, 24, 177, 195, 57, 177, 67, 104, 97, 14, 171, 254, 187, 15, 67, 149, 223, 93, 82, 141, 192, 160, 166, 200, 160, 29, 95, 96, 12, 20, 247, 25, 67, 224, 209, 249, 61, 220, 134, 223, 142, 206, 88, 80, 107, 119, 26, 205, 122, 163, 221, 84, 178, 32, 252, 221, 103, 148, 239, 52, 141, 166, 105, 52, 218, 102, 103, 37, 225, 70, 189, 222, 176, 26, 181, 154, 145, 38, 92, 79, 147, 230, 138, 4, 213, 161, 120, 171, 89, 55, 219, 237, 78, 235, 53, 4, 53, 110, 119, 76, 60, 239, 171, 109, 212, 173, 124, 138, 154, 80, 83, 29, 148, 163, 102, 214, 234, 102, 46, 73, 173, 219, 74, 189, 209, 50, 26, 157, 118, 45, 77, 208, 10, 122, 218, 128, 79, 171, 101, 24, 181, 70, 221, 124, 149, 132, 58, 128, 102, 7, 21, 184, 94, 55, 91, 185, 4, 65, 107, 175, 212, 45, 131, 116, 39, 217, 196, 152, 168, 245, 157, 142, 81, 55, 0, 33, 107, 99, 122, 192, 140, 236, 64, 19, 170, 55, 141, 90, 179, 109, 189, 74, 229, 64, 67, 234, 6, 240, 220, 52, 204, 124, 122, 80, 23, 26, 6, 72, 211, 178, 58, 70, 62, 81, 68, 236, 181, 102, 163, 214, 168, 89, 157, 60, 162, 56, 74, 128, 205, 118, 76, 34, 80, 39, 181, 9, 179, 217, 104, 117, 154, 13, 19, 107, 109, 80, 2, 91, 156, 192, 88, 123, 140, 102, 167, 97, 152, 205, 26, 178, 161, 67, 169, 168, 49, 42, 144, 224, 136, 19, 33, 50, 80, 224, 255, 78, 179, 94, 3, 195, 210, 50, 137, 164, 234, 220, 151, 160, 68, 197, 13, 187, 214, 130, 166, 217, 170, 25, 68, 72, 6, 165, 199, 122, 5, 61, 141, 219, 74, 203, 48, 27, 208, 194, 59, 102, 38, 61, 160, 60, 59, 181, 54, 80, 99, 16, 37, 95, 159, 28, 128, 222, 108, 26, 104, 17, 107, 141, 108, 114, 234, 40, 115, 240, 182, 90, 237, 122, 251, 59, 201, 233, 220, 238, 52, 154, 237, 122, 29, 152, 216, 206, 38, 7, 117, 199, 48, 59, 109, 80, 83, 162, 59, 107, 19, 132, 246, 171, 221, 170, 53, 107, 157, 166, 153, 77, 15, 54, 107, 144, 124, 163, 6, 10, 106, 126, 39, 65, 216, 32, 160, 117, 215, 155, 109, 179, 222, 108, 101, 146, 4, 125, 79, 195, 132, 134, 3, 44, 220, 132, 158, 22, 26, 32, 108, 22, 109, 48, 118, 217, 4, 153, 216, 181, 117, 44, 16, 101, 11, 92, 240, 60, 138, 198, 253, 136, 40, 24, 254, 35, 17, 191, 71, 116, 5, 0, 141, 106, 28, 160, 9, 26, 7, 112, 234, 148, 152, 54, 35, 134, 50, 175, 98, 65, 155, 110, 180, 128, 102, 130, 146, 73, 137, 49, 35, 98, 4, 51, 50, 6, 242, 89, 179, 49, 219, 181, 142, 81, 51, 26, 196, 108, 153, 77, 74, 71, 147, 209, 193, 165, 14, 164, 26, 157, 70, 3, 109, 173, 85, 35, 36, 116, 94, 65, 1, 218, 0, 4, 4, 189, 119, 211, 80, 83, 81, 71, 147, 211, 178, 218, 29, 80, 252, 117, 169, 104, 33, 216, 70, 189, 211, 162, 70, 67, 73, 131, 129, 154, 219, 1, 97, 25, 205, 186, 241, 157, 84, 212, 192, 214, 180, 1, 203, 142, 217, 170, 171, 169, 64, 59, 211, 104, 67, 195, 180, 44, 107, 77, 34, 64, 93, 33, 119, 195, 50, 59, 173, 78, 6, 17, 205, 219, 157, 86, 211, 176, 58, 102, 187, 243, 125, 20, 64, 239, 7, 92, 168, 53, 235, 245, 118, 75, 77, 0, 42, 110, 221, 50, 219, 102, 163, 77, 13, 208, 58, 202, 4, 221, 5, 72, 183, 85, 7, 42, 140, 12, 18, 0, 108, 167, 3, 62, 76, 27, 186, 129, 28, 26, 226, 246, 45, 182, 238, 146, 255, 242, 175, 200, 142, 131, 21, 106, 214, 12, 176, 88, 0, 166, 73, 9, 104, 50, 2, 94, 254, 229, 68, 141, 20, 252, 202, 118, 199, 172, 155, 13, 58, 14, 37, 68, 88, 156, 8, 177, 113, 151, 220, 151, 127, 9, 86, 174, 142, 118, 168, 222, 49, 72, 185, 6, 37, 164, 197, 8, 121, 249, 87, 200, 187, 0, 104, 109, 53, 52, 193, 72, 139, 73, 155, 182, 185, 41, 49, 164, 243, 7, 103, 166, 14, 109, 187, 101, 102, 147, 67, 108, 40, 140, 181, 218, 96, 78, 154, 27, 144, 67, 84, 191, 97, 54, 172, 90, 14, 45, 38, 90, 15, 32, 216, 2, 181, 238, 124, 15, 53, 104, 195, 193, 210, 131, 255, 87, 107, 116, 178, 137, 193, 30, 14, 218, 34, 140, 20, 136, 4, 215, 164, 5, 253, 131, 70, 19, 123, 32, 232, 85, 243, 168, 129, 38, 106, 130, 161, 49, 27, 102, 179, 254, 93, 228, 16, 93, 104, 0, 239, 96, 56, 147, 67, 13, 25, 244, 128, 249, 53, 161, 39, 233, 172, 79, 15, 72, 190, 5, 220, 106, 183, 44, 194, 171, 44, 114, 160, 189, 214, 64, 207, 64, 63, 104, 171, 73, 16, 35, 12, 245, 74, 81, 92, 126, 39, 26, 162, 213, 162, 60, 99, 179, 239, 75, 131, 188, 50, 15, 219, 59, 194, 136, 46, 126, 95, 235, 187, 59, 60, 123, 91, 174, 9, 103, 232, 187, 37, 121, 22, 192, 32, 180, 150, 229, 41, 1, 147, 112, 170, 44, 207, 15, 88, 2, 226, 124, 178, 96, 92, 163, 68, 39, 6, 189, 206, 55, 113, 204, 43, 133, 9, 74, 186, 24, 36, 200, 24, 243, 69, 35, 188, 104, 186, 236, 6, 69, 88, 223, 70, 115, 53, 2, 61, 220, 14, 241, 59, 164, 129, 37, 250, 18, 127, 180, 133, 103, 203, 16, 126, 152, 77, 49, 69, 202, 198, 129, 250, 114, 5, 62, 127, 23, 85, 224, 11, 21, 248, 98, 5, 190, 88, 129, 47, 86, 224, 139, 21, 56, 114, 5, 14, 127, 23, 85, 224, 8, 21, 56, 98, 5, 142, 88, 129, 35, 86, 224, 136, 21, 184, 114, 5, 46, 127, 23, 85, 224, 10, 21, 184, 98, 5, 174, 88, 129, 43, 86, 224, 70, 21, 200, 34, 230, 147, 227, 253, 132, 220, 165, 76, 116, 198, 239, 199, 170, 194, 141, 213, 0, 233, 151, 169, 180, 225, 185, 204, 196, 203, 31, 1, 89, 124, 196, 92, 126, 217, 143, 114, 249, 113, 46, 95, 206, 229, 148, 157, 40, 151, 19, 231, 114, 228, 92, 110, 217, 141, 114, 185, 113, 46, 55, 202, 149, 224, 15, 153, 107, 233, 167, 153, 145, 206, 68, 167, 4, 87, 51, 41, 57, 135, 8, 93, 116, 217, 79, 77, 13, 198, 19, 188, 62, 137, 152, 113, 206, 146, 104, 25, 99, 174, 79, 162, 102, 60, 188, 66, 162, 103, 148, 197, 229, 80, 38, 130, 206, 120, 244, 51, 80, 150, 179, 146, 133, 35, 34, 21, 124, 150, 133, 69, 187, 250, 133, 66, 153, 133, 32, 217, 60, 20, 78, 186, 244, 198, 96, 63, 123, 122, 216, 15, 110, 198, 24, 242, 245, 249, 131, 195, 31, 192, 206, 207, 105, 67, 189, 221, 153, 223, 52, 107, 48, 40, 70, 231, 135, 180, 86, 157, 191, 2, 107, 197, 163, 237, 236, 149, 115, 203, 249, 64, 96, 39, 225, 32, 140, 237, 38, 116, 56, 133, 126, 191, 176, 44, 79, 99, 74, 232, 204, 153, 248, 38, 43, 28, 170, 138, 152, 198, 211, 98, 186, 48, 237, 197, 68, 202, 166, 192, 76, 81, 235, 25, 47, 122, 226, 132, 90, 106, 134, 76, 158, 96, 19, 103, 215, 18, 41, 122, 121, 5, 82, 203, 37, 169, 252, 34, 21, 146, 236, 31, 240, 213, 3, 1, 153, 63, 252, 12, 192, 0, 56, 155, 211, 23, 179, 139, 139, 45, 150, 144, 35, 57, 95, 23, 175, 199, 224, 165, 75, 194, 130, 140, 101, 52, 251, 230, 131, 244, 253, 189, 39, 126, 118, 197, 206, 78, 180, 100, 229, 233, 198, 191, 237, 225, 236, 35, 32, 229, 232, 81, 24, 124, 9, 108, 186, 168, 78, 135, 141, 254, 69, 153, 124, 87, 199, 83, 123, 144, 166, 228, 29, 167, 36, 141, 125, 152, 88, 77, 16, 234, 74, 10, 132, 85, 7, 17, 13, 190, 176, 234, 96, 51, 34, 222, 37, 136, 40, 207, 222, 202, 107, 203, 250, 23, 221, 146, 195, 8, 243, 248, 98, 178, 82, 41, 205, 243, 139, 165, 174, 235, 75, 190, 224, 49, 90, 110, 24, 159, 198, 193, 215, 56, 178, 53, 133, 201, 165, 134, 23, 215, 209, 246, 127, 92, 175, 232, 133, 54, 91, 236, 216, 54, 122, 226, 219, 51, 251, 219, 41, 33, 8, 146, 76, 195, 170, 75, 137, 39, 193, 167, 64, 94, 227, 200, 143, 51, 57, 164, 171, 64, 157, 225, 225, 120, 49, 251, 114, 49, 26, 5, 100, 209, 171, 12, 251, 144, 174, 150, 205, 203, 130, 71, 25, 227, 97, 244, 88, 57, 238, 178, 22, 78, 206, 129, 212, 79, 193, 49, 158, 32, 128, 56, 196, 235, 66, 15, 62, 94, 191, 239, 106, 197, 3, 97, 239, 227, 229, 241, 225, 197, 249, 249, 241, 225, 245, 201, 197, 57, 36, 93, 10, 73, 87, 215, 7, 151, 215, 159, 201, 66, 208, 127, 94, 93, 31, 159, 65, 242, 71, 69, 242, 229, 217, 167, 131, 203, 99, 72, 92, 8, 137, 159, 46, 79, 174, 241, 221, 39, 225, 29, 176, 28, 222, 156, 195, 155, 248, 213, 229, 229, 197, 37, 188, 60, 22, 225, 126, 60, 60, 36, 231, 205, 22, 175, 132, 183, 136, 250, 231, 56, 201, 22, 146, 206, 143, 255, 227, 250, 243, 225, 251, 143, 231, 255, 128, 132, 67, 33, 225, 195, 201, 249, 47, 240, 234, 67, 241, 141, 184, 152, 55, 90, 110, 33, 222, 51, 0, 90, 130, 203, 100, 203, 218, 99, 112, 233, 176, 3, 252, 33, 79, 122, 81, 250, 220, 246, 3, 231, 220, 158, 226, 210, 110, 178, 227, 136, 44, 128, 197, 7, 109, 71, 43, 165, 14, 186, 122, 171, 21, 241, 84, 139, 98, 101, 164, 56, 132, 132, 174, 47, 205, 62, 214, 40, 170, 171, 84, 148, 111, 78, 144, 22, 247, 71, 34, 255, 64, 46, 252, 88, 27, 28, 57, 185, 94, 13, 233, 148, 222, 13, 178, 54, 40, 122, 4, 127, 81, 79, 147, 136, 231, 70, 95, 8, 0, 85, 43, 149, 57, 234, 153, 103, 66, 201, 75, 162, 215, 194, 40, 113, 203, 8, 160, 150, 127, 226, 148, 128, 11, 197, 117, 189, 157, 61, 201, 236, 244, 118, 68, 104, 169, 184, 89, 224, 239, 69, 245, 74, 114, 202, 25, 106, 38, 37, 222, 204, 29, 31, 119, 167, 170, 89, 164, 172, 231, 12, 55, 126, 76, 221, 89, 9, 76, 64, 89, 139, 202, 175, 172, 28, 175, 38, 12, 198, 80, 57, 217, 130, 224, 251, 27, 84, 89, 196, 147, 167, 147, 108, 3, 206, 48, 115, 84, 42, 229, 30, 6, 3, 117, 65, 155, 192, 79, 180, 38, 244, 54, 17, 126, 132, 248, 26, 103, 144, 172, 58, 238, 165, 172, 53, 27, 70, 198, 2, 126, 92, 129, 207, 154, 57, 30, 18, 193, 108, 180, 234, 32, 40, 111, 130, 91, 179, 239, 75, 5, 114, 84, 56, 184, 239, 218, 167, 43, 13, 122, 5, 141, 106, 85, 181, 144, 168, 86, 82, 242, 146, 122, 251, 4, 89, 235, 223, 167, 77, 190, 74, 22, 243, 147, 85, 241, 201, 253, 180, 128, 213, 149, 55, 248, 66, 204, 61, 118, 190, 159, 156, 59, 250, 187, 84, 124, 196, 245, 236, 120, 156, 76, 122, 33, 126, 137, 136, 188, 139, 137, 188, 183, 194, 61, 43, 143, 65, 146, 135, 228, 220, 44, 92, 10, 164, 62, 198, 195, 153, 13, 207, 157, 111, 180, 215, 1, 4, 236, 224, 105, 54, 200, 220, 92, 128, 252, 84, 247, 84, 251, 108, 219, 39, 238, 163, 207, 219, 160, 30, 241, 249, 96, 50, 33, 252, 29, 32, 144, 0, 241, 8, 83, 76, 22, 244, 146, 114, 132, 238, 198, 16, 186, 186, 42, 116, 48, 63, 234, 104, 134, 1, 99, 1, 165, 99, 226, 14, 28, 53, 173, 229, 140, 206, 122, 71, 114, 16, 244, 172, 243, 29, 232, 208, 1, 89, 253, 104, 187, 172, 86, 113, 240, 80, 82, 109, 209, 164, 69, 199, 14, 51, 27, 137, 69, 145, 55, 34, 71, 72, 55, 44, 46, 77, 49, 244, 219, 108, 144, 208, 16, 239, 112, 213, 125, 26, 40, 173, 140, 204, 229, 51, 151, 103, 135, 225, 46, 188, 83, 82, 73, 33, 226, 217, 54, 12, 72, 89, 51, 86, 101, 76, 84, 78, 43, 210, 203, 154, 153, 133, 58, 87, 164, 63, 174, 64, 37, 176, 189, 70, 202, 164, 253, 244, 172, 20, 208, 178, 90, 253, 233, 57, 178, 158, 235, 200, 176, 44, 232, 180, 242, 40, 170, 132, 98, 114, 138, 212, 57, 85, 213, 245, 165, 250, 122, 25, 187, 121, 98, 67, 147, 129, 246, 191, 161, 63, 168, 107, 187, 2, 190, 9, 43, 153, 238, 243, 24, 226, 222, 12, 183, 210, 229, 108, 47, 21, 153, 93, 68, 38, 63, 58, 119, 1, 181, 87, 204, 105, 2, 17, 42, 183, 79, 147, 253, 79, 249, 199, 242, 172, 217, 145, 68, 7, 188, 36, 252, 223, 188, 99, 3, 178, 189, 186, 149, 182, 9, 169, 116, 3, 176, 32, 113, 249, 194, 138, 131, 10, 114, 76, 148, 232, 110, 163, 195, 104, 135, 222, 157, 200, 23, 190, 107, 234, 157, 29, 184, 3, 173, 136, 167, 202, 233, 121, 231, 34, 100, 158, 206, 183, 38, 62, 232, 86, 255, 16, 60, 212, 219, 124, 203, 90, 205, 48, 86, 31, 18, 150, 163, 144, 252, 10, 142, 190, 176, 23, 224, 129, 56, 57, 234, 30, 105, 139, 164, 226, 206, 86, 250, 84, 37, 135, 98, 173, 211, 9, 161, 160, 105, 97, 16, 119, 180, 3, 169, 172, 185, 247, 51, 143, 108, 112, 41, 124, 127, 231, 66, 250, 223, 7, 122, 208, 34, 218, 169, 190, 22, 35, 9, 98, 224, 135, 108, 42, 139, 176, 253, 164, 66, 241, 148, 7, 193, 153, 32, 228, 239, 107, 82, 15, 137, 227, 173, 44, 110, 16, 199, 64, 174, 65, 216, 116, 108, 174, 236, 143, 7, 19, 47, 112, 148, 71, 194, 197, 167, 94, 102, 98, 198, 134, 118, 171, 112, 75, 28, 9, 247, 10, 100, 232, 150, 113, 230, 254, 190, 22, 219, 120, 200, 153, 133, 112, 206, 72, 95, 105, 182, 123, 25, 230, 80, 240, 200, 214, 65, 150, 235, 149, 140, 174, 56, 120, 206, 59, 6, 138, 198, 74, 86, 31, 107, 225, 139, 190, 7, 58, 212, 151, 142, 210, 245, 149, 91, 9, 113, 33, 226, 157, 207, 107, 156, 96, 192, 60, 29, 59, 192, 129, 7, 110, 13, 77, 110, 0, 161, 48, 125, 39, 88, 76, 194, 85, 199, 199, 112, 31, 199, 247, 23, 115, 232, 166, 222, 83, 168, 5, 163, 0, 13, 15, 171, 88, 67, 215, 149, 118, 227, 23, 186, 15, 21, 220, 38, 220, 149, 138, 7, 53, 1, 235, 187, 26, 7, 187, 2, 212, 238, 174, 12, 237, 144, 227, 71, 10, 83, 48, 18, 206, 155, 245, 61, 170, 136, 132, 212, 236, 164, 32, 14, 12, 202, 84, 137, 60, 0, 164, 175, 77, 210, 127, 53, 22, 235, 114, 100, 185, 90, 33, 241, 235, 32, 16, 167, 12, 208, 111, 202, 128, 185, 178, 187, 77, 16, 254, 67, 233, 206, 58, 74, 227, 245, 157, 43, 49, 146, 82, 215, 154, 213, 173, 18, 251, 187, 126, 55, 138, 185, 169, 238, 210, 130, 171, 204, 112, 94, 174, 13, 199, 110, 146, 123, 202, 124, 83, 232, 208, 9, 169, 195, 170, 22, 249, 129, 218, 163, 11, 163, 206, 59, 71, 179, 195, 208, 153, 146, 22, 231, 206, 200, 113, 173, 37, 33, 184, 186, 75, 156, 75, 50, 188, 6, 99, 12, 69, 135, 65, 181, 184, 182, 75, 223, 207, 236, 6, 210, 16, 82, 158, 175, 50, 60, 73, 206, 155, 40, 11, 113, 159, 134, 129, 145, 31, 41, 28, 44, 252, 128, 177, 64, 181, 166, 175, 240, 255, 147, 12, 22, 250, 20, 86, 239, 122, 65, 146, 247, 215, 215, 31, 242, 194, 36, 185, 129, 144, 55, 170, 163, 203, 84, 10, 151, 31, 108, 17, 79, 168, 247, 167, 71, 54, 137, 112, 145, 94, 138, 253, 44, 169, 15, 77, 36, 105, 236, 236, 152, 82, 145, 142, 180, 138, 116, 200, 151, 93, 69, 116, 60, 3, 118, 103, 83, 236, 56, 51, 123, 52, 222, 111, 242, 236, 249, 167, 209, 202, 210, 33, 201, 242, 33, 39, 197, 93, 122, 137, 237, 46, 197, 148, 132, 133, 148, 193, 231, 17, 123, 38, 65, 104, 194, 237, 167, 0, 212, 157, 156, 102, 130, 40, 99, 158, 183, 56, 167, 130, 16, 240, 119, 23, 143, 126, 201, 234, 199, 209, 23, 101, 65, 70, 58, 29, 145, 139, 49, 83, 3, 111, 54, 247, 189, 123, 159, 158, 15, 91, 226, 207, 43, 122, 127, 119, 20, 229, 100, 179, 70, 120, 74, 226, 130, 92, 192, 168, 231, 59, 13, 56, 177, 52, 181, 241, 164, 243, 8, 2, 185, 23, 174, 183, 178, 20, 63, 162, 68, 40, 73, 34, 219, 195, 94, 254, 97, 112, 49, 75, 248, 16, 138, 13, 194, 119, 1, 143, 117, 78, 128, 139, 245, 153, 135, 112, 55, 30, 105, 173, 144, 5, 233, 141, 184, 158, 235, 43, 50, 111, 120, 102, 240, 247, 156, 31, 252, 93, 103, 9, 231, 246, 65, 196, 26, 177, 171, 165, 163, 131, 106, 41, 52, 218, 51, 9, 224, 245, 252, 232, 193, 138, 115, 181, 215, 26, 85, 40, 140, 171, 76, 159, 102, 172, 130, 15, 198, 248, 152, 13, 131, 210, 55, 11, 100, 35, 3, 46, 229, 98, 50, 156, 21, 121, 212, 159, 153, 104, 100, 76, 153, 156, 204, 115, 231, 217, 254, 176, 24, 104, 113, 128, 67, 27, 217, 96, 42, 134, 213, 194, 247, 70, 30, 94, 139, 178, 120, 8, 60, 53, 35, 60, 170, 71, 17, 167, 18, 44, 165, 142, 137, 198, 113, 191, 192, 86, 254, 170, 120, 92, 212, 37, 247, 254, 53, 237, 107, 13, 255, 99, 245, 24, 234, 117, 227, 167, 77, 199, 78, 63, 108, 220, 244, 131, 198, 76, 63, 104, 188, 244, 35, 199, 74, 241, 209, 74, 171, 43, 141, 243, 174, 3, 125, 153, 47, 196, 181, 199, 27, 105, 69, 204, 105, 112, 49, 138, 171, 163, 109, 43, 188, 63, 97, 198, 140, 248, 104, 228, 50, 11, 212, 213, 197, 68, 232, 67, 105, 154, 116, 98, 150, 124, 128, 20, 91, 69, 145, 92, 92, 113, 122, 241, 203, 47, 39, 231, 191, 136, 11, 44, 216, 165, 189, 108, 145, 69, 61, 10, 230, 114, 72, 66, 17, 213, 89, 234, 39, 179, 145, 151, 117, 148, 58, 222, 177, 11, 238, 146, 16, 205, 43, 254, 114, 76, 78, 204, 250, 1, 231, 167, 39, 78, 182, 22, 47, 194, 225, 64, 161, 190, 157, 98, 230, 236, 207, 140, 46, 35, 224, 135, 88, 103, 101, 195, 155, 118, 251, 209, 9, 214, 89, 185, 22, 48, 188, 185, 194, 91, 112, 163, 188, 86, 102, 94, 114, 91, 238, 53, 185, 44, 151, 103, 174, 101, 159, 65, 238, 59, 120, 92, 220, 60, 202, 90, 191, 205, 158, 206, 114, 39, 67, 28, 123, 68, 121, 155, 183, 138, 214, 16, 205, 225, 147, 219, 49, 81, 181, 232, 242, 137, 162, 86, 209, 200, 96, 233, 94, 113, 128, 102, 230, 221, 79, 236, 114, 99, 176, 240, 226, 225, 141, 234, 35, 103, 243, 129, 0, 163, 19, 80, 224, 205, 166, 64, 226, 139, 140, 19, 176, 34, 1, 189, 14, 34, 241, 97, 19, 32, 99, 57, 110, 10, 211, 183, 167, 9, 88, 92, 204, 155, 66, 34, 50, 79, 192, 138, 244, 64, 33, 124, 245, 66, 171, 196, 88, 154, 173, 158, 162, 58, 212, 194, 83, 219, 181, 130, 89, 80, 14, 187, 197, 85, 88, 100, 17, 200, 201, 44, 44, 209, 130, 237, 91, 29, 123, 255, 120, 109, 86, 114, 213, 9, 181, 56, 137, 82, 29, 90, 170, 173, 112, 54, 85, 182, 45, 131, 182, 132, 157, 147, 23, 49, 136, 246, 46, 81, 187, 105, 208, 234, 235, 202, 57, 45, 133, 73, 92, 203, 39, 99, 119, 190, 136, 110, 85, 232, 63, 161, 79, 21, 122, 218, 200, 9, 7, 99, 114, 29, 57, 61, 173, 17, 79, 73, 196, 91, 227, 161, 179, 42, 234, 121, 93, 135, 250, 226, 38, 133, 25, 118, 102, 15, 175, 183, 194, 209, 204, 206, 10, 55, 124, 227, 57, 126, 192, 10, 143, 191, 204, 187, 87, 14, 175, 144, 146, 174, 17, 76, 117, 201, 20, 198, 234, 203, 51, 162, 42, 179, 174, 115, 248, 207, 89, 118, 71, 129, 55, 58, 29, 204, 134, 191, 98, 79, 156, 117, 97, 4, 189, 103, 241, 31, 120, 211, 83, 134, 175, 45, 92, 176, 67, 179, 169, 166, 155, 196, 11, 36, 8, 166, 120, 202, 22, 195, 58, 111, 234, 128, 84, 157, 59, 115, 32, 214, 76, 64, 191, 50, 196, 42, 49, 131, 93, 19, 1, 239, 186, 66, 13, 101, 141, 56, 45, 236, 14, 135, 165, 190, 209, 33, 196, 156, 137, 91, 228, 97, 189, 107, 30, 98, 166, 1, 38, 4, 51, 228, 155, 132, 105, 230, 68, 145, 67, 10, 65, 133, 188, 40, 94, 224, 213, 203, 25, 61, 112, 135, 44, 202, 207, 174, 27, 203, 62, 178, 28, 225, 131, 77, 33, 213, 252, 215, 220, 242, 129, 213, 0, 120, 122, 40, 7, 61, 104, 183, 240, 159, 179, 130, 174, 231, 11, 146, 82, 177, 198, 40, 34, 247, 114, 17, 23, 199, 68, 252, 46, 54, 240, 35, 8, 255, 190, 251, 90, 140, 156, 59, 41, 196, 115, 170, 201, 234, 56, 172, 159, 95, 194, 170, 225, 197, 20, 61, 141, 220, 58, 81, 113, 241, 218, 9, 80, 77, 114, 233, 68, 79, 251, 115, 17, 132, 238, 232, 169, 194, 14, 162, 237, 210, 30, 188, 114, 231, 132, 143, 142, 51, 235, 229, 223, 74, 49, 177, 239, 228, 245, 157, 9, 132, 73, 122, 230, 205, 93, 152, 24, 35, 43, 93, 34, 171, 153, 244, 26, 137, 236, 114, 35, 50, 132, 119, 135, 121, 121, 68, 7, 32, 83, 131, 179, 78, 248, 38, 32, 242, 79, 238, 79, 173, 150, 77, 144, 31, 93, 245, 167, 212, 79, 50, 92, 9, 156, 240, 32, 4, 69, 187, 91, 132, 78, 169, 136, 23, 0, 241, 181, 135, 24, 83, 245, 70, 163, 252, 226, 137, 235, 79, 164, 251, 5, 115, 42, 229, 60, 71, 189, 0, 94, 247, 138, 121, 185, 121, 227, 78, 92, 33, 152, 206, 72, 148, 62, 75, 34, 89, 108, 38, 69, 179, 216, 204, 251, 178, 245, 79, 80, 95, 230, 174, 243, 57, 35, 203, 247, 209, 119, 163, 11, 249, 113, 34, 29, 23, 233, 253, 250, 249, 215, 131, 203, 204, 121, 104, 85, 222, 170, 55, 59, 36, 113, 200, 210, 122, 72, 40, 175, 242, 203, 240, 77, 226, 43, 247, 190, 195, 63, 17, 98, 37, 246, 42, 159, 130, 86, 88, 161, 23, 4, 6, 149, 28, 51, 67, 97, 173, 246, 45, 196, 218, 55, 115, 47, 18, 157, 215, 192, 198, 110, 139, 1, 89, 21, 230, 133, 204, 235, 221, 188, 146, 223, 161, 228, 88, 119, 113, 96, 73, 110, 199, 126, 237, 29, 70, 248, 143, 230, 72, 182, 225, 129, 205, 239, 47, 90, 81, 46, 121, 245, 130, 116, 31, 228, 192, 94, 13, 64, 186, 89, 192, 206, 137, 149, 217, 169, 70, 72, 33, 232, 27, 119, 200, 185, 237, 240, 240, 227, 213, 245, 197, 217, 231, 3, 178, 20, 237, 42, 79, 134, 217, 165, 114, 219, 101, 198, 228, 180, 158, 61, 170, 73, 183, 213, 100, 238, 196, 189, 157, 201, 108, 140, 23, 98, 92, 40, 125, 243, 247, 167, 147, 203, 227, 211, 227, 171, 196, 229, 223, 159, 78, 126, 62, 249, 124, 117, 125, 112, 253, 241, 74, 218, 50, 243, 233, 244, 243, 201, 209, 233, 49, 75, 234, 106, 70, 89, 76, 58, 191, 248, 124, 117, 117, 114, 244, 249, 224, 215, 131, 147, 83, 176, 237, 82, 226, 213, 225, 193, 57, 158, 161, 253, 225, 244, 248, 250, 248, 168, 171, 89, 82, 42, 91, 7, 136, 9, 53, 85, 194, 231, 159, 1, 36, 166, 214, 85, 169, 192, 253, 207, 167, 23, 87, 215, 93, 173, 33, 37, 127, 186, 188, 56, 255, 229, 243, 135, 131, 171, 171, 79, 23, 151, 80, 184, 41, 165, 30, 157, 92, 9, 213, 182, 148, 128, 113, 203, 76, 189, 150, 160, 242, 250, 51, 89, 141, 128, 165, 26, 237, 55, 66, 64, 92, 98, 222, 101, 46, 231, 10, 68, 85, 112, 204, 73, 131, 243, 133, 60, 78, 22, 240, 135, 54, 243, 66, 122, 201, 95, 33, 151, 177, 133, 171, 129, 61, 139, 182, 17, 20, 178, 216, 92, 56, 228, 75, 84, 113, 212, 59, 3, 159, 203, 243, 191, 20, 114, 121, 207, 139, 196, 115, 34, 133, 124, 105, 136, 5, 38, 30, 158, 33, 158, 39, 157, 194, 39, 223, 3, 126, 204, 193, 36, 1, 46, 9, 216, 178, 176, 10, 71, 110, 16, 45, 177, 45, 100, 74, 46, 170, 127, 118, 95, 200, 150, 97, 225, 220, 35, 11, 118, 71, 238, 253, 194, 7, 112, 234, 253, 81, 172, 186, 107, 239, 147, 59, 114, 75, 65, 224, 14, 63, 248, 210, 148, 60, 185, 137, 56, 16, 125, 16, 58, 78, 79, 231, 36, 19, 247, 1, 113, 89, 230, 62, 200, 41, 44, 253, 113, 140, 30, 49, 153, 127, 26, 58, 129, 11, 88, 112, 137, 208, 104, 32, 184, 131, 222, 99, 53, 185, 206, 58, 130, 143, 195, 25, 10, 48, 179, 11, 98, 49, 143, 19, 118, 118, 63, 245, 154, 84, 150, 94, 21, 56, 88, 190, 201, 29, 143, 50, 90, 24, 165, 202, 224, 57, 223, 46, 70, 166, 50, 211, 68, 115, 153, 147, 238, 23, 95, 112, 234, 127, 122, 70, 168, 75, 5, 3, 8, 241, 4, 32, 16, 79, 1, 43, 137, 95, 139, 240, 156, 176, 127, 166, 231, 242, 8, 122, 80, 153, 64, 223, 201, 195, 125, 130, 83, 178, 102, 97, 182, 81, 44, 189, 187, 138, 28, 237, 39, 58, 55, 130, 139, 134, 69, 241, 74, 228, 248, 194, 123, 224, 16, 174, 96, 192, 33, 38, 174, 49, 138, 18, 144, 43, 100, 177, 14, 184, 59, 194, 245, 24, 41, 55, 142, 92, 41, 187, 113, 192, 159, 49, 86, 104, 226, 108, 237, 144, 70, 134, 189, 232, 56, 226, 228, 35, 200, 230, 222, 209, 208, 36, 221, 57, 228, 158, 27, 34, 227, 192, 3, 173, 198, 53, 235, 44, 254, 54, 136, 26, 106, 245, 53, 59, 157, 94, 21, 233, 99, 117, 210, 91, 169, 115, 174, 215, 221, 96, 37, 62, 136, 25, 205, 195, 149, 19, 34, 41, 202, 107, 236, 150, 101, 173, 145, 90, 5, 158, 121, 85, 18, 157, 17, 34, 19, 190, 8, 56, 227, 158, 144, 84, 181, 169, 141, 154, 147, 85, 123, 24, 101, 141, 140, 177, 155, 100, 236, 255, 75, 105, 40, 106, 139, 128, 105, 82, 99, 114, 90, 88, 124, 91, 15, 9, 44, 174, 70, 146, 180, 57, 105, 163, 230, 170, 75, 123, 249, 29, 176, 209, 52, 248, 170, 58, 104, 214, 10, 198, 244, 197, 170, 98, 8, 242, 37, 188, 98, 93, 178, 184, 104, 240, 49, 167, 29, 191, 114, 156, 149, 169, 20, 171, 4, 167, 218, 231, 185, 42, 160, 76, 155, 81, 65, 221, 140, 240, 150, 34, 164, 69, 136, 153, 147, 53, 20, 101, 13, 28, 16, 59, 192, 245, 38, 35, 32, 100, 204, 12, 61, 24, 3, 123, 54, 196, 242, 154, 125, 15, 98, 83, 46, 171, 80, 119, 66, 111, 178, 231, 27, 87, 15, 240, 88, 126, 176, 149, 7, 179, 225, 37, 124, 179, 200, 241, 155, 116, 216, 248, 138, 246, 103, 233, 184, 177, 16, 51, 62, 245, 188, 249, 85, 144, 140, 56, 16, 147, 137, 24, 176, 101, 90, 218, 190, 102, 41, 151, 237, 145, 60, 116, 39, 157, 165, 99, 64, 233, 216, 30, 140, 75, 65, 182, 101, 161, 81, 229, 43, 98, 234, 87, 134, 149, 57, 114, 216, 41, 191, 50, 174, 44, 48, 138, 69, 149, 241, 77, 55, 89, 3, 232, 40, 188, 239, 106, 193, 198, 97, 101, 134, 223, 22, 125, 234, 173, 28, 26, 41, 197, 207, 176, 225, 180, 42, 167, 142, 197, 182, 175, 152, 97, 74, 237, 0, 164, 55, 64, 71, 235, 172, 132, 161, 80, 85, 114, 47, 85, 114, 88, 101, 45, 85, 193, 0, 181, 233, 90, 171, 69, 196, 171, 167, 86, 34, 124, 124, 164, 212, 67, 181, 61, 251, 131, 173, 222, 141, 86, 136, 253, 244, 204, 7, 53, 18, 200, 37, 36, 8, 34, 88, 254, 177, 102, 183, 28, 77, 14, 64, 93, 236, 10, 29, 156, 29, 40, 9, 168, 235, 120, 18, 201, 176, 244, 5, 91, 132, 240, 250, 230, 11, 189, 180, 58, 115, 165, 26, 11, 189, 103, 238, 168, 219, 152, 224, 27, 128, 118, 155, 164, 108, 229, 58, 18, 126, 169, 38, 241, 98, 3, 230, 28, 243, 246, 52, 181, 231, 165, 192, 207, 222, 83, 24, 146, 70, 37, 233, 170, 95, 197, 87, 153, 83, 98, 152, 120, 134, 65, 146, 33, 223, 6, 63, 112, 220, 73, 169, 68, 30, 237, 187, 160, 68, 74, 107, 187, 154, 85, 215, 181, 138, 102, 86, 27, 153, 70, 87, 99, 13, 29, 170, 12, 162, 6, 94, 22, 106, 88, 246, 114, 131, 18, 156, 102, 118, 207, 247, 204, 44, 107, 51, 122, 207, 247, 204, 36, 68, 128, 77, 156, 89, 244, 233, 173, 86, 49, 181, 110, 122, 39, 107, 4, 131, 27, 198, 25, 46, 31, 207, 102, 23, 27, 128, 204, 112, 163, 129, 210, 152, 72, 92, 197, 108, 248, 184, 22, 51, 121, 102, 250, 34, 99, 43, 167, 106, 16, 70, 54, 221, 145, 26, 225, 129, 214, 156, 27, 31, 220, 120, 194, 246, 46, 124, 93, 8, 16, 202, 253, 232, 105, 26, 85, 21, 121, 183, 163, 175, 145, 127, 230, 85, 198, 222, 3, 245, 69, 115, 22, 12, 189, 234, 34, 117, 233, 66, 244, 53, 185, 144, 65, 229, 154, 55, 46, 51, 53, 5, 176, 246, 4, 239, 75, 207, 118, 63, 255, 32, 238, 231, 79, 207, 66, 123, 171, 4, 15, 247, 127, 172, 113, 177, 122, 4, 126, 253, 123, 120, 147, 69, 178, 174, 84, 207, 226, 160, 72, 126, 4, 43, 135, 1, 208, 60, 94, 121, 165, 54, 47, 42, 175, 248, 81, 54, 118, 37, 114, 172, 120, 222, 118, 127, 50, 26, 124, 247, 202, 86, 21, 23, 151, 71, 6, 108, 120, 92, 204, 45, 177, 105, 91, 17, 41, 139, 193, 168, 104, 139, 26, 59, 19, 237, 59, 15, 8, 152, 230, 202, 118, 160, 188, 60, 248, 46, 204, 226, 29, 39, 34, 53, 39, 144, 10, 152, 229, 93, 186, 169, 92, 53, 41, 6, 167, 87, 44, 157, 228, 195, 92, 178, 152, 104, 221, 227, 158, 0, 6, 188, 153, 136, 7, 43, 157, 158, 126, 134, 183, 120, 168, 210, 169, 120, 88, 147, 226, 100, 166, 232, 60, 37, 225, 213, 5, 121, 53, 207, 56, 98, 137, 238, 30, 56, 165, 56, 94, 13, 112, 85, 145, 52, 84, 159, 136, 41, 121, 67, 84, 150, 177, 50, 24, 59, 131, 47, 119, 222, 183, 34, 88, 7, 124, 228, 27, 129, 147, 55, 177, 130, 86, 253, 230, 248, 158, 19, 148, 102, 139, 105, 89, 75, 158, 68, 66, 187, 48, 197, 241, 36, 248, 14, 240, 176, 114, 134, 237, 65, 232, 147, 53, 208, 240, 15, 131, 79, 0, 63, 206, 204, 111, 163, 11, 125, 97, 77, 3, 254, 162, 131, 163, 138, 112, 26, 195, 82, 60, 176, 139, 237, 114, 23, 215, 246, 68, 164, 224, 88, 228, 140, 166, 151, 88, 62, 17, 107, 94, 148, 142, 89, 120, 134, 84, 36, 96, 230, 61, 178, 245, 230, 71, 228, 172, 185, 228, 169, 79, 33, 95, 183, 153, 101, 8, 194, 161, 216, 54, 105, 118, 185, 225, 255, 179, 114, 86, 57, 210, 222, 119, 167, 221, 160, 88, 245, 29, 176, 196, 48, 214, 43, 254, 19, 198, 247, 80, 57, 74, 244, 231, 197, 100, 242, 79, 199, 246, 75, 186, 188, 172, 44, 206, 124, 6, 153, 5, 209, 209, 98, 103, 208, 60, 199, 37, 125, 199, 204, 44, 118, 164, 42, 70, 233, 204, 44, 243, 94, 85, 230, 189, 183, 240, 131, 156, 66, 83, 37, 126, 238, 108, 17, 58, 121, 197, 2, 85, 177, 43, 186, 157, 176, 164, 43, 142, 205, 10, 135, 208, 102, 54, 16, 6, 228, 150, 215, 173, 82, 53, 72, 195, 245, 243, 128, 74, 97, 176, 80, 182, 134, 84, 224, 121, 233, 128, 131, 130, 16, 220, 176, 245, 206, 27, 62, 173, 211, 184, 73, 230, 202, 29, 228, 150, 16, 225, 32, 228, 250, 252, 68, 100, 92, 50, 37, 169, 102, 189, 58, 152, 201, 182, 244, 201, 222, 85, 22, 166, 25, 110, 214, 16, 93, 44, 130, 192, 181, 135, 235, 165, 227, 223, 239, 29, 244, 48, 82, 167, 85, 153, 210, 97, 85, 114, 104, 177, 20, 19, 62, 64, 146, 25, 34, 135, 222, 2, 79, 191, 216, 199, 40, 20, 51, 172, 167, 118, 16, 30, 207, 192, 216, 16, 37, 84, 196, 180, 99, 72, 228, 128, 99, 194, 65, 149, 87, 174, 202, 7, 90, 60, 5, 183, 180, 148, 31, 156, 192, 90, 34, 75, 20, 69, 130, 148, 91, 154, 162, 108, 24, 142, 128, 214, 97, 208, 131, 125, 50, 130, 195, 233, 208, 176, 220, 99, 196, 33, 43, 114, 71, 181, 23, 30, 76, 38, 192, 22, 213, 217, 139, 172, 36, 217, 18, 156, 122, 125, 173, 56, 77, 70, 220, 156, 0, 127, 39, 232, 22, 63, 240, 181, 214, 66, 226, 187, 212, 234, 132, 44, 189, 17, 60, 28, 17, 165, 208, 99, 99, 47, 53, 202, 31, 60, 248, 99, 39, 27, 73, 121, 36, 23, 128, 105, 192, 201, 138, 67, 5, 35, 92, 28, 154, 63, 94, 194, 148, 138, 176, 171, 212, 75, 16, 40, 235, 236, 162, 33, 187, 2, 15, 186, 156, 137, 173, 194, 230, 108, 77, 246, 213, 33, 148, 155, 112, 39, 161, 148, 236, 166, 37, 177, 165, 54, 34, 79, 160, 59, 225, 114, 41, 41, 100, 149, 60, 255, 44, 157, 35, 251, 80, 145, 0, 196, 18, 97, 165, 132, 243, 46, 189, 180, 131, 110, 135, 46, 40, 179, 199, 114, 86, 4, 90, 21, 204, 131, 225, 12, 54, 200, 97, 58, 220, 173, 140, 51, 229, 105, 83, 188, 118, 204, 13, 95, 67, 147, 55, 47, 108, 132, 175, 76, 224, 82, 41, 119, 137, 191, 27, 73, 93, 222, 126, 14, 228, 98, 203, 96, 69, 82, 209, 117, 9, 148, 250, 92, 24, 41, 139, 90, 33, 212, 36, 72, 236, 84, 248, 181, 171, 142, 242, 163, 151, 197, 87, 163, 201, 190, 177, 23, 132, 209, 81, 126, 226, 62, 129, 244, 113, 126, 170, 163, 252, 100, 82, 115, 79, 243, 146, 120, 200, 72, 208, 82, 71, 121, 21, 84, 161, 226, 21, 199, 120, 173, 57, 113, 40, 11, 145, 89, 55, 27, 96, 226, 12, 203, 68, 66, 40, 115, 31, 170, 76, 47, 217, 227, 156, 24, 15, 125, 247, 1, 87, 202, 35, 172, 150, 202, 3, 38, 147, 220, 143, 143, 174, 226, 71, 86, 41, 39, 156, 215, 62, 177, 234, 251, 79, 171, 90, 99, 146, 105, 195, 19, 170, 54, 57, 157, 42, 202, 203, 142, 101, 16, 207, 153, 138, 92, 6, 19, 143, 7, 205, 56, 128, 74, 235, 146, 250, 83, 28, 148, 142, 105, 82, 41, 192, 74, 110, 242, 6, 64, 244, 143, 77, 11, 166, 149, 63, 146, 88, 236, 102, 100, 197, 54, 37, 71, 36, 123, 235, 243, 58, 10, 204, 198, 231, 235, 173, 124, 85, 119, 112, 208, 36, 163, 78, 50, 175, 77, 10, 150, 87, 240, 57, 86, 157, 7, 149, 226, 226, 28, 23, 53, 225, 218, 45, 223, 25, 56, 238, 3, 170, 37, 154, 93, 76, 138, 247, 152, 231, 110, 46, 95, 195, 102, 127, 143, 27, 176, 78, 20, 122, 197, 174, 131, 148, 233, 226, 38, 11, 131, 36, 43, 236, 149, 236, 207, 125, 151, 118, 96, 109, 153, 75, 46, 12, 61, 115, 246, 44, 191, 201, 112, 149, 91, 213, 108, 46, 153, 124, 53, 27, 124, 241, 9, 42, 59, 53, 22, 5, 61, 231, 92, 58, 114, 210, 74, 254, 16, 129, 172, 70, 143, 242, 82, 75, 77, 182, 147, 172, 156, 147, 90, 147, 66, 160, 110, 125, 226, 224, 23, 197, 70, 85, 191, 24, 157, 137, 80, 126, 37, 223, 51, 79, 231, 83, 182, 50, 122, 36, 30, 1, 200, 142, 90, 250, 206, 234, 49, 150, 183, 17, 87, 168, 190, 95, 168, 245, 125, 213, 216, 101, 205, 41, 83, 130, 49, 59, 111, 93, 156, 56, 77, 32, 47, 78, 158, 38, 146, 232, 4, 106, 220, 75, 101, 76, 41, 198, 61, 107, 56, 118, 252, 136, 60, 218, 199, 114, 67, 198, 206, 157, 136, 145, 122, 43, 32, 8, 137, 31, 207, 255, 113, 126, 241, 233, 188, 160, 191, 202, 97, 88, 125, 28, 87, 30, 83, 223, 100, 88, 114, 54, 30, 88, 91, 175, 166, 246, 108, 1, 189, 6, 122, 231, 223, 179, 82, 37, 58, 135, 43, 225, 92, 110, 120, 22, 87, 98, 120, 190, 206, 121, 92, 130, 3, 42, 248, 231, 233, 67, 179, 82, 35, 255, 196, 139, 212, 225, 89, 75, 105, 252, 154, 117, 60, 129, 176, 100, 134, 175, 188, 231, 55, 55, 176, 96, 47, 121, 123, 184, 206, 234, 47, 154, 53, 242, 251, 197, 242, 87, 185, 103, 253, 179, 146, 149, 192, 153, 0, 127, 61, 95, 5, 225, 154, 237, 190, 95, 5, 131, 236, 210, 207, 64, 97, 131, 185, 45, 41, 210, 29, 113, 38, 187, 114, 154, 49, 10, 76, 72, 152, 227, 94, 4, 105, 170, 3, 220, 97, 225, 42, 10, 89, 211, 113, 118, 172, 171, 145, 243, 224, 248, 209, 88, 194, 12, 6, 137, 123, 33, 133, 120, 32, 253, 135, 163, 131, 235, 99, 141, 3, 74, 228, 226, 155, 29, 186, 217, 71, 162, 39, 79, 224, 82, 245, 238, 130, 45, 40, 39, 240, 143, 111, 218, 200, 161, 32, 58, 195, 107, 5, 13, 28, 216, 143, 160, 66, 101, 183, 85, 100, 240, 233, 171, 12, 2, 62, 185, 62, 232, 99, 16, 100, 160, 206, 75, 107, 87, 199, 215, 184, 222, 232, 106, 21, 234, 74, 28, 144, 242, 207, 239, 46, 47, 62, 93, 29, 95, 102, 224, 65, 238, 0, 120, 231, 123, 143, 129, 227, 103, 224, 130, 80, 52, 6, 101, 5, 26, 116, 187, 9, 17, 76, 73, 87, 97, 36, 111, 154, 201, 192, 137, 110, 37, 202, 98, 205, 245, 229, 201, 47, 191, 28, 95, 106, 12, 198, 230, 50, 133, 254, 96, 163, 29, 105, 233, 152, 51, 89, 205, 145, 233, 174, 73, 237, 154, 77, 192, 210, 200, 241, 7, 223, 155, 59, 126, 248, 84, 226, 139, 14, 50, 119, 213, 74, 32, 164, 169, 165, 115, 79, 99, 216, 105, 108, 164, 91, 45, 102, 30, 134, 187, 62, 130, 249, 87, 141, 40, 220, 203, 178, 74, 188, 124, 151, 98, 134, 96, 143, 103, 15, 174, 143, 209, 128, 89, 152, 33, 220, 195, 139, 243, 159, 79, 126, 249, 120, 121, 140, 160, 78, 46, 47, 206, 207, 142, 207, 175, 53, 0, 121, 114, 240, 14, 218, 195, 143, 21, 118, 226, 72, 131, 77, 229, 156, 11, 151, 106, 206, 186, 188, 253, 111, 81, 27, 39, 230, 62, 158, 241, 231, 98, 128, 50, 208, 208, 170, 253, 95, 85, 36, 149, 30, 49, 71, 34, 67, 141, 152, 27, 147, 161, 66, 103, 23, 231, 39, 215, 23, 151, 8, 99, 19, 171, 153, 222, 202, 69, 15, 60, 164, 196, 5, 226, 130, 225, 140, 11, 178, 196, 236, 108, 10, 90, 216, 46, 40, 118, 203, 124, 222, 99, 157, 18, 137, 51, 111, 87, 156, 41, 149, 220, 209, 183, 162, 10, 158, 61, 1, 60, 111, 233, 5, 193, 104, 77, 240, 98, 255, 147, 168, 34, 2, 243, 38, 115, 151, 242, 10, 224, 137, 93, 155, 50, 248, 67, 37, 119, 132, 189, 146, 43, 128, 71, 91, 179, 101, 176, 12, 192, 170, 147, 188, 242, 97, 179, 220, 122, 254, 209, 94, 146, 95, 41, 181, 101, 9, 252, 141, 113, 91, 141, 15, 120, 146, 11, 37, 87, 22, 17, 7, 152, 219, 142, 40, 171, 188, 201, 93, 4, 160, 171, 215, 176, 208, 154, 75, 211, 178, 230, 150, 113, 57, 224, 140, 133, 90, 157, 227, 228, 109, 4, 50, 58, 212, 62, 76, 156, 17, 57, 30, 20, 11, 86, 61, 114, 2, 240, 41, 121, 133, 166, 22, 6, 145, 77, 141, 172, 49, 20, 211, 200, 24, 103, 254, 77, 48, 37, 217, 204, 9, 164, 23, 194, 210, 142, 196, 48, 196, 77, 2, 35, 67, 0, 121, 229, 0, 61, 148, 75, 24, 78, 146, 253, 225, 56, 168, 249, 19, 39, 71, 123, 240, 181, 151, 28, 194, 208, 78, 4, 170, 226, 55, 252, 105, 127, 238, 236, 168, 102, 109, 184, 3, 175, 245, 179, 65, 224, 42, 196, 210, 159, 9, 99, 63, 93, 207, 218, 10, 227, 208, 124, 248, 238, 142, 169, 175, 238, 110, 228, 245, 66, 130, 188, 241, 2, 169, 105, 180, 251, 57, 73, 105, 156, 34, 232, 139, 122, 162, 63, 128, 206, 4, 148, 12, 198, 232, 62, 244, 41, 120, 64, 197, 9, 162, 87, 12, 237, 187, 34, 20, 77, 108, 141, 146, 154, 24, 95, 41, 76, 234, 72, 120, 2, 209, 49, 111, 155, 44, 60, 12, 146, 106, 53, 173, 202, 167, 168, 145, 12, 252, 204, 182, 72, 81, 164, 84, 104, 115, 132, 65, 216, 0, 241, 156, 71, 112, 46, 113, 137, 28, 238, 241, 161, 75, 228, 212, 141, 73, 28, 101, 171, 219, 168, 192, 194, 165, 60, 36, 4, 86, 253, 236, 123, 83, 198, 66, 105, 13, 185, 204, 220, 123, 145, 185, 100, 78, 186, 96, 240, 0, 71, 206, 164, 149, 132, 178, 108, 134, 228, 170, 111, 203, 9, 92, 202, 2, 45, 178, 250, 201, 249, 118, 162, 3, 73, 249, 108, 211, 222, 110, 48, 240, 221, 121, 184, 255, 127, 0, 109, 26, 217, 187, 127, 229, 0, 0, };
+// Generated by buildtool/update_modules.py, includes the page built for the modules in ESP_CONP_MODULES.
+#if ESP_CONP_PAGE_MODULES == 0xdf
+#include "config-html/config-html-df.h"
+#else
+#error "No config page was built for ESP_CONP_MODULES, run buildtool/update_modules.py with the same modules."
+#endif
 #endif
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef DX_ESP_CONFIG_PAGE_HTML_DF_H
+#define ESP_CONFIG_HTML_MODULES 0xdf
+#define ESP_CONFIG_HTML_LEN 17291
+#define ESP_CONFIG_HTML_HASH "caf666e9472c74f9"
+#define ESP_CONFIG_HTML_BR_LEN 14835
+#define DX_ESP_CONFIG_PAGE_HTML_DF_H
+#ifndef ESP_CONP_PAGE_BROTLI_ONLY
+const uint8_t ESP_CONFIG_HTML[] PROGMEM = {31, 139, 8, 0, 0, 0, 0, 0, 2, 3, 237, 125, 125, 95, 219, 184, 178, 240, 255, 253, 20, 110, 206, 110, 19, 95, 146, 96, 231, 253, 133, 208, 135, 82, 218, 114, 151, 66, 47, 208, 237, 57, 203, 97, 187, 38, 113, 136, 183, 73, 156, 218, 14, 148, 5, 206, 103, 127, 102, 70, 146, 45, 219, 178, 147, 208, 222, 151, 223, 239, 222, 238, 2, 137, 45, 141, 102, 70, 163, 153, 209, 72, 26, 237, 60, 31, 185, 195, 224, 110, 97, 107, 147, 96, 54, 221, 221, 153, 217, 129, 165, 13, 221, 121, 96, 207, 131, 65, 225, 214, 25, 5, 147, 193, 200, 190, 113, 134, 118, 133, 190, 148, 157, 185, 19, 56, 214, 180, 226, 15, 173, 169, 61, 48, 11, 218, 220, 154, 217, 131, 27, 199, 190, 93, 184, 94, 176, 187, 19, 56, 193, 212, 222, 61, 56, 251, 160, 237, 187, 243, 177, 115, 189, 179, 205, 158, 236, 248, 193, 29, 252, 185, 90, 6, 129, 59, 191, 31, 186, 83, 215, 235, 253, 109, 56, 30, 117, 70, 195, 254, 216, 153, 6, 182, 215, 27, 121, 238, 162, 226, 79, 172, 145, 123, 91, 50, 180, 198, 226, 155, 86, 135, 159, 191, 25, 244, 207, 172, 233, 241, 247, 53, 120, 87, 139, 222, 27, 99, 189, 63, 92, 122, 62, 128, 93, 184, 14, 224, 239, 245, 175, 172, 225, 151, 107, 207, 93, 206, 71, 21, 222, 94, 163, 134, 255, 117, 140, 254, 149, 235, 141, 160, 197, 185, 59, 183, 249, 231, 138, 103, 141, 156, 165, 223, 235, 44, 190, 245, 23, 214, 104, 228, 204, 175, 123, 166, 103, 207, 52, 179, 218, 132, 63, 253, 49, 240, 164, 226, 59, 127, 217, 61, 211, 158, 61, 50, 50, 122, 19, 247, 134, 160, 4, 165, 234, 220, 173, 208, 55, 253, 62, 171, 217, 113, 173, 31, 120, 214, 220, 7, 254, 65, 85, 107, 58, 213, 170, 102, 211, 215, 166, 206, 220, 182, 60, 14, 49, 4, 115, 207, 105, 89, 206, 125, 59, 120, 238, 204, 144, 185, 214, 60, 120, 172, 58, 208, 57, 149, 171, 96, 126, 255, 231, 210, 15, 156, 241, 93, 133, 119, 86, 111, 104, 19, 209, 214, 212, 185, 158, 87, 156, 192, 158, 249, 226, 17, 117, 92, 175, 222, 2, 202, 38, 182, 115, 61, 9, 216, 103, 65, 37, 163, 111, 228, 248, 139, 169, 117, 215, 27, 79, 237, 111, 9, 150, 152, 134, 241, 179, 10, 5, 205, 191, 185, 190, 103, 192, 177, 136, 0, 142, 159, 31, 171, 136, 86, 5, 58, 214, 246, 69, 159, 199, 129, 18, 97, 125, 153, 202, 126, 146, 34, 127, 97, 129, 216, 93, 217, 193, 173, 109, 207, 85, 132, 201, 56, 43, 90, 100, 221, 115, 159, 45, 6, 114, 29, 173, 55, 118, 60, 63, 168, 12, 39, 206, 116, 36, 112, 13, 64, 224, 166, 246, 56, 144, 133, 67, 122, 229, 33, 189, 210, 187, 56, 188, 169, 149, 4, 119, 229, 2, 90, 179, 84, 181, 126, 252, 117, 162, 193, 199, 170, 63, 3, 97, 161, 62, 15, 187, 172, 205, 36, 179, 22, 151, 204, 106, 167, 9, 178, 89, 165, 1, 87, 9, 236, 111, 129, 24, 103, 87, 35, 252, 143, 11, 194, 216, 9, 4, 139, 251, 51, 203, 187, 118, 230, 212, 100, 207, 90, 6, 174, 120, 64, 40, 178, 39, 50, 120, 128, 238, 204, 23, 203, 32, 49, 126, 211, 28, 30, 143, 199, 225, 32, 51, 97, 144, 250, 238, 212, 25, 105, 215, 158, 117, 151, 144, 45, 24, 229, 125, 119, 25, 224, 32, 96, 163, 49, 38, 149, 140, 161, 247, 216, 191, 149, 145, 227, 217, 67, 26, 58, 208, 198, 114, 54, 239, 175, 49, 0, 252, 192, 179, 131, 225, 164, 127, 109, 45, 104, 48, 115, 242, 122, 200, 55, 13, 169, 211, 140, 132, 16, 205, 236, 17, 23, 233, 166, 97, 32, 243, 167, 80, 195, 230, 143, 58, 77, 246, 200, 181, 70, 40, 87, 73, 242, 66, 118, 36, 70, 15, 144, 56, 3, 158, 114, 24, 48, 80, 102, 214, 55, 233, 155, 24, 54, 160, 204, 66, 100, 174, 166, 238, 240, 75, 127, 225, 114, 101, 225, 217, 83, 43, 112, 110, 236, 62, 10, 244, 120, 234, 222, 246, 38, 206, 104, 100, 207, 5, 46, 61, 107, 28, 160, 206, 224, 156, 40, 20, 228, 177, 200, 187, 221, 153, 79, 108, 207, 9, 164, 206, 194, 110, 170, 143, 12, 67, 86, 75, 84, 86, 171, 130, 94, 178, 45, 223, 174, 0, 218, 208, 59, 17, 34, 214, 21, 144, 186, 12, 236, 62, 136, 127, 207, 232, 147, 220, 24, 2, 139, 138, 53, 119, 102, 86, 96, 143, 20, 172, 1, 129, 80, 241, 37, 197, 133, 206, 211, 153, 16, 54, 159, 230, 198, 149, 251, 13, 69, 24, 229, 42, 28, 107, 223, 84, 156, 96, 248, 52, 226, 202, 172, 207, 0, 35, 14, 53, 161, 175, 53, 7, 140, 27, 152, 66, 91, 195, 151, 12, 129, 85, 108, 250, 127, 95, 236, 187, 177, 7, 230, 210, 151, 42, 221, 27, 63, 223, 179, 247, 172, 27, 198, 174, 55, 235, 209, 39, 160, 214, 46, 85, 16, 1, 253, 49, 112, 89, 33, 66, 71, 85, 14, 11, 61, 130, 245, 240, 237, 41, 140, 146, 251, 202, 173, 125, 245, 5, 198, 121, 224, 46, 135, 147, 10, 152, 234, 41, 116, 35, 27, 96, 226, 213, 210, 7, 54, 176, 226, 252, 197, 204, 253, 75, 245, 212, 79, 63, 76, 151, 250, 130, 238, 67, 170, 32, 232, 34, 247, 250, 122, 106, 223, 175, 54, 197, 146, 172, 176, 87, 195, 161, 66, 85, 108, 108, 34, 66, 117, 210, 80, 168, 202, 184, 209, 75, 9, 154, 192, 126, 247, 223, 238, 211, 152, 196, 0, 107, 213, 150, 108, 67, 73, 112, 195, 218, 49, 195, 18, 211, 175, 84, 87, 148, 211, 170, 188, 239, 56, 131, 106, 67, 252, 47, 110, 33, 255, 130, 1, 57, 178, 191, 245, 186, 240, 79, 161, 117, 185, 254, 145, 134, 51, 10, 13, 184, 25, 43, 70, 115, 132, 42, 185, 50, 12, 15, 253, 62, 238, 78, 169, 11, 101, 218, 216, 102, 23, 255, 3, 52, 115, 124, 158, 42, 41, 118, 214, 83, 27, 248, 51, 49, 141, 253, 183, 41, 96, 5, 29, 1, 246, 225, 230, 94, 30, 209, 9, 1, 147, 251, 110, 61, 123, 226, 7, 150, 23, 168, 218, 231, 170, 161, 101, 220, 76, 72, 149, 203, 223, 99, 18, 37, 20, 85, 229, 142, 76, 105, 12, 87, 45, 176, 174, 166, 182, 228, 62, 61, 178, 7, 28, 91, 192, 105, 106, 45, 124, 187, 39, 62, 244, 215, 160, 173, 90, 67, 161, 150, 189, 215, 199, 96, 98, 91, 35, 5, 95, 34, 33, 0, 162, 135, 95, 238, 152, 166, 130, 226, 9, 151, 1, 189, 136, 10, 241, 64, 80, 31, 115, 86, 228, 97, 219, 162, 127, 128, 148, 140, 64, 106, 200, 209, 247, 91, 193, 49, 35, 137, 199, 99, 48, 250, 129, 24, 84, 91, 77, 244, 147, 18, 205, 54, 12, 32, 212, 187, 151, 186, 142, 177, 234, 202, 29, 221, 105, 240, 66, 146, 216, 136, 113, 26, 48, 215, 15, 203, 164, 196, 62, 114, 242, 193, 63, 158, 143, 93, 146, 34, 109, 33, 198, 59, 199, 181, 82, 165, 150, 118, 182, 217, 100, 104, 135, 160, 209, 231, 193, 42, 143, 170, 102, 226, 127, 140, 142, 177, 53, 115, 166, 119, 61, 31, 208, 4, 109, 235, 57, 227, 200, 36, 162, 156, 237, 238, 160, 124, 13, 193, 255, 244, 7, 5, 174, 92, 132, 101, 160, 185, 157, 6, 94, 78, 65, 115, 70, 131, 153, 59, 90, 130, 171, 200, 94, 185, 30, 71, 37, 49, 60, 60, 247, 54, 237, 57, 238, 238, 108, 67, 35, 172, 165, 16, 144, 191, 187, 179, 224, 237, 70, 62, 168, 212, 14, 61, 228, 141, 112, 198, 160, 216, 213, 34, 207, 44, 236, 84, 120, 20, 35, 67, 160, 173, 249, 67, 15, 84, 125, 101, 97, 205, 237, 169, 38, 233, 143, 2, 204, 48, 225, 33, 47, 207, 108, 43, 54, 237, 6, 86, 133, 127, 99, 13, 139, 17, 138, 246, 9, 168, 192, 74, 114, 75, 18, 72, 81, 157, 218, 130, 206, 162, 73, 69, 118, 177, 229, 2, 219, 33, 239, 159, 102, 71, 238, 124, 56, 5, 145, 30, 184, 243, 147, 192, 250, 72, 47, 75, 58, 71, 34, 20, 208, 78, 124, 136, 116, 145, 108, 152, 86, 105, 56, 161, 6, 31, 101, 80, 48, 180, 74, 183, 101, 104, 252, 167, 160, 1, 248, 233, 224, 111, 118, 199, 182, 128, 25, 76, 124, 7, 38, 120, 77, 26, 155, 171, 211, 199, 111, 179, 233, 220, 31, 76, 130, 96, 209, 219, 222, 190, 189, 189, 173, 222, 214, 171, 174, 119, 189, 93, 131, 105, 242, 54, 64, 135, 110, 178, 192, 203, 27, 13, 10, 239, 27, 13, 163, 2, 143, 39, 29, 227, 166, 98, 182, 218, 211, 86, 67, 131, 255, 155, 173, 74, 179, 13, 223, 13, 241, 163, 225, 79, 179, 13, 47, 180, 86, 189, 210, 170, 223, 64, 217, 223, 222, 215, 160, 114, 199, 248, 90, 169, 215, 53, 163, 210, 108, 85, 155, 149, 90, 189, 218, 60, 231, 117, 110, 42, 173, 134, 241, 213, 192, 183, 248, 152, 10, 156, 83, 149, 142, 49, 169, 215, 140, 41, 124, 214, 224, 231, 166, 1, 48, 12, 173, 94, 167, 218, 26, 21, 107, 215, 16, 242, 59, 120, 251, 219, 12, 244, 92, 165, 89, 3, 112, 128, 39, 62, 185, 1, 176, 147, 6, 34, 12, 200, 191, 131, 55, 2, 17, 227, 6, 74, 96, 41, 32, 193, 192, 198, 127, 43, 108, 99, 15, 3, 193, 26, 19, 142, 152, 232, 145, 67, 69, 211, 140, 93, 214, 59, 200, 91, 91, 72, 196, 54, 235, 110, 33, 231, 52, 237, 209, 172, 225, 208, 94, 4, 131, 234, 149, 51, 47, 227, 175, 234, 245, 95, 162, 247, 169, 219, 89, 41, 138, 136, 44, 23, 35, 240, 203, 80, 8, 38, 214, 252, 218, 142, 73, 65, 224, 45, 109, 93, 33, 142, 26, 6, 98, 6, 8, 73, 30, 94, 63, 110, 4, 84, 198, 223, 55, 6, 42, 227, 141, 71, 1, 52, 249, 127, 227, 224, 127, 231, 56, 128, 174, 255, 47, 28, 9, 100, 207, 110, 157, 177, 131, 22, 106, 236, 92, 147, 161, 202, 16, 234, 80, 138, 201, 32, 13, 10, 251, 238, 124, 142, 182, 241, 214, 9, 38, 224, 32, 107, 190, 239, 128, 125, 100, 213, 194, 224, 75, 40, 199, 67, 86, 250, 220, 253, 4, 173, 149, 244, 93, 81, 251, 189, 53, 95, 66, 217, 187, 36, 203, 242, 81, 200, 106, 229, 218, 14, 16, 254, 153, 29, 4, 48, 64, 124, 24, 49, 12, 217, 83, 123, 236, 217, 254, 100, 247, 8, 59, 234, 24, 38, 62, 174, 247, 197, 95, 171, 201, 180, 225, 101, 86, 86, 109, 178, 137, 149, 224, 2, 7, 75, 159, 61, 147, 107, 247, 12, 209, 146, 36, 78, 44, 90, 220, 171, 197, 39, 243, 188, 2, 139, 162, 38, 99, 46, 216, 213, 133, 152, 194, 10, 39, 241, 33, 14, 236, 185, 66, 75, 21, 34, 87, 134, 35, 128, 97, 30, 35, 108, 49, 108, 175, 130, 31, 35, 249, 152, 58, 126, 232, 190, 108, 32, 91, 36, 216, 115, 139, 23, 103, 45, 62, 109, 206, 18, 246, 189, 232, 235, 194, 181, 251, 10, 28, 190, 146, 222, 215, 60, 59, 88, 122, 115, 109, 108, 77, 193, 229, 47, 8, 1, 125, 235, 106, 232, 17, 10, 86, 69, 1, 88, 194, 130, 243, 189, 17, 197, 119, 241, 243, 110, 181, 26, 137, 5, 111, 144, 243, 73, 116, 162, 134, 255, 177, 240, 111, 44, 236, 86, 80, 74, 4, 76, 7, 61, 32, 166, 130, 58, 147, 30, 238, 102, 139, 93, 196, 199, 40, 34, 170, 238, 38, 73, 46, 162, 126, 162, 242, 196, 85, 11, 102, 138, 94, 186, 183, 56, 164, 31, 23, 24, 228, 49, 114, 195, 136, 68, 54, 43, 72, 88, 80, 27, 191, 33, 180, 234, 206, 42, 22, 161, 226, 87, 242, 197, 139, 168, 180, 231, 55, 149, 76, 190, 201, 134, 93, 20, 78, 49, 36, 166, 67, 10, 145, 18, 137, 85, 22, 82, 230, 91, 55, 118, 104, 120, 51, 67, 193, 73, 135, 60, 39, 52, 188, 123, 6, 16, 35, 25, 152, 90, 87, 224, 144, 36, 69, 12, 11, 18, 1, 76, 151, 0, 230, 84, 46, 79, 100, 40, 228, 90, 8, 231, 22, 210, 164, 121, 119, 135, 38, 201, 240, 7, 167, 181, 240, 199, 195, 143, 220, 228, 131, 226, 217, 61, 119, 102, 54, 52, 52, 91, 68, 143, 187, 240, 248, 200, 189, 214, 206, 65, 98, 119, 216, 252, 77, 2, 74, 240, 42, 248, 20, 48, 226, 192, 115, 213, 54, 163, 82, 76, 174, 162, 1, 18, 99, 121, 76, 211, 122, 225, 20, 83, 152, 207, 225, 196, 30, 126, 97, 42, 78, 224, 65, 143, 192, 209, 137, 204, 36, 251, 115, 196, 222, 159, 13, 61, 119, 58, 69, 35, 128, 118, 81, 20, 222, 213, 216, 115, 13, 100, 148, 77, 156, 66, 238, 174, 131, 230, 238, 241, 114, 118, 5, 194, 235, 130, 91, 56, 113, 111, 231, 26, 60, 246, 28, 219, 215, 132, 149, 135, 174, 27, 186, 179, 197, 212, 14, 192, 106, 143, 199, 28, 28, 74, 34, 43, 32, 225, 207, 171, 242, 23, 25, 254, 5, 195, 126, 206, 90, 189, 177, 166, 75, 123, 96, 130, 43, 182, 187, 17, 214, 10, 224, 196, 219, 247, 14, 88, 142, 229, 76, 155, 218, 55, 0, 99, 71, 76, 119, 179, 81, 166, 130, 124, 238, 27, 177, 221, 95, 94, 129, 234, 119, 174, 4, 231, 195, 17, 147, 246, 150, 118, 220, 5, 142, 117, 78, 137, 177, 251, 218, 190, 90, 94, 199, 31, 154, 187, 135, 243, 177, 27, 127, 86, 219, 253, 100, 121, 115, 0, 29, 127, 92, 223, 61, 240, 60, 215, 3, 59, 71, 24, 253, 24, 166, 156, 91, 215, 79, 234, 206, 0, 234, 241, 167, 121, 156, 1, 157, 56, 180, 39, 238, 20, 12, 244, 0, 131, 123, 153, 156, 250, 191, 14, 254, 95, 210, 193, 10, 187, 20, 153, 37, 169, 125, 217, 213, 101, 33, 170, 176, 209, 221, 51, 12, 188, 38, 125, 139, 140, 192, 146, 237, 251, 214, 245, 250, 49, 165, 216, 28, 179, 206, 48, 207, 180, 67, 97, 28, 79, 112, 95, 225, 215, 161, 3, 65, 177, 249, 221, 157, 137, 23, 179, 173, 24, 211, 85, 161, 189, 251, 250, 224, 215, 195, 253, 3, 237, 240, 117, 143, 207, 198, 128, 14, 10, 114, 58, 35, 17, 128, 147, 130, 149, 109, 210, 143, 204, 247, 85, 0, 123, 191, 183, 175, 237, 189, 126, 125, 122, 112, 118, 150, 4, 55, 179, 134, 155, 195, 123, 115, 122, 112, 160, 157, 125, 216, 219, 63, 72, 130, 99, 75, 45, 48, 249, 176, 243, 161, 106, 87, 119, 1, 216, 144, 109, 101, 245, 0, 166, 136, 211, 117, 234, 171, 112, 123, 245, 241, 240, 232, 181, 246, 122, 239, 252, 224, 252, 240, 125, 10, 191, 171, 165, 51, 29, 61, 145, 224, 119, 7, 123, 31, 146, 240, 60, 107, 182, 22, 162, 49, 137, 231, 254, 250, 107, 27, 199, 32, 205, 163, 83, 62, 59, 192, 31, 209, 235, 10, 69, 32, 214, 14, 114, 72, 193, 10, 140, 4, 152, 181, 40, 224, 80, 169, 213, 131, 74, 173, 81, 105, 182, 111, 48, 66, 48, 169, 52, 140, 155, 74, 199, 152, 212, 12, 12, 14, 192, 95, 12, 46, 176, 175, 29, 246, 22, 74, 137, 80, 131, 214, 108, 7, 80, 83, 171, 213, 223, 1, 220, 223, 102, 13, 195, 168, 180, 48, 194, 208, 161, 98, 147, 6, 2, 161, 232, 66, 189, 101, 84, 224, 41, 197, 72, 224, 243, 4, 154, 184, 129, 191, 191, 205, 48, 40, 146, 126, 76, 104, 182, 107, 4, 133, 0, 132, 81, 136, 212, 188, 68, 176, 13, 156, 144, 48, 0, 161, 100, 28, 47, 128, 172, 83, 57, 89, 92, 25, 61, 133, 167, 13, 64, 182, 94, 51, 52, 30, 101, 153, 98, 232, 167, 163, 153, 70, 3, 127, 128, 176, 90, 11, 9, 132, 63, 83, 248, 94, 193, 231, 205, 150, 214, 236, 80, 152, 5, 126, 88, 236, 5, 24, 161, 236, 20, 232, 44, 172, 141, 127, 40, 96, 19, 125, 87, 245, 66, 35, 143, 85, 105, 166, 208, 196, 52, 98, 72, 108, 193, 240, 71, 113, 7, 56, 3, 180, 80, 184, 10, 37, 235, 29, 254, 69, 97, 33, 146, 147, 79, 147, 241, 48, 153, 19, 81, 40, 12, 190, 183, 2, 124, 217, 200, 10, 130, 37, 120, 242, 67, 2, 96, 89, 162, 119, 178, 176, 231, 26, 155, 73, 186, 222, 157, 74, 246, 198, 100, 5, 255, 19, 36, 143, 135, 9, 149, 236, 34, 110, 36, 217, 5, 68, 78, 59, 134, 198, 162, 135, 95, 177, 22, 134, 36, 107, 141, 0, 89, 214, 122, 215, 104, 180, 167, 192, 4, 236, 16, 140, 62, 2, 136, 105, 183, 133, 178, 61, 105, 117, 26, 71, 157, 122, 187, 82, 51, 219, 95, 43, 29, 173, 6, 208, 186, 90, 163, 22, 64, 51, 154, 217, 196, 210, 191, 205, 58, 13, 212, 28, 77, 179, 53, 109, 215, 176, 203, 223, 213, 225, 35, 12, 99, 141, 186, 0, 3, 6, 236, 121, 248, 168, 2, 53, 72, 71, 16, 74, 27, 73, 46, 133, 99, 26, 185, 44, 237, 199, 67, 213, 79, 29, 217, 48, 210, 52, 82, 107, 95, 187, 205, 74, 23, 152, 5, 242, 108, 54, 58, 65, 173, 133, 34, 245, 213, 172, 183, 128, 176, 90, 203, 212, 154, 181, 160, 102, 118, 53, 120, 119, 196, 235, 145, 144, 155, 13, 173, 222, 106, 128, 122, 107, 124, 173, 180, 187, 21, 236, 49, 96, 67, 215, 12, 42, 102, 183, 86, 169, 155, 95, 43, 221, 46, 52, 0, 95, 180, 58, 62, 4, 230, 116, 205, 41, 20, 199, 106, 155, 243, 164, 254, 95, 204, 147, 86, 165, 219, 225, 60, 233, 50, 158, 152, 192, 147, 182, 224, 137, 201, 121, 210, 13, 121, 2, 182, 192, 172, 212, 155, 245, 175, 181, 102, 197, 236, 96, 156, 188, 214, 9, 90, 117, 208, 139, 76, 30, 91, 168, 54, 131, 102, 19, 212, 41, 140, 236, 38, 8, 76, 19, 24, 215, 169, 52, 187, 192, 27, 163, 210, 53, 144, 113, 192, 207, 218, 87, 168, 98, 18, 231, 234, 90, 189, 134, 156, 51, 181, 46, 106, 3, 168, 218, 104, 110, 206, 185, 218, 255, 120, 206, 213, 186, 221, 74, 195, 108, 126, 173, 131, 237, 232, 104, 56, 120, 234, 65, 23, 23, 25, 190, 54, 129, 17, 26, 8, 167, 217, 10, 58, 13, 173, 81, 159, 154, 29, 224, 104, 167, 190, 17, 231, 160, 188, 6, 63, 155, 115, 206, 252, 159, 207, 185, 122, 13, 52, 85, 237, 107, 179, 94, 169, 131, 194, 50, 193, 66, 119, 3, 19, 30, 214, 106, 95, 91, 48, 252, 52, 248, 12, 16, 3, 120, 163, 53, 187, 83, 44, 0, 63, 155, 113, 15, 170, 194, 207, 230, 220, 51, 254, 167, 107, 49, 5, 69, 56, 217, 91, 4, 187, 224, 139, 106, 142, 207, 22, 100, 222, 56, 222, 236, 214, 242, 108, 109, 160, 225, 210, 76, 255, 153, 6, 255, 176, 0, 15, 254, 190, 242, 220, 91, 223, 246, 62, 32, 86, 3, 173, 184, 93, 236, 63, 163, 34, 192, 14, 63, 32, 183, 205, 223, 23, 65, 74, 40, 48, 114, 135, 203, 25, 84, 171, 94, 219, 193, 193, 212, 198, 143, 175, 238, 14, 71, 165, 98, 34, 192, 91, 212, 57, 156, 157, 231, 149, 202, 251, 189, 211, 95, 14, 78, 43, 111, 14, 143, 14, 206, 42, 149, 93, 9, 62, 243, 155, 207, 128, 123, 57, 160, 35, 231, 26, 161, 98, 229, 176, 90, 149, 250, 167, 202, 59, 3, 9, 192, 254, 136, 211, 32, 92, 204, 85, 173, 72, 158, 104, 216, 78, 84, 117, 157, 150, 144, 7, 43, 90, 17, 174, 157, 104, 129, 87, 89, 11, 58, 185, 43, 171, 224, 135, 62, 77, 216, 130, 168, 182, 78, 27, 92, 40, 80, 26, 48, 186, 154, 215, 82, 106, 241, 64, 52, 152, 128, 81, 117, 230, 32, 15, 28, 90, 90, 232, 250, 161, 148, 28, 28, 191, 142, 68, 132, 161, 190, 156, 83, 236, 93, 91, 206, 109, 127, 104, 45, 236, 179, 192, 43, 249, 129, 167, 107, 247, 244, 30, 255, 241, 229, 21, 120, 170, 189, 196, 223, 85, 207, 166, 16, 199, 222, 116, 90, 42, 62, 244, 138, 101, 173, 208, 43, 232, 241, 167, 125, 124, 218, 143, 63, 45, 60, 108, 21, 224, 233, 86, 65, 215, 122, 90, 161, 192, 208, 122, 76, 224, 241, 52, 44, 8, 137, 135, 36, 22, 132, 196, 67, 18, 11, 66, 226, 33, 31, 11, 232, 63, 39, 56, 32, 84, 70, 136, 72, 89, 243, 237, 133, 229, 89, 224, 231, 202, 56, 177, 30, 5, 204, 128, 239, 23, 151, 253, 240, 185, 52, 248, 129, 18, 120, 105, 196, 223, 225, 46, 247, 67, 220, 148, 152, 126, 197, 232, 31, 193, 11, 182, 156, 245, 44, 124, 59, 118, 61, 173, 68, 122, 135, 106, 193, 159, 29, 226, 195, 212, 158, 95, 67, 39, 107, 206, 214, 150, 140, 155, 36, 113, 80, 30, 10, 94, 56, 151, 18, 52, 252, 231, 140, 181, 18, 188, 4, 49, 125, 40, 106, 47, 94, 104, 207, 121, 227, 73, 48, 248, 47, 194, 43, 210, 113, 226, 223, 163, 102, 3, 170, 17, 184, 144, 87, 171, 128, 2, 231, 46, 34, 62, 93, 50, 60, 171, 24, 82, 11, 60, 12, 107, 133, 124, 42, 107, 142, 222, 79, 85, 151, 217, 232, 108, 153, 233, 2, 17, 236, 173, 45, 37, 202, 121, 116, 114, 254, 199, 106, 61, 139, 62, 37, 5, 19, 254, 196, 100, 73, 210, 202, 7, 199, 191, 10, 157, 28, 73, 24, 91, 88, 74, 202, 146, 229, 197, 76, 192, 215, 165, 237, 221, 157, 241, 157, 102, 36, 211, 213, 48, 50, 25, 234, 255, 168, 182, 123, 245, 39, 212, 190, 127, 140, 176, 6, 120, 85, 16, 156, 3, 107, 56, 41, 205, 221, 17, 216, 168, 221, 4, 209, 80, 231, 2, 223, 84, 157, 81, 149, 196, 190, 84, 100, 59, 17, 96, 240, 212, 244, 11, 243, 18, 187, 133, 10, 80, 68, 54, 2, 253, 40, 183, 143, 125, 127, 235, 204, 65, 155, 87, 105, 43, 129, 55, 43, 21, 113, 165, 75, 3, 116, 29, 207, 157, 35, 53, 218, 141, 229, 57, 184, 90, 228, 191, 44, 234, 73, 113, 64, 193, 246, 105, 172, 20, 139, 113, 166, 159, 92, 253, 9, 228, 87, 191, 216, 119, 126, 9, 144, 213, 67, 122, 224, 9, 146, 131, 181, 182, 6, 218, 31, 63, 221, 195, 131, 199, 127, 206, 127, 186, 71, 146, 224, 243, 37, 124, 249, 35, 33, 54, 35, 247, 212, 6, 166, 250, 64, 37, 246, 0, 208, 72, 163, 187, 240, 225, 228, 236, 28, 244, 66, 201, 95, 14, 135, 182, 239, 151, 161, 59, 125, 61, 205, 44, 98, 233, 212, 246, 2, 81, 16, 116, 81, 241, 64, 34, 17, 129, 142, 52, 254, 114, 188, 156, 78, 239, 158, 23, 65, 207, 252, 65, 81, 108, 237, 118, 226, 224, 94, 62, 235, 6, 87, 141, 181, 159, 238, 161, 145, 199, 63, 84, 130, 237, 14, 105, 235, 60, 232, 45, 182, 243, 39, 33, 134, 210, 247, 199, 103, 209, 111, 161, 226, 185, 188, 37, 197, 112, 127, 47, 37, 133, 108, 253, 117, 143, 190, 148, 236, 27, 160, 224, 48, 54, 80, 105, 72, 139, 254, 124, 237, 106, 108, 161, 182, 167, 21, 181, 45, 141, 23, 135, 79, 69, 77, 209, 161, 18, 167, 89, 43, 22, 48, 155, 215, 73, 51, 60, 131, 215, 216, 126, 88, 34, 253, 26, 255, 113, 169, 99, 189, 82, 220, 227, 86, 228, 155, 61, 92, 6, 169, 158, 80, 176, 122, 13, 118, 199, 71, 254, 58, 29, 192, 56, 157, 244, 3, 247, 150, 228, 0, 46, 65, 99, 141, 193, 129, 27, 245, 227, 125, 17, 49, 108, 233, 57, 101, 109, 100, 5, 86, 89, 155, 217, 193, 196, 5, 126, 13, 175, 100, 250, 97, 32, 105, 223, 38, 56, 88, 230, 246, 173, 246, 247, 247, 71, 239, 130, 96, 33, 106, 75, 184, 65, 153, 170, 187, 176, 231, 37, 1, 70, 140, 209, 144, 226, 137, 103, 143, 65, 165, 140, 252, 79, 78, 48, 41, 129, 111, 170, 131, 68, 171, 10, 129, 16, 43, 31, 111, 105, 84, 105, 75, 35, 164, 105, 107, 82, 188, 125, 223, 14, 56, 102, 239, 108, 220, 148, 82, 42, 238, 179, 197, 243, 202, 249, 221, 2, 7, 96, 17, 61, 155, 109, 176, 207, 206, 188, 152, 170, 59, 31, 149, 144, 17, 178, 170, 33, 162, 230, 30, 0, 187, 195, 229, 113, 155, 45, 196, 160, 194, 22, 156, 44, 37, 101, 5, 197, 40, 152, 56, 126, 149, 106, 157, 97, 45, 237, 57, 24, 170, 134, 206, 181, 119, 194, 48, 50, 109, 42, 134, 56, 152, 60, 172, 203, 214, 226, 193, 190, 13, 48, 118, 217, 79, 91, 210, 43, 149, 136, 14, 175, 34, 157, 194, 81, 240, 23, 0, 222, 70, 119, 45, 57, 174, 211, 230, 89, 224, 128, 134, 84, 18, 35, 101, 75, 49, 41, 163, 182, 174, 145, 247, 172, 57, 193, 124, 124, 237, 122, 206, 95, 212, 133, 69, 61, 211, 190, 169, 253, 34, 220, 96, 229, 35, 8, 133, 233, 242, 1, 79, 44, 35, 153, 175, 161, 235, 126, 113, 108, 97, 86, 250, 90, 17, 148, 55, 8, 17, 122, 9, 187, 218, 176, 74, 135, 5, 184, 228, 29, 156, 125, 216, 63, 57, 254, 240, 249, 236, 224, 236, 236, 240, 228, 120, 0, 10, 165, 159, 242, 253, 120, 11, 47, 197, 39, 201, 85, 72, 3, 224, 142, 17, 186, 121, 224, 139, 92, 149, 36, 254, 8, 140, 94, 89, 190, 51, 4, 172, 192, 202, 233, 89, 198, 59, 54, 165, 138, 220, 101, 218, 159, 247, 6, 103, 100, 49, 86, 72, 90, 143, 166, 107, 32, 223, 105, 135, 60, 195, 222, 80, 63, 41, 20, 225, 10, 37, 24, 159, 64, 178, 185, 192, 187, 243, 247, 71, 220, 148, 42, 117, 234, 115, 209, 156, 246, 240, 16, 54, 77, 162, 93, 44, 102, 41, 90, 214, 203, 65, 98, 206, 50, 132, 33, 21, 216, 124, 218, 82, 42, 46, 178, 116, 108, 144, 156, 167, 20, 143, 93, 134, 58, 56, 182, 160, 18, 171, 197, 156, 122, 108, 90, 197, 66, 4, 88, 53, 218, 166, 198, 246, 202, 100, 212, 77, 112, 198, 90, 128, 42, 28, 237, 227, 145, 162, 82, 144, 30, 125, 113, 97, 83, 153, 128, 103, 106, 150, 48, 42, 226, 51, 128, 116, 137, 51, 20, 57, 40, 37, 184, 29, 142, 10, 21, 199, 200, 215, 231, 195, 42, 160, 205, 38, 33, 136, 172, 238, 33, 41, 65, 7, 42, 183, 19, 57, 78, 129, 51, 79, 58, 241, 57, 100, 74, 99, 156, 19, 65, 110, 58, 195, 191, 151, 213, 227, 196, 150, 234, 98, 233, 79, 74, 217, 184, 224, 102, 215, 30, 3, 123, 97, 92, 150, 51, 203, 57, 254, 107, 199, 19, 5, 205, 75, 70, 37, 90, 155, 98, 118, 29, 90, 177, 230, 85, 106, 151, 106, 98, 245, 181, 250, 153, 145, 226, 187, 224, 97, 148, 198, 102, 89, 27, 215, 104, 152, 142, 205, 42, 226, 79, 22, 113, 106, 239, 187, 51, 152, 246, 216, 165, 113, 141, 158, 234, 186, 98, 236, 73, 253, 138, 48, 69, 199, 250, 249, 99, 110, 6, 242, 203, 71, 88, 206, 208, 99, 17, 170, 172, 222, 144, 96, 84, 41, 28, 119, 228, 248, 65, 213, 26, 141, 192, 17, 22, 123, 13, 138, 42, 148, 35, 52, 144, 170, 215, 206, 77, 14, 10, 35, 231, 38, 171, 125, 94, 57, 29, 33, 193, 13, 27, 197, 117, 234, 208, 70, 130, 67, 220, 71, 128, 213, 216, 86, 130, 226, 74, 132, 15, 135, 100, 146, 74, 200, 230, 42, 73, 17, 152, 143, 40, 206, 211, 19, 225, 33, 29, 184, 226, 206, 237, 99, 152, 232, 148, 18, 94, 76, 18, 37, 4, 153, 166, 131, 214, 14, 139, 107, 213, 98, 138, 236, 20, 67, 157, 88, 211, 160, 112, 103, 22, 41, 56, 174, 35, 228, 243, 198, 117, 216, 10, 223, 35, 130, 100, 103, 248, 213, 201, 153, 23, 184, 145, 60, 60, 153, 182, 86, 146, 145, 53, 84, 214, 172, 26, 78, 195, 79, 198, 228, 65, 102, 176, 46, 102, 127, 68, 131, 96, 126, 194, 182, 87, 42, 174, 144, 208, 16, 91, 10, 166, 230, 21, 205, 208, 102, 9, 159, 41, 30, 161, 21, 224, 183, 72, 54, 104, 48, 231, 55, 18, 115, 6, 178, 139, 62, 110, 164, 112, 133, 240, 203, 86, 75, 244, 240, 234, 113, 122, 134, 187, 50, 178, 7, 42, 238, 197, 200, 27, 169, 88, 61, 102, 173, 87, 112, 34, 11, 89, 132, 147, 133, 172, 172, 145, 146, 245, 0, 86, 62, 141, 160, 173, 214, 82, 69, 153, 67, 234, 249, 122, 99, 138, 115, 212, 190, 197, 109, 22, 199, 20, 64, 137, 133, 172, 215, 82, 26, 92, 102, 5, 136, 205, 116, 7, 254, 99, 212, 198, 185, 20, 193, 203, 34, 51, 217, 236, 102, 106, 65, 80, 137, 98, 93, 42, 41, 134, 125, 114, 214, 168, 24, 75, 61, 213, 195, 112, 198, 24, 202, 84, 254, 152, 89, 221, 55, 162, 95, 194, 37, 139, 77, 122, 229, 71, 246, 8, 239, 141, 85, 173, 109, 216, 17, 68, 214, 127, 123, 55, 108, 160, 186, 178, 70, 54, 99, 154, 190, 177, 179, 46, 193, 203, 168, 252, 148, 5, 145, 156, 240, 206, 179, 164, 127, 152, 154, 7, 243, 179, 39, 242, 36, 88, 101, 74, 126, 172, 53, 37, 189, 165, 104, 7, 140, 168, 170, 117, 165, 61, 205, 94, 147, 76, 83, 175, 176, 107, 73, 70, 196, 180, 4, 174, 83, 165, 227, 2, 121, 129, 170, 116, 164, 170, 136, 51, 99, 152, 53, 255, 103, 134, 170, 216, 212, 124, 91, 224, 94, 84, 198, 173, 194, 56, 13, 230, 249, 2, 22, 93, 77, 221, 171, 98, 42, 12, 69, 59, 239, 96, 28, 171, 230, 237, 220, 82, 65, 61, 40, 97, 87, 57, 231, 207, 241, 160, 70, 16, 130, 239, 171, 22, 108, 88, 128, 236, 53, 168, 35, 87, 81, 85, 17, 213, 17, 33, 53, 170, 194, 142, 225, 167, 172, 31, 131, 61, 117, 230, 95, 178, 205, 102, 193, 42, 232, 125, 109, 123, 91, 59, 241, 96, 20, 223, 93, 217, 24, 241, 209, 96, 202, 55, 246, 220, 153, 22, 76, 108, 33, 63, 33, 128, 120, 16, 31, 128, 87, 3, 194, 18, 89, 246, 249, 106, 106, 205, 191, 36, 180, 40, 149, 161, 254, 24, 104, 31, 79, 143, 56, 2, 44, 200, 15, 223, 75, 200, 47, 93, 81, 69, 244, 22, 142, 42, 137, 63, 138, 146, 164, 92, 101, 71, 236, 49, 209, 109, 20, 86, 36, 97, 205, 16, 234, 72, 227, 38, 69, 90, 14, 136, 255, 33, 237, 88, 213, 10, 63, 221, 99, 217, 199, 194, 203, 63, 242, 66, 225, 92, 242, 168, 34, 200, 221, 130, 162, 65, 66, 230, 179, 172, 65, 142, 127, 185, 42, 18, 29, 95, 237, 69, 87, 31, 250, 230, 157, 235, 7, 159, 216, 177, 205, 15, 48, 167, 13, 237, 80, 106, 212, 64, 57, 105, 154, 15, 19, 244, 126, 4, 103, 98, 249, 239, 71, 205, 248, 58, 89, 200, 193, 217, 168, 137, 202, 49, 29, 77, 123, 255, 186, 41, 98, 105, 32, 101, 240, 13, 240, 1, 85, 77, 237, 133, 213, 125, 205, 119, 151, 222, 16, 38, 239, 120, 12, 217, 239, 109, 111, 95, 3, 182, 203, 171, 234, 208, 157, 109, 219, 179, 185, 217, 238, 108, 255, 233, 87, 160, 17, 2, 244, 92, 212, 43, 233, 247, 133, 165, 143, 91, 173, 61, 103, 24, 20, 250, 24, 38, 15, 6, 5, 190, 143, 223, 215, 156, 249, 141, 133, 57, 47, 240, 68, 77, 161, 236, 13, 10, 46, 73, 93, 97, 48, 192, 39, 48, 23, 103, 12, 40, 219, 3, 239, 37, 251, 216, 187, 127, 236, 219, 213, 127, 63, 251, 12, 152, 126, 62, 62, 249, 252, 233, 240, 248, 245, 201, 167, 23, 47, 74, 222, 224, 185, 169, 83, 3, 206, 224, 185, 247, 226, 69, 10, 148, 111, 79, 199, 101, 127, 240, 92, 174, 125, 124, 242, 250, 224, 243, 191, 159, 41, 74, 47, 60, 23, 195, 123, 47, 94, 240, 15, 213, 27, 219, 195, 0, 167, 226, 73, 21, 215, 226, 250, 254, 75, 123, 112, 13, 35, 197, 154, 246, 28, 64, 199, 30, 96, 123, 12, 161, 73, 121, 30, 111, 118, 255, 228, 253, 251, 147, 99, 117, 195, 44, 201, 196, 139, 23, 236, 111, 213, 254, 134, 9, 235, 252, 178, 59, 40, 8, 166, 70, 101, 217, 178, 197, 139, 23, 236, 111, 213, 154, 141, 202, 86, 188, 165, 189, 211, 211, 189, 127, 124, 126, 245, 241, 205, 155, 131, 83, 104, 44, 92, 233, 40, 60, 23, 48, 246, 60, 207, 186, 123, 181, 28, 143, 109, 175, 60, 30, 20, 12, 179, 86, 111, 52, 91, 237, 78, 215, 186, 26, 66, 225, 2, 23, 183, 66, 65, 47, 47, 7, 23, 102, 173, 83, 174, 215, 218, 173, 78, 185, 83, 239, 116, 90, 70, 167, 92, 169, 153, 141, 118, 163, 83, 111, 53, 58, 151, 229, 225, 224, 194, 40, 119, 202, 102, 171, 92, 107, 92, 150, 239, 6, 23, 133, 137, 253, 173, 80, 46, 88, 216, 8, 252, 29, 57, 215, 48, 232, 224, 195, 21, 53, 40, 222, 188, 18, 223, 174, 44, 223, 110, 53, 10, 151, 229, 197, 160, 176, 247, 106, 255, 245, 193, 155, 183, 239, 14, 255, 253, 151, 163, 247, 199, 39, 31, 254, 227, 244, 236, 252, 227, 175, 159, 254, 254, 143, 223, 24, 102, 215, 19, 231, 207, 47, 211, 217, 220, 93, 124, 245, 252, 96, 121, 115, 251, 237, 238, 175, 8, 251, 173, 109, 25, 243, 209, 224, 226, 178, 239, 140, 75, 150, 126, 143, 29, 50, 29, 160, 241, 147, 40, 47, 181, 58, 122, 127, 66, 79, 63, 58, 243, 160, 67, 175, 74, 83, 172, 40, 158, 213, 107, 226, 225, 35, 130, 184, 26, 208, 87, 152, 175, 208, 223, 190, 90, 172, 174, 30, 30, 74, 87, 131, 112, 52, 4, 250, 61, 139, 101, 22, 46, 88, 183, 51, 28, 46, 161, 71, 7, 124, 81, 21, 132, 43, 112, 177, 107, 170, 129, 123, 70, 94, 73, 21, 243, 94, 65, 213, 71, 38, 76, 55, 3, 9, 111, 104, 254, 87, 199, 190, 237, 63, 183, 30, 30, 50, 251, 253, 243, 225, 217, 231, 95, 15, 15, 96, 144, 220, 0, 58, 55, 42, 116, 146, 66, 24, 188, 120, 17, 84, 89, 31, 69, 159, 170, 100, 175, 188, 37, 174, 124, 3, 194, 18, 26, 28, 181, 219, 8, 180, 199, 24, 109, 11, 128, 30, 114, 191, 192, 220, 44, 164, 214, 214, 89, 203, 23, 94, 249, 185, 65, 93, 35, 112, 120, 14, 47, 31, 30, 230, 203, 233, 20, 138, 121, 122, 48, 1, 191, 136, 124, 21, 90, 176, 5, 156, 169, 31, 95, 188, 200, 65, 71, 192, 78, 116, 167, 167, 151, 159, 155, 212, 214, 243, 43, 248, 242, 226, 197, 243, 27, 248, 163, 106, 33, 194, 205, 188, 124, 44, 239, 41, 56, 166, 201, 148, 242, 71, 8, 226, 186, 244, 220, 208, 171, 204, 60, 192, 171, 139, 224, 178, 164, 63, 62, 150, 63, 167, 56, 227, 128, 42, 242, 192, 6, 57, 158, 93, 42, 12, 189, 187, 69, 224, 130, 156, 78, 162, 103, 124, 132, 232, 85, 70, 83, 223, 25, 76, 170, 104, 243, 1, 109, 185, 163, 121, 23, 191, 57, 61, 121, 255, 146, 21, 232, 41, 176, 69, 212, 38, 40, 67, 253, 36, 250, 182, 126, 31, 235, 25, 222, 95, 162, 127, 52, 159, 187, 3, 239, 44, 127, 82, 42, 128, 130, 47, 132, 228, 217, 229, 194, 50, 24, 119, 224, 1, 27, 214, 37, 26, 236, 212, 63, 172, 251, 236, 108, 222, 162, 11, 149, 213, 125, 164, 61, 19, 125, 103, 235, 122, 249, 10, 126, 63, 60, 220, 208, 239, 100, 245, 201, 203, 28, 68, 29, 172, 30, 71, 178, 231, 193, 51, 232, 152, 87, 249, 125, 91, 182, 99, 44, 156, 149, 80, 92, 35, 6, 136, 254, 237, 71, 211, 16, 4, 3, 12, 8, 244, 17, 24, 231, 193, 232, 194, 108, 209, 111, 252, 85, 195, 95, 117, 252, 213, 192, 95, 77, 252, 69, 111, 219, 248, 171, 131, 191, 186, 84, 152, 85, 164, 58, 38, 85, 50, 169, 150, 73, 213, 76, 168, 103, 148, 105, 49, 145, 18, 180, 249, 131, 17, 255, 70, 204, 235, 12, 38, 125, 190, 247, 71, 104, 59, 79, 169, 237, 98, 117, 210, 35, 69, 110, 32, 169, 2, 61, 253, 145, 154, 144, 203, 128, 222, 95, 241, 223, 37, 107, 114, 98, 12, 216, 95, 147, 255, 173, 241, 191, 245, 129, 88, 212, 245, 2, 246, 145, 78, 38, 241, 183, 175, 232, 51, 39, 28, 76, 24, 184, 13, 127, 217, 35, 254, 18, 186, 28, 62, 63, 55, 197, 91, 176, 7, 131, 231, 198, 99, 228, 252, 148, 130, 178, 208, 72, 101, 103, 112, 203, 181, 72, 48, 112, 112, 137, 195, 193, 197, 70, 122, 233, 195, 0, 188, 184, 4, 107, 29, 240, 165, 74, 48, 187, 70, 127, 12, 130, 107, 195, 95, 123, 103, 222, 223, 218, 178, 245, 18, 224, 84, 29, 78, 44, 111, 31, 236, 254, 94, 128, 194, 181, 3, 118, 241, 229, 228, 194, 221, 218, 186, 28, 248, 61, 127, 167, 102, 52, 58, 47, 75, 252, 129, 217, 173, 61, 248, 187, 187, 187, 173, 178, 120, 80, 235, 60, 180, 234, 47, 124, 29, 74, 54, 155, 181, 110, 235, 1, 222, 15, 154, 237, 122, 163, 17, 86, 170, 213, 26, 84, 201, 172, 201, 181, 8, 204, 139, 86, 61, 13, 9, 144, 106, 53, 155, 245, 214, 86, 169, 100, 26, 53, 124, 180, 179, 99, 26, 15, 244, 57, 134, 45, 82, 160, 139, 250, 181, 134, 193, 90, 233, 36, 91, 49, 107, 137, 102, 50, 155, 238, 7, 131, 201, 163, 96, 216, 110, 171, 1, 195, 55, 24, 164, 116, 97, 160, 87, 201, 212, 151, 116, 102, 43, 44, 100, 244, 24, 205, 114, 196, 222, 86, 131, 248, 75, 93, 177, 28, 4, 23, 246, 229, 195, 131, 209, 183, 224, 239, 160, 91, 251, 125, 89, 30, 227, 167, 102, 227, 247, 229, 163, 48, 138, 208, 221, 101, 33, 172, 188, 161, 49, 255, 234, 254, 98, 223, 125, 176, 70, 3, 139, 125, 165, 248, 3, 8, 5, 251, 230, 3, 63, 236, 209, 123, 123, 230, 122, 119, 3, 15, 192, 69, 102, 151, 129, 137, 169, 5, 20, 149, 152, 216, 165, 244, 90, 65, 188, 210, 172, 41, 237, 104, 208, 16, 63, 112, 179, 24, 177, 30, 19, 185, 96, 224, 161, 199, 142, 4, 115, 81, 68, 35, 0, 210, 7, 98, 103, 196, 165, 78, 26, 90, 192, 37, 121, 172, 246, 39, 32, 134, 17, 78, 76, 246, 145, 231, 241, 145, 224, 162, 250, 113, 81, 253, 148, 233, 55, 126, 198, 95, 53, 252, 85, 199, 95, 13, 252, 213, 196, 95, 244, 182, 141, 191, 58, 248, 171, 75, 133, 89, 117, 170, 99, 82, 37, 147, 106, 153, 84, 141, 148, 144, 94, 246, 117, 210, 50, 72, 144, 35, 141, 94, 68, 241, 197, 11, 135, 245, 231, 68, 135, 222, 141, 73, 224, 132, 143, 151, 241, 133, 131, 130, 100, 247, 108, 62, 94, 248, 3, 28, 47, 54, 141, 23, 241, 128, 137, 154, 173, 67, 73, 62, 94, 236, 112, 188, 240, 50, 56, 94, 108, 54, 94, 164, 90, 182, 16, 218, 20, 36, 64, 42, 54, 94, 236, 236, 241, 2, 248, 138, 250, 56, 94, 108, 54, 94, 18, 173, 176, 241, 178, 78, 211, 76, 61, 63, 145, 103, 238, 133, 3, 112, 107, 151, 15, 3, 123, 103, 103, 120, 81, 127, 129, 176, 67, 6, 70, 111, 75, 33, 19, 245, 168, 92, 89, 126, 47, 208, 137, 94, 43, 217, 43, 85, 137, 88, 156, 3, 83, 144, 189, 73, 179, 27, 246, 133, 140, 82, 216, 31, 43, 80, 162, 238, 249, 177, 104, 75, 102, 118, 69, 103, 114, 9, 8, 46, 38, 151, 107, 117, 126, 212, 48, 86, 137, 154, 100, 6, 20, 195, 145, 104, 13, 41, 36, 57, 112, 202, 145, 169, 220, 26, 56, 149, 8, 104, 217, 217, 29, 180, 160, 7, 37, 171, 234, 84, 90, 141, 114, 168, 40, 74, 122, 57, 166, 52, 12, 189, 39, 151, 125, 228, 142, 79, 4, 127, 183, 81, 235, 54, 186, 173, 118, 173, 219, 12, 21, 206, 43, 214, 112, 84, 104, 59, 44, 212, 218, 217, 49, 202, 73, 67, 78, 31, 127, 142, 202, 48, 28, 30, 203, 178, 10, 22, 202, 116, 32, 133, 17, 208, 107, 79, 40, 225, 251, 132, 47, 240, 220, 224, 241, 5, 89, 121, 122, 131, 52, 211, 250, 193, 133, 199, 25, 188, 4, 214, 122, 151, 101, 15, 228, 189, 21, 87, 162, 15, 15, 49, 70, 161, 58, 13, 72, 157, 210, 111, 252, 140, 191, 106, 248, 171, 142, 191, 26, 248, 171, 137, 191, 232, 109, 27, 127, 117, 240, 87, 151, 10, 179, 234, 84, 199, 164, 74, 38, 213, 50, 169, 26, 87, 167, 252, 107, 200, 166, 157, 157, 122, 153, 189, 148, 120, 13, 15, 31, 164, 46, 1, 50, 186, 114, 151, 62, 198, 89, 137, 15, 101, 54, 18, 131, 202, 224, 215, 162, 237, 41, 99, 96, 66, 98, 86, 63, 114, 159, 94, 122, 131, 82, 9, 127, 2, 250, 153, 3, 249, 149, 86, 199, 232, 180, 91, 221, 122, 27, 70, 65, 251, 33, 192, 166, 155, 122, 165, 214, 54, 219, 245, 122, 167, 221, 133, 222, 214, 127, 135, 161, 92, 194, 159, 232, 241, 239, 32, 233, 37, 252, 169, 192, 131, 90, 179, 211, 48, 187, 141, 223, 107, 134, 209, 168, 155, 29, 163, 109, 190, 8, 244, 173, 57, 240, 178, 98, 154, 237, 78, 221, 104, 27, 56, 146, 205, 218, 3, 141, 0, 67, 223, 10, 16, 236, 11, 25, 94, 160, 99, 141, 26, 214, 168, 181, 26, 80, 169, 221, 196, 42, 109, 54, 206, 155, 250, 150, 195, 170, 56, 188, 100, 29, 74, 214, 205, 86, 173, 217, 173, 25, 93, 40, 89, 171, 61, 96, 239, 155, 0, 28, 116, 168, 209, 43, 113, 129, 153, 24, 66, 88, 38, 102, 217, 22, 206, 105, 153, 24, 177, 37, 56, 177, 69, 180, 112, 135, 85, 255, 221, 131, 169, 202, 239, 14, 53, 35, 49, 168, 37, 51, 104, 203, 147, 24, 3, 213, 61, 206, 16, 248, 104, 255, 30, 188, 128, 239, 182, 206, 89, 80, 239, 116, 155, 173, 70, 179, 211, 82, 178, 32, 248, 221, 227, 148, 111, 181, 140, 150, 105, 52, 59, 102, 119, 37, 225, 70, 163, 209, 172, 53, 235, 117, 35, 77, 184, 158, 38, 205, 145, 9, 106, 64, 245, 118, 171, 97, 118, 58, 221, 246, 83, 8, 106, 94, 110, 153, 152, 162, 176, 99, 52, 106, 249, 20, 181, 160, 165, 6, 8, 71, 221, 172, 55, 204, 92, 146, 218, 151, 149, 70, 179, 109, 52, 187, 157, 122, 154, 160, 21, 244, 116, 0, 159, 118, 219, 48, 234, 205, 134, 249, 164, 30, 234, 2, 154, 93, 20, 224, 70, 195, 108, 231, 18, 4, 163, 189, 210, 168, 25, 100, 78, 178, 137, 49, 81, 234, 187, 93, 163, 97, 0, 66, 181, 141, 233, 1, 53, 178, 5, 67, 168, 209, 50, 234, 173, 78, 237, 73, 34, 7, 18, 210, 48, 128, 231, 166, 97, 230, 211, 131, 178, 208, 52, 160, 55, 107, 181, 174, 145, 79, 20, 117, 123, 189, 213, 172, 55, 235, 181, 110, 30, 81, 2, 37, 192, 230, 69, 68, 34, 80, 23, 27, 19, 102, 171, 217, 238, 182, 154, 38, 182, 218, 100, 4, 182, 5, 129, 145, 244, 24, 173, 110, 211, 48, 91, 117, 100, 67, 151, 81, 81, 231, 84, 32, 193, 33, 39, 2, 100, 160, 196, 255, 173, 86, 163, 14, 138, 165, 109, 82, 79, 53, 132, 47, 193, 136, 138, 6, 118, 189, 13, 67, 179, 93, 55, 168, 147, 12, 70, 79, 237, 9, 244, 52, 47, 43, 109, 195, 108, 194, 8, 239, 154, 153, 244, 128, 240, 108, 213, 59, 64, 141, 65, 66, 190, 62, 57, 0, 189, 213, 50, 80, 35, 214, 155, 217, 228, 52, 176, 207, 193, 219, 106, 119, 26, 157, 239, 36, 167, 123, 185, 213, 108, 117, 26, 13, 96, 98, 39, 155, 28, 148, 29, 195, 236, 118, 64, 76, 73, 118, 214, 38, 8, 245, 87, 167, 93, 111, 213, 187, 45, 51, 155, 30, 28, 214, 208, 243, 205, 58, 8, 168, 249, 157, 4, 225, 128, 128, 209, 221, 104, 117, 204, 70, 171, 157, 73, 18, 216, 158, 166, 9, 3, 7, 88, 184, 9, 61, 109, 84, 64, 56, 44, 58, 160, 236, 178, 9, 50, 209, 180, 117, 107, 208, 149, 109, 112, 193, 243, 40, 154, 12, 66, 162, 96, 250, 143, 68, 252, 30, 210, 229, 3, 52, 38, 113, 128, 38, 72, 28, 192, 105, 48, 98, 58, 156, 24, 198, 188, 74, 13, 198, 116, 179, 13, 52, 19, 74, 38, 35, 198, 12, 137, 145, 212, 200, 4, 200, 231, 195, 198, 236, 212, 187, 70, 221, 104, 146, 218, 50, 91, 140, 142, 22, 167, 67, 244, 58, 144, 106, 116, 155, 77, 212, 181, 181, 58, 145, 208, 125, 2, 5, 168, 3, 16, 16, 88, 239, 150, 161, 166, 162, 129, 42, 167, 93, 235, 116, 65, 240, 215, 165, 162, 141, 96, 155, 141, 110, 155, 41, 13, 37, 13, 6, 74, 110, 23, 58, 203, 104, 53, 140, 239, 164, 162, 14, 186, 166, 3, 88, 118, 205, 118, 67, 77, 5, 234, 153, 102, 7, 6, 102, 173, 86, 91, 147, 8, 16, 87, 40, 221, 172, 153, 221, 118, 55, 131, 136, 214, 229, 86, 187, 101, 212, 186, 102, 167, 251, 125, 20, 128, 245, 3, 46, 212, 91, 141, 70, 167, 173, 38, 0, 5, 183, 81, 51, 59, 102, 179, 195, 20, 208, 58, 194, 4, 230, 2, 122, 183, 221, 0, 42, 140, 12, 18, 0, 108, 183, 11, 62, 76, 7, 204, 64, 14, 13, 209, 248, 150, 71, 119, 201, 123, 248, 87, 168, 199, 65, 11, 181, 234, 6, 104, 44, 0, 211, 98, 4, 180, 56, 1, 15, 255, 178, 195, 65, 10, 126, 101, 167, 107, 54, 204, 38, 155, 135, 18, 17, 53, 65, 132, 60, 184, 75, 206, 195, 191, 36, 45, 215, 64, 61, 212, 232, 26, 84, 175, 201, 8, 105, 115, 66, 30, 254, 21, 8, 19, 0, 163, 173, 142, 42, 24, 105, 49, 217, 208, 54, 55, 37, 134, 140, 63, 56, 51, 13, 24, 219, 109, 51, 155, 28, 210, 161, 48, 215, 234, 128, 58, 105, 109, 64, 14, 137, 126, 211, 108, 214, 234, 57, 180, 152, 168, 61, 128, 224, 26, 136, 117, 247, 123, 168, 65, 29, 14, 154, 30, 252, 191, 122, 179, 155, 77, 12, 90, 56, 24, 139, 48, 83, 160, 30, 92, 147, 22, 244, 15, 154, 45, 180, 64, 96, 85, 243, 168, 129, 33, 106, 130, 162, 49, 155, 102, 171, 241, 93, 228, 144, 44, 52, 129, 119, 48, 157, 201, 161, 134, 38, 61, 160, 126, 77, 176, 36, 221, 245, 233, 129, 158, 111, 3, 183, 58, 237, 26, 241, 42, 139, 28, 24, 175, 117, 144, 51, 144, 15, 54, 106, 18, 196, 72, 83, 189, 82, 24, 151, 223, 10, 167, 104, 245, 176, 204, 196, 28, 120, 177, 73, 94, 89, 132, 237, 109, 105, 70, 23, 61, 175, 15, 156, 45, 81, 188, 19, 111, 9, 87, 232, 123, 165, 248, 42, 128, 65, 180, 150, 227, 75, 2, 38, 113, 170, 28, 95, 31, 168, 73, 136, 139, 197, 130, 73, 157, 17, 157, 152, 244, 218, 223, 228, 57, 111, 44, 76, 80, 210, 229, 32, 65, 198, 156, 47, 156, 225, 133, 203, 101, 23, 216, 133, 141, 23, 168, 174, 198, 32, 135, 47, 2, 252, 27, 176, 192, 18, 123, 136, 95, 58, 210, 231, 154, 33, 125, 49, 91, 242, 155, 88, 49, 1, 212, 139, 55, 224, 137, 103, 97, 3, 158, 212, 128, 39, 55, 224, 201, 13, 120, 114, 3, 158, 220, 128, 29, 111, 192, 22, 207, 194, 6, 108, 169, 1, 91, 110, 192, 150, 27, 176, 229, 6, 108, 185, 1, 39, 222, 128, 35, 158, 133, 13, 56, 82, 3, 142, 220, 128, 35, 55, 224, 200, 13, 56, 97, 3, 241, 46, 22, 139, 227, 131, 68, 191, 199, 10, 177, 21, 191, 31, 43, 10, 23, 181, 38, 244, 126, 153, 245, 54, 124, 46, 243, 238, 21, 31, 1, 89, 252, 136, 165, 188, 178, 23, 150, 242, 162, 82, 94, 188, 148, 93, 182, 195, 82, 118, 84, 202, 142, 151, 114, 202, 78, 88, 202, 137, 74, 57, 97, 169, 4, 127, 104, 173, 101, 144, 102, 70, 186, 16, 91, 18, 92, 205, 164, 228, 26, 34, 152, 232, 178, 151, 90, 26, 140, 22, 120, 61, 138, 152, 9, 206, 82, 180, 140, 51, 215, 163, 168, 153, 8, 175, 80, 244, 140, 177, 184, 28, 196, 137, 96, 43, 30, 131, 12, 148, 227, 69, 105, 227, 136, 76, 133, 88, 101, 225, 209, 174, 65, 161, 80, 230, 33, 72, 190, 14, 133, 139, 46, 253, 9, 232, 207, 190, 30, 12, 252, 139, 9, 134, 124, 61, 241, 193, 22, 31, 64, 207, 47, 216, 64, 189, 220, 90, 92, 180, 234, 48, 41, 70, 231, 135, 70, 171, 46, 30, 129, 182, 18, 209, 118, 254, 200, 190, 20, 124, 32, 216, 73, 56, 8, 227, 69, 11, 12, 78, 97, 48, 40, 60, 150, 103, 17, 37, 108, 229, 76, 126, 146, 21, 14, 85, 69, 76, 163, 101, 49, 93, 90, 246, 226, 93, 202, 151, 192, 76, 89, 234, 57, 47, 250, 242, 130, 90, 106, 133, 44, 190, 192, 38, 175, 174, 37, 222, 232, 229, 21, 72, 61, 62, 82, 227, 39, 169, 144, 228, 96, 79, 236, 30, 240, 105, 253, 240, 51, 0, 3, 224, 124, 77, 95, 46, 46, 111, 182, 120, 132, 18, 201, 245, 186, 104, 63, 134, 168, 93, 146, 54, 100, 60, 134, 171, 111, 30, 244, 190, 183, 115, 39, 146, 117, 108, 109, 133, 91, 86, 238, 46, 188, 203, 62, 174, 62, 2, 82, 182, 30, 134, 193, 31, 129, 77, 39, 213, 217, 168, 57, 56, 41, 211, 223, 234, 100, 102, 13, 211, 148, 188, 18, 148, 164, 177, 15, 18, 187, 9, 2, 93, 73, 129, 180, 235, 32, 164, 193, 147, 118, 29, 108, 70, 196, 171, 4, 17, 229, 249, 203, 248, 222, 178, 193, 73, 175, 100, 115, 194, 92, 177, 153, 172, 84, 74, 243, 252, 228, 81, 215, 245, 71, 177, 225, 49, 220, 110, 24, 165, 31, 17, 123, 28, 249, 158, 194, 228, 86, 195, 147, 243, 48, 223, 1, 238, 87, 116, 3, 139, 111, 118, 236, 24, 125, 249, 233, 123, 235, 219, 17, 17, 4, 175, 76, 163, 214, 136, 189, 60, 244, 63, 249, 241, 61, 142, 34, 127, 203, 62, 219, 5, 106, 143, 246, 39, 203, 249, 151, 147, 241, 216, 167, 77, 175, 113, 216, 251, 108, 183, 108, 94, 17, 204, 190, 142, 247, 103, 96, 227, 120, 172, 92, 74, 21, 4, 111, 63, 249, 7, 152, 50, 1, 113, 136, 246, 133, 238, 125, 60, 127, 215, 211, 138, 123, 210, 217, 199, 211, 131, 253, 147, 227, 227, 131, 253, 243, 195, 147, 99, 120, 117, 42, 189, 58, 59, 223, 59, 61, 255, 76, 27, 65, 255, 113, 118, 126, 240, 30, 94, 127, 84, 188, 62, 125, 255, 105, 239, 244, 0, 94, 46, 165, 151, 159, 78, 15, 207, 241, 217, 39, 233, 25, 176, 28, 158, 28, 195, 147, 232, 209, 233, 233, 201, 41, 60, 60, 144, 225, 126, 220, 223, 167, 4, 187, 197, 51, 233, 41, 162, 254, 57, 122, 101, 73, 175, 142, 15, 254, 126, 254, 121, 255, 221, 199, 227, 95, 224, 197, 190, 244, 226, 195, 225, 241, 91, 120, 244, 161, 248, 76, 222, 204, 27, 110, 183, 144, 175, 70, 1, 41, 193, 109, 178, 101, 237, 214, 63, 181, 249, 157, 35, 80, 38, 189, 41, 125, 97, 121, 190, 125, 108, 205, 112, 107, 55, 157, 56, 162, 13, 176, 248, 65, 219, 210, 74, 169, 204, 94, 47, 181, 34, 166, 241, 40, 86, 198, 138, 172, 43, 108, 127, 105, 118, 30, 167, 176, 173, 82, 49, 126, 217, 75, 108, 115, 127, 216, 229, 31, 232, 142, 162, 181, 193, 209, 101, 27, 106, 72, 71, 236, 58, 163, 181, 65, 177, 91, 67, 138, 122, 154, 68, 76, 117, 127, 34, 1, 84, 237, 84, 22, 168, 103, 38, 193, 138, 111, 137, 94, 11, 163, 196, 197, 72, 128, 90, 126, 138, 45, 9, 23, 134, 235, 122, 39, 123, 146, 197, 217, 133, 174, 48, 82, 241, 176, 192, 207, 69, 245, 78, 114, 198, 25, 166, 38, 99, 188, 89, 216, 30, 158, 78, 85, 179, 72, 217, 206, 123, 60, 248, 49, 115, 230, 37, 80, 1, 101, 45, 172, 191, 178, 113, 188, 77, 213, 159, 64, 227, 116, 4, 193, 243, 54, 104, 178, 136, 169, 182, 147, 108, 3, 206, 112, 117, 84, 42, 229, 102, 191, 129, 182, 96, 76, 224, 111, 212, 38, 236, 2, 36, 145, 69, 125, 141, 164, 43, 171, 242, 219, 148, 181, 86, 211, 200, 216, 192, 143, 59, 240, 249, 48, 199, 172, 24, 92, 71, 171, 50, 95, 185, 83, 60, 154, 125, 93, 42, 80, 110, 116, 112, 223, 181, 79, 103, 26, 88, 5, 141, 73, 85, 181, 144, 104, 54, 38, 228, 37, 245, 241, 9, 218, 235, 63, 96, 67, 190, 74, 155, 249, 105, 87, 124, 242, 60, 45, 96, 117, 230, 14, 191, 144, 186, 71, 227, 251, 201, 190, 98, 223, 75, 197, 91, 220, 207, 142, 249, 115, 210, 27, 241, 75, 212, 229, 61, 124, 41, 172, 21, 158, 89, 185, 245, 147, 60, 164, 68, 97, 184, 21, 72, 157, 183, 196, 158, 143, 142, 237, 111, 204, 234, 0, 2, 150, 127, 55, 31, 102, 30, 46, 64, 126, 170, 45, 213, 46, 63, 246, 137, 231, 232, 243, 14, 168, 135, 124, 222, 155, 78, 137, 191, 67, 4, 226, 35, 30, 65, 138, 201, 146, 92, 50, 142, 176, 211, 24, 146, 169, 171, 130, 129, 249, 81, 169, 25, 134, 156, 5, 140, 142, 169, 51, 180, 213, 180, 150, 51, 140, 245, 86, 204, 65, 208, 179, 242, 59, 176, 169, 3, 178, 250, 214, 114, 120, 171, 242, 228, 161, 164, 58, 162, 201, 170, 78, 108, 174, 54, 18, 155, 34, 47, 100, 142, 144, 25, 150, 183, 166, 24, 250, 101, 54, 72, 24, 136, 87, 184, 235, 62, 13, 148, 53, 70, 107, 249, 220, 229, 217, 226, 184, 75, 207, 148, 84, 50, 136, 152, 204, 135, 3, 41, 107, 198, 170, 130, 137, 198, 89, 67, 122, 89, 51, 179, 80, 23, 130, 244, 199, 25, 136, 4, 142, 215, 80, 152, 180, 159, 238, 149, 29, 244, 88, 173, 254, 116, 31, 106, 207, 117, 250, 176, 44, 201, 180, 50, 247, 86, 66, 48, 5, 69, 234, 146, 170, 230, 6, 177, 246, 250, 25, 167, 121, 34, 69, 147, 129, 246, 191, 161, 63, 168, 107, 219, 18, 190, 9, 45, 153, 182, 121, 28, 113, 119, 142, 71, 233, 114, 142, 151, 202, 204, 46, 34, 147, 111, 237, 43, 159, 233, 43, 238, 52, 65, 23, 42, 143, 79, 211, 249, 167, 252, 60, 68, 107, 26, 146, 48, 193, 75, 194, 255, 205, 75, 27, 144, 237, 213, 173, 212, 77, 72, 165, 227, 131, 6, 137, 234, 23, 86, 36, 42, 200, 81, 81, 178, 187, 205, 84, 185, 72, 139, 148, 119, 136, 54, 43, 231, 224, 154, 141, 162, 239, 188, 126, 99, 234, 3, 187, 101, 173, 110, 24, 171, 243, 155, 229, 136, 150, 184, 61, 100, 32, 237, 234, 191, 33, 119, 69, 109, 91, 158, 211, 91, 60, 163, 202, 62, 85, 41, 159, 215, 58, 230, 4, 187, 140, 85, 134, 142, 11, 207, 18, 149, 53, 231, 122, 238, 210, 81, 149, 194, 247, 155, 9, 178, 164, 55, 44, 71, 36, 106, 156, 129, 22, 33, 9, 188, 22, 249, 65, 149, 85, 248, 201, 80, 169, 122, 202, 23, 16, 76, 144, 202, 15, 180, 152, 173, 195, 153, 83, 22, 55, 200, 196, 199, 91, 144, 142, 15, 155, 43, 45, 235, 112, 234, 250, 182, 50, 155, 93, 148, 176, 51, 19, 51, 62, 73, 91, 133, 91, 34, 155, 221, 19, 144, 97, 135, 191, 185, 35, 251, 84, 108, 163, 201, 99, 22, 194, 57, 115, 118, 165, 2, 238, 103, 40, 54, 201, 183, 90, 7, 89, 33, 87, 113, 116, 229, 105, 112, 94, 66, 39, 22, 245, 88, 157, 160, 194, 147, 189, 8, 116, 141, 79, 109, 165, 19, 27, 31, 37, 228, 12, 68, 103, 152, 215, 200, 69, 192, 125, 22, 203, 199, 41, 4, 30, 242, 76, 30, 229, 96, 48, 61, 219, 95, 78, 131, 85, 137, 96, 132, 183, 226, 121, 203, 5, 24, 156, 119, 12, 106, 193, 40, 192, 192, 195, 38, 214, 144, 117, 165, 222, 120, 203, 78, 148, 130, 3, 132, 231, 75, 49, 229, 18, 176, 190, 167, 9, 176, 43, 64, 109, 111, 199, 161, 237, 11, 252, 168, 50, 3, 19, 195, 121, 51, 43, 162, 138, 45, 196, 134, 93, 44, 28, 3, 211, 43, 213, 75, 17, 202, 209, 215, 38, 233, 63, 27, 139, 117, 57, 242, 184, 90, 32, 241, 207, 158, 47, 7, 255, 209, 3, 202, 128, 185, 210, 166, 38, 8, 255, 161, 116, 103, 37, 197, 120, 186, 113, 37, 37, 25, 51, 173, 89, 102, 149, 244, 239, 250, 102, 20, 75, 51, 217, 101, 21, 87, 169, 225, 188, 82, 27, 206, 194, 98, 142, 38, 247, 50, 193, 160, 19, 169, 163, 170, 22, 122, 116, 218, 173, 3, 243, 199, 43, 91, 179, 130, 192, 158, 209, 136, 115, 230, 148, 105, 182, 36, 133, 73, 183, 201, 77, 164, 137, 50, 40, 99, 168, 58, 242, 171, 197, 181, 157, 243, 65, 166, 25, 72, 67, 72, 249, 176, 202, 64, 35, 101, 142, 40, 75, 17, 156, 166, 129, 49, 156, 88, 96, 87, 250, 2, 94, 125, 181, 174, 175, 240, 228, 147, 12, 150, 108, 10, 111, 119, 189, 112, 199, 187, 243, 243, 15, 121, 1, 143, 220, 144, 198, 51, 85, 18, 50, 149, 192, 229, 135, 77, 228, 228, 250, 222, 236, 181, 69, 177, 42, 178, 82, 252, 107, 73, 157, 254, 144, 222, 241, 44, 48, 165, 34, 155, 51, 21, 217, 228, 45, 187, 137, 48, 209, 2, 154, 179, 25, 26, 206, 76, 139, 38, 236, 166, 40, 158, 159, 72, 55, 222, 59, 244, 58, 158, 174, 164, 184, 205, 110, 208, 222, 102, 152, 82, 128, 71, 25, 70, 30, 243, 207, 20, 78, 38, 110, 223, 249, 32, 238, 148, 151, 4, 81, 198, 50, 47, 113, 117, 4, 33, 224, 247, 30, 38, 113, 201, 178, 227, 232, 139, 242, 112, 33, 91, 88, 200, 197, 152, 139, 129, 59, 95, 120, 238, 181, 199, 82, 219, 150, 196, 231, 21, 214, 223, 25, 135, 37, 249, 250, 15, 230, 59, 92, 210, 237, 175, 122, 190, 211, 128, 75, 68, 51, 11, 147, 180, 135, 16, 232, 74, 187, 254, 202, 90, 34, 217, 136, 84, 147, 98, 212, 163, 126, 126, 90, 183, 136, 37, 98, 178, 202, 167, 211, 219, 128, 199, 58, 185, 220, 34, 121, 22, 193, 216, 141, 103, 90, 43, 250, 130, 172, 145, 144, 115, 125, 69, 225, 13, 211, 29, 127, 79, 234, 227, 239, 74, 131, 156, 107, 131, 72, 27, 241, 123, 237, 195, 148, 179, 12, 26, 179, 76, 18, 120, 61, 63, 14, 176, 34, 37, 248, 90, 179, 10, 133, 114, 141, 211, 167, 25, 171, 224, 131, 50, 62, 224, 211, 160, 244, 165, 8, 217, 200, 128, 75, 185, 156, 142, 230, 69, 17, 191, 231, 42, 26, 25, 83, 166, 28, 59, 87, 174, 229, 141, 138, 190, 22, 133, 42, 180, 177, 5, 170, 98, 84, 45, 124, 111, 120, 225, 169, 40, 203, 249, 235, 153, 26, 17, 241, 57, 134, 56, 235, 193, 82, 42, 195, 53, 206, 251, 37, 182, 138, 71, 197, 131, 162, 30, 115, 239, 159, 50, 190, 214, 240, 63, 86, 207, 161, 158, 54, 127, 218, 116, 238, 244, 195, 230, 77, 63, 104, 206, 244, 131, 230, 75, 63, 114, 174, 20, 37, 73, 90, 221, 104, 84, 118, 29, 232, 143, 249, 157, 184, 246, 124, 35, 45, 136, 57, 3, 46, 66, 113, 117, 180, 109, 133, 247, 39, 173, 125, 145, 143, 70, 247, 112, 160, 172, 46, 167, 146, 13, 101, 239, 98, 185, 175, 226, 169, 160, 248, 126, 136, 228, 54, 137, 163, 147, 183, 111, 15, 143, 223, 202, 91, 37, 248, 125, 195, 124, 187, 68, 35, 12, 203, 10, 72, 82, 21, 85, 86, 116, 188, 220, 57, 43, 41, 58, 94, 15, 12, 238, 146, 20, 205, 43, 190, 61, 160, 220, 87, 63, 32, 19, 122, 34, 71, 181, 124, 135, 143, 0, 10, 237, 109, 21, 51, 215, 113, 230, 108, 67, 128, 72, 71, 157, 85, 12, 47, 9, 30, 132, 185, 168, 179, 74, 45, 97, 122, 115, 134, 23, 248, 134, 101, 107, 153, 101, 233, 162, 223, 115, 186, 231, 87, 20, 174, 103, 103, 19, 247, 108, 76, 252, 182, 8, 139, 54, 46, 179, 23, 166, 156, 233, 8, 231, 30, 97, 217, 214, 165, 98, 52, 132, 171, 241, 116, 177, 39, 138, 22, 219, 8, 81, 212, 42, 26, 77, 150, 174, 21, 169, 48, 51, 175, 173, 226, 247, 50, 131, 134, 151, 211, 48, 170, 147, 199, 230, 3, 1, 70, 39, 160, 192, 147, 77, 129, 68, 119, 48, 39, 96, 133, 29, 244, 52, 136, 228, 195, 38, 64, 70, 253, 184, 41, 76, 207, 154, 37, 96, 137, 110, 222, 20, 18, 245, 121, 2, 86, 40, 7, 138, 206, 87, 111, 153, 74, 204, 165, 249, 62, 40, 38, 67, 109, 204, 191, 174, 21, 204, 130, 114, 218, 45, 239, 167, 162, 237, 28, 135, 243, 160, 196, 42, 118, 46, 117, 180, 254, 209, 46, 171, 228, 254, 17, 166, 113, 18, 181, 186, 172, 86, 71, 225, 108, 170, 116, 91, 6, 109, 9, 61, 23, 223, 142, 32, 235, 187, 68, 235, 166, 193, 154, 111, 40, 87, 167, 20, 42, 113, 45, 159, 140, 95, 87, 35, 187, 85, 129, 119, 135, 62, 85, 224, 106, 99, 59, 24, 78, 232, 38, 117, 150, 119, 17, 243, 29, 122, 238, 20, 170, 84, 139, 122, 158, 233, 80, 223, 57, 165, 80, 195, 246, 252, 230, 233, 90, 56, 92, 217, 89, 225, 134, 111, 188, 90, 15, 88, 97, 34, 203, 188, 43, 241, 240, 246, 171, 216, 13, 136, 41, 147, 204, 96, 172, 190, 6, 35, 108, 50, 235, 98, 134, 127, 206, 179, 13, 5, 94, 70, 181, 55, 31, 253, 138, 150, 56, 235, 234, 7, 118, 69, 228, 47, 120, 73, 85, 134, 175, 45, 221, 13, 196, 138, 169, 150, 155, 228, 171, 32, 8, 83, 204, 151, 197, 177, 206, 91, 58, 160, 166, 115, 87, 14, 228, 150, 9, 244, 19, 67, 172, 49, 102, 240, 11, 31, 224, 89, 79, 106, 161, 172, 145, 211, 194, 111, 99, 120, 212, 55, 74, 39, 44, 152, 248, 156, 62, 172, 119, 97, 67, 196, 52, 192, 132, 48, 67, 190, 197, 48, 205, 92, 40, 178, 169, 18, 52, 40, 170, 226, 221, 99, 253, 156, 217, 131, 112, 200, 194, 242, 252, 166, 180, 236, 228, 227, 8, 31, 116, 10, 53, 243, 159, 115, 95, 7, 54, 3, 224, 229, 59, 118, 10, 255, 156, 23, 116, 61, 191, 35, 25, 21, 107, 204, 34, 114, 175, 9, 113, 112, 78, 36, 174, 145, 3, 63, 130, 248, 247, 221, 23, 92, 228, 220, 46, 33, 103, 156, 166, 125, 110, 216, 190, 184, 63, 86, 195, 43, 38, 250, 26, 221, 31, 81, 113, 240, 2, 9, 16, 77, 186, 62, 162, 175, 253, 185, 244, 3, 103, 124, 87, 225, 41, 101, 123, 204, 130, 87, 174, 236, 224, 214, 182, 231, 253, 252, 251, 37, 166, 214, 85, 124, 167, 102, 2, 97, 122, 159, 121, 233, 24, 190, 140, 144, 141, 221, 127, 171, 153, 236, 66, 136, 236, 122, 99, 154, 194, 59, 163, 188, 50, 178, 3, 144, 41, 193, 89, 185, 186, 9, 68, 126, 14, 254, 212, 190, 215, 4, 249, 225, 45, 133, 74, 249, 164, 233, 138, 111, 7, 123, 1, 8, 218, 213, 50, 176, 75, 69, 188, 202, 71, 236, 34, 196, 152, 170, 59, 30, 231, 87, 79, 92, 100, 18, 187, 26, 49, 167, 81, 193, 115, 148, 11, 224, 117, 191, 152, 87, 90, 12, 238, 196, 237, 135, 233, 130, 36, 244, 89, 61, 146, 197, 102, 170, 154, 197, 102, 97, 203, 214, 207, 133, 254, 152, 187, 99, 231, 61, 109, 196, 71, 223, 141, 109, 201, 199, 133, 116, 220, 110, 247, 235, 231, 95, 247, 78, 51, 215, 161, 85, 101, 171, 238, 124, 159, 226, 144, 165, 245, 144, 80, 222, 66, 152, 225, 155, 68, 183, 5, 126, 135, 127, 34, 197, 74, 172, 85, 62, 5, 107, 176, 194, 238, 54, 244, 43, 57, 106, 134, 193, 90, 237, 91, 200, 173, 111, 230, 94, 36, 140, 215, 208, 66, 179, 197, 129, 172, 10, 243, 66, 225, 245, 238, 80, 201, 55, 40, 57, 218, 93, 158, 88, 210, 197, 222, 79, 189, 141, 8, 255, 177, 18, 201, 49, 60, 180, 196, 77, 68, 43, 234, 37, 47, 81, 136, 93, 101, 57, 180, 86, 3, 136, 221, 17, 96, 229, 196, 202, 172, 212, 32, 100, 16, 244, 141, 13, 114, 238, 56, 220, 255, 120, 118, 126, 242, 254, 243, 30, 109, 42, 59, 203, 235, 195, 236, 90, 185, 227, 50, 99, 113, 90, 207, 158, 213, 164, 199, 106, 178, 116, 226, 202, 209, 100, 49, 206, 11, 57, 46, 148, 190, 180, 252, 211, 225, 233, 193, 209, 193, 89, 226, 222, 242, 79, 135, 111, 14, 63, 159, 157, 239, 157, 127, 60, 139, 29, 126, 249, 116, 244, 249, 240, 245, 209, 1, 127, 213, 211, 140, 178, 252, 234, 248, 228, 243, 217, 217, 225, 235, 207, 123, 191, 238, 29, 30, 129, 110, 143, 189, 60, 219, 223, 59, 198, 108, 216, 31, 142, 14, 206, 15, 94, 247, 180, 90, 236, 45, 223, 209, 135, 47, 234, 170, 23, 159, 223, 0, 72, 124, 219, 80, 189, 5, 238, 127, 62, 58, 57, 59, 239, 105, 205, 216, 235, 79, 167, 39, 199, 111, 63, 127, 216, 59, 59, 251, 116, 114, 10, 149, 91, 177, 183, 175, 15, 207, 164, 102, 219, 74, 192, 120, 248, 165, 81, 79, 80, 121, 254, 153, 118, 35, 96, 173, 102, 231, 153, 20, 16, 143, 49, 239, 52, 151, 115, 5, 18, 21, 156, 115, 178, 224, 124, 33, 143, 147, 5, 252, 162, 205, 221, 128, 93, 215, 87, 200, 101, 108, 225, 108, 104, 205, 195, 3, 1, 133, 44, 54, 23, 246, 197, 102, 83, 156, 245, 206, 193, 231, 114, 189, 47, 133, 92, 222, 139, 42, 209, 154, 72, 33, 191, 55, 228, 10, 83, 23, 179, 129, 231, 245, 78, 225, 147, 231, 2, 63, 22, 160, 146, 0, 151, 4, 236, 120, 103, 21, 94, 59, 126, 184, 89, 182, 144, 217, 115, 97, 251, 243, 235, 66, 118, 31, 22, 142, 93, 218, 122, 59, 118, 174, 151, 30, 128, 83, 159, 116, 226, 205, 157, 187, 159, 156, 177, 83, 242, 125, 103, 244, 193, 139, 45, 201, 211, 37, 202, 190, 236, 131, 176, 121, 122, 186, 36, 45, 220, 251, 228, 178, 44, 60, 232, 167, 160, 244, 199, 1, 122, 196, 180, 254, 52, 178, 125, 7, 176, 16, 61, 194, 162, 129, 224, 14, 186, 183, 213, 228, 142, 233, 16, 62, 78, 103, 24, 192, 76, 19, 196, 99, 30, 135, 60, 11, 63, 243, 154, 84, 154, 94, 21, 56, 120, 124, 150, 59, 31, 229, 180, 112, 74, 149, 193, 115, 113, 240, 139, 150, 50, 211, 68, 139, 62, 39, 243, 139, 15, 4, 245, 63, 221, 35, 212, 71, 5, 3, 136, 120, 2, 8, 196, 51, 192, 74, 226, 215, 34, 60, 39, 236, 159, 233, 185, 220, 130, 28, 84, 166, 96, 59, 69, 184, 79, 114, 74, 214, 172, 204, 143, 124, 165, 207, 73, 81, 146, 62, 217, 185, 145, 92, 52, 172, 138, 183, 57, 83, 112, 253, 44, 240, 72, 22, 113, 7, 3, 78, 49, 113, 143, 81, 248, 2, 185, 66, 155, 117, 192, 221, 145, 46, 186, 72, 185, 113, 116, 27, 238, 198, 1, 127, 206, 88, 105, 136, 243, 189, 67, 26, 77, 123, 209, 113, 196, 197, 71, 232, 155, 107, 91, 67, 149, 116, 101, 211, 141, 53, 212, 199, 190, 11, 82, 141, 187, 207, 121, 252, 109, 24, 14, 212, 234, 83, 206, 44, 61, 41, 210, 199, 219, 100, 23, 106, 231, 220, 12, 188, 193, 158, 122, 220, 30, 14, 221, 115, 102, 7, 72, 138, 242, 66, 186, 199, 178, 214, 76, 237, 2, 207, 188, 244, 136, 173, 8, 209, 130, 47, 2, 206, 184, 241, 35, 213, 108, 234, 200, 229, 116, 213, 105, 196, 184, 68, 70, 216, 77, 51, 78, 242, 165, 36, 20, 165, 69, 194, 52, 41, 49, 57, 35, 44, 186, 119, 135, 2, 139, 171, 145, 164, 49, 23, 59, 114, 185, 234, 250, 93, 113, 155, 107, 184, 12, 190, 170, 13, 86, 180, 130, 49, 125, 185, 169, 8, 66, 252, 58, 93, 185, 173, 120, 119, 177, 224, 99, 206, 56, 126, 226, 60, 43, 83, 40, 86, 117, 156, 234, 196, 230, 170, 128, 50, 27, 70, 5, 245, 48, 194, 251, 134, 144, 22, 41, 102, 78, 123, 40, 202, 26, 56, 32, 150, 143, 251, 77, 198, 64, 200, 132, 43, 122, 80, 6, 214, 124, 132, 245, 53, 235, 26, 186, 77, 185, 173, 66, 109, 132, 158, 101, 175, 55, 174, 158, 224, 241, 242, 160, 43, 247, 230, 163, 83, 248, 203, 35, 199, 207, 210, 97, 227, 51, 102, 207, 210, 113, 99, 41, 102, 124, 228, 186, 139, 51, 63, 25, 113, 32, 149, 137, 24, 240, 109, 90, 218, 174, 86, 83, 110, 219, 163, 50, 236, 76, 92, 77, 199, 128, 210, 129, 53, 156, 148, 252, 108, 205, 194, 162, 202, 103, 164, 234, 87, 134, 149, 5, 114, 104, 148, 159, 24, 87, 150, 24, 197, 163, 202, 248, 164, 151, 108, 1, 100, 20, 158, 247, 52, 127, 227, 176, 50, 199, 239, 57, 251, 212, 95, 57, 53, 82, 118, 63, 199, 70, 208, 170, 92, 58, 150, 199, 190, 98, 133, 41, 117, 150, 143, 221, 229, 28, 238, 179, 146, 166, 66, 213, 152, 123, 169, 234, 135, 85, 218, 82, 21, 12, 80, 171, 174, 181, 70, 68, 180, 123, 106, 37, 194, 7, 175, 149, 114, 168, 214, 103, 127, 240, 221, 187, 225, 14, 177, 159, 238, 197, 164, 38, 6, 242, 17, 94, 72, 93, 240, 248, 199, 154, 102, 57, 92, 28, 128, 182, 248, 101, 56, 184, 58, 80, 146, 80, 231, 151, 213, 127, 193, 17, 33, 61, 190, 248, 194, 174, 159, 206, 220, 169, 198, 67, 239, 153, 103, 227, 54, 38, 248, 2, 160, 93, 38, 41, 91, 185, 143, 68, 92, 143, 73, 94, 172, 207, 157, 99, 49, 158, 102, 214, 162, 228, 123, 217, 167, 3, 3, 26, 84, 49, 89, 245, 170, 248, 40, 115, 73, 12, 95, 190, 199, 32, 201, 72, 28, 104, 31, 218, 206, 180, 84, 162, 143, 214, 149, 95, 162, 218, 218, 182, 86, 107, 232, 90, 69, 51, 171, 205, 76, 165, 171, 241, 129, 14, 77, 250, 225, 0, 47, 75, 45, 60, 246, 115, 131, 18, 130, 102, 126, 99, 247, 220, 44, 107, 115, 118, 99, 247, 220, 36, 34, 64, 39, 206, 107, 236, 211, 75, 173, 98, 106, 189, 244, 153, 212, 16, 134, 80, 140, 115, 220, 62, 158, 205, 46, 62, 1, 153, 227, 65, 3, 165, 50, 137, 113, 21, 139, 225, 199, 181, 152, 41, 10, 179, 7, 25, 135, 50, 85, 147, 48, 58, 116, 71, 45, 194, 7, 214, 114, 110, 124, 112, 227, 5, 219, 171, 224, 105, 33, 64, 168, 247, 163, 151, 105, 84, 77, 228, 221, 115, 190, 70, 249, 185, 91, 153, 184, 55, 204, 23, 205, 217, 48, 244, 164, 43, 209, 99, 87, 155, 175, 201, 133, 12, 42, 215, 188, 59, 153, 139, 41, 128, 181, 166, 120, 243, 121, 182, 251, 249, 7, 185, 159, 63, 221, 75, 227, 173, 226, 223, 92, 255, 177, 198, 21, 233, 33, 248, 245, 111, 212, 77, 86, 201, 186, 28, 61, 139, 131, 50, 249, 33, 172, 28, 6, 192, 240, 120, 226, 229, 216, 162, 106, 124, 199, 143, 114, 176, 43, 145, 227, 213, 243, 14, 238, 211, 108, 240, 213, 19, 71, 85, 84, 61, 62, 51, 224, 211, 227, 98, 110, 141, 77, 199, 138, 76, 89, 4, 70, 69, 91, 56, 216, 121, 215, 190, 114, 129, 128, 89, 110, 223, 14, 149, 215, 0, 95, 5, 89, 188, 19, 68, 164, 214, 4, 82, 1, 179, 188, 235, 51, 149, 187, 38, 229, 224, 244, 138, 173, 147, 98, 154, 75, 155, 137, 214, 77, 220, 4, 48, 224, 201, 84, 78, 145, 116, 116, 244, 25, 158, 98, 122, 164, 35, 233, 241, 155, 147, 211, 247, 123, 231, 248, 244, 77, 44, 203, 210, 171, 179, 253, 211, 195, 87, 7, 201, 60, 75, 251, 152, 69, 233, 23, 233, 201, 219, 189, 15, 240, 228, 173, 156, 200, 73, 145, 181, 41, 204, 181, 36, 61, 58, 161, 71, 139, 140, 244, 75, 236, 60, 194, 17, 163, 250, 108, 136, 251, 148, 98, 147, 255, 169, 252, 38, 111, 210, 203, 11, 86, 134, 19, 123, 248, 229, 202, 253, 86, 4, 125, 131, 31, 197, 209, 226, 228, 45, 173, 32, 167, 191, 217, 158, 107, 251, 165, 249, 114, 86, 214, 146, 89, 74, 152, 81, 84, 164, 46, 193, 103, 128, 71, 45, 39, 16, 224, 7, 30, 237, 170, 134, 127, 24, 206, 2, 248, 81, 97, 113, 83, 93, 224, 73, 187, 36, 240, 27, 155, 110, 85, 164, 76, 13, 143, 114, 50, 47, 126, 110, 94, 222, 45, 20, 146, 130, 179, 155, 247, 236, 125, 137, 151, 131, 89, 249, 2, 131, 83, 50, 246, 2, 4, 155, 13, 241, 111, 233, 100, 77, 115, 247, 150, 239, 100, 127, 77, 249, 232, 146, 153, 161, 2, 177, 35, 52, 75, 197, 4, 163, 98, 34, 202, 201, 112, 161, 131, 35, 97, 176, 32, 201, 215, 237, 109, 237, 149, 51, 183, 96, 82, 141, 73, 22, 188, 145, 175, 13, 45, 15, 190, 177, 136, 242, 13, 204, 51, 57, 73, 120, 172, 111, 230, 76, 167, 14, 63, 191, 23, 131, 194, 144, 139, 43, 176, 45, 140, 142, 145, 31, 57, 158, 186, 174, 39, 176, 217, 214, 234, 45, 236, 34, 35, 74, 155, 19, 201, 132, 170, 120, 139, 21, 254, 25, 62, 240, 42, 41, 101, 178, 10, 132, 25, 135, 80, 141, 55, 202, 139, 253, 76, 197, 202, 90, 93, 239, 231, 71, 173, 85, 196, 254, 163, 242, 190, 242, 90, 123, 215, 155, 245, 252, 98, 213, 179, 193, 124, 194, 4, 189, 248, 143, 98, 25, 251, 21, 7, 205, 155, 229, 116, 250, 15, 219, 242, 74, 186, 158, 66, 63, 170, 240, 30, 42, 72, 35, 132, 85, 125, 15, 122, 117, 82, 210, 183, 204, 220, 170, 175, 85, 85, 153, 40, 229, 214, 123, 167, 170, 247, 206, 93, 122, 254, 138, 138, 51, 37, 174, 206, 124, 25, 216, 171, 170, 250, 170, 170, 103, 76, 174, 176, 106, 206, 32, 15, 70, 160, 180, 214, 30, 5, 84, 58, 190, 21, 153, 141, 191, 212, 240, 11, 188, 60, 160, 177, 200, 102, 16, 55, 112, 76, 28, 242, 222, 3, 14, 233, 241, 78, 103, 240, 94, 185, 163, 187, 117, 180, 43, 21, 174, 92, 65, 233, 24, 34, 2, 68, 188, 61, 47, 161, 6, 98, 186, 60, 165, 87, 87, 199, 167, 249, 41, 205, 184, 195, 156, 133, 105, 134, 231, 60, 66, 175, 153, 16, 56, 119, 113, 11, 124, 244, 253, 157, 141, 78, 99, 42, 149, 152, 105, 168, 165, 0, 9, 42, 69, 132, 15, 145, 100, 142, 200, 190, 187, 196, 132, 38, 187, 24, 88, 228, 150, 237, 200, 242, 131, 131, 57, 104, 123, 18, 73, 197, 50, 69, 4, 137, 178, 79, 19, 7, 85, 19, 45, 85, 57, 144, 231, 25, 204, 52, 74, 249, 241, 38, 108, 37, 52, 1, 97, 112, 79, 121, 74, 45, 44, 134, 17, 38, 24, 39, 6, 203, 186, 148, 17, 239, 79, 71, 251, 227, 38, 59, 138, 66, 130, 142, 63, 195, 224, 241, 28, 148, 57, 88, 197, 43, 219, 195, 253, 41, 108, 181, 236, 27, 85, 196, 43, 216, 249, 49, 54, 26, 164, 119, 154, 53, 198, 37, 54, 43, 150, 122, 135, 173, 207, 248, 44, 84, 235, 4, 201, 150, 49, 195, 6, 180, 211, 79, 62, 63, 37, 136, 44, 79, 139, 20, 111, 70, 203, 131, 215, 83, 33, 46, 136, 194, 216, 3, 247, 155, 114, 253, 216, 206, 13, 76, 161, 49, 216, 107, 13, 191, 128, 118, 152, 218, 163, 107, 182, 42, 20, 218, 36, 63, 112, 23, 148, 171, 140, 78, 180, 89, 252, 14, 112, 205, 194, 52, 87, 130, 56, 185, 178, 6, 83, 32, 63, 137, 216, 39, 86, 41, 150, 219, 51, 196, 153, 99, 161, 122, 185, 135, 238, 141, 242, 13, 75, 9, 144, 122, 124, 174, 200, 150, 36, 31, 217, 129, 159, 67, 156, 44, 222, 136, 19, 8, 210, 203, 87, 169, 61, 59, 89, 67, 79, 242, 251, 101, 148, 128, 83, 44, 34, 145, 76, 135, 42, 246, 207, 195, 15, 231, 99, 172, 76, 204, 49, 230, 131, 232, 112, 69, 210, 204, 16, 23, 155, 149, 143, 54, 246, 137, 46, 199, 3, 228, 86, 224, 139, 62, 186, 98, 190, 7, 246, 191, 240, 63, 174, 238, 52, 39, 209, 217, 128, 158, 143, 15, 102, 218, 149, 61, 118, 61, 155, 11, 42, 43, 191, 244, 105, 61, 1, 222, 198, 209, 22, 45, 49, 167, 10, 166, 196, 98, 160, 134, 37, 142, 236, 27, 48, 239, 232, 218, 145, 245, 44, 30, 226, 175, 79, 248, 235, 160, 120, 153, 40, 139, 230, 227, 53, 180, 24, 29, 56, 148, 158, 132, 251, 99, 66, 223, 16, 143, 167, 129, 14, 98, 121, 100, 74, 55, 142, 125, 91, 6, 146, 89, 210, 58, 160, 38, 181, 252, 79, 229, 14, 230, 216, 77, 110, 34, 179, 1, 91, 54, 41, 69, 69, 118, 16, 2, 102, 81, 68, 176, 216, 3, 116, 36, 49, 42, 160, 131, 199, 151, 86, 48, 225, 235, 173, 45, 165, 98, 21, 65, 188, 184, 171, 3, 52, 246, 18, 228, 87, 71, 244, 55, 121, 24, 146, 144, 97, 217, 226, 202, 12, 51, 76, 78, 23, 101, 115, 227, 196, 71, 100, 84, 248, 51, 93, 47, 63, 139, 239, 159, 196, 32, 98, 88, 108, 75, 51, 159, 37, 142, 143, 62, 166, 164, 137, 134, 187, 119, 77, 50, 233, 131, 50, 251, 98, 107, 11, 0, 16, 140, 97, 220, 203, 146, 52, 114, 185, 22, 8, 59, 106, 76, 16, 160, 171, 78, 73, 156, 74, 236, 123, 25, 161, 249, 201, 94, 154, 51, 23, 194, 72, 77, 43, 88, 165, 208, 191, 217, 254, 185, 116, 81, 217, 210, 140, 191, 93, 254, 155, 94, 250, 231, 8, 126, 189, 236, 253, 179, 10, 159, 182, 116, 253, 37, 124, 158, 76, 30, 38, 15, 211, 233, 195, 244, 225, 232, 225, 175, 135, 63, 31, 2, 120, 122, 49, 114, 150, 223, 254, 238, 14, 237, 131, 241, 155, 235, 183, 254, 226, 231, 75, 125, 251, 58, 206, 152, 18, 180, 49, 196, 84, 120, 83, 235, 218, 47, 107, 148, 19, 180, 12, 116, 218, 67, 199, 7, 82, 202, 40, 172, 55, 182, 231, 83, 146, 181, 204, 243, 31, 81, 33, 220, 202, 86, 252, 121, 69, 92, 49, 158, 204, 52, 39, 182, 136, 12, 18, 187, 110, 145, 121, 23, 200, 45, 188, 144, 82, 137, 5, 47, 153, 55, 51, 73, 224, 65, 196, 111, 16, 229, 28, 57, 215, 78, 192, 54, 141, 112, 6, 197, 155, 211, 94, 106, 45, 173, 23, 69, 202, 195, 98, 186, 250, 200, 7, 14, 5, 69, 116, 233, 214, 193, 83, 63, 37, 153, 245, 25, 251, 90, 113, 69, 179, 56, 42, 246, 114, 222, 58, 185, 111, 151, 25, 111, 197, 64, 165, 196, 9, 241, 222, 93, 22, 81, 79, 240, 251, 218, 5, 207, 181, 34, 115, 2, 232, 29, 123, 184, 163, 25, 192, 15, 246, 121, 119, 23, 220, 19, 224, 12, 125, 211, 195, 91, 20, 242, 78, 227, 95, 129, 186, 251, 210, 207, 65, 253, 91, 46, 97, 127, 207, 125, 235, 230, 190, 93, 172, 193, 148, 31, 67, 127, 130, 181, 110, 17, 106, 116, 112, 17, 162, 181, 34, 239, 65, 162, 226, 130, 34, 252, 37, 26, 197, 48, 53, 25, 78, 151, 35, 240, 78, 139, 127, 131, 129, 24, 226, 67, 10, 124, 213, 134, 224, 140, 62, 39, 196, 138, 6, 165, 42, 49, 190, 81, 138, 18, 181, 236, 102, 239, 46, 93, 187, 95, 135, 171, 185, 207, 51, 224, 161, 207, 184, 207, 83, 161, 150, 142, 137, 255, 76, 9, 232, 223, 35, 87, 254, 234, 246, 179, 135, 191, 48, 206, 132, 5, 112, 43, 246, 93, 10, 19, 129, 27, 206, 148, 201, 247, 96, 106, 231, 74, 241, 193, 106, 58, 98, 60, 3, 169, 60, 248, 182, 0, 159, 118, 30, 56, 214, 180, 196, 209, 139, 12, 144, 93, 186, 216, 170, 92, 162, 241, 209, 127, 218, 46, 131, 229, 40, 83, 196, 30, 124, 15, 94, 139, 12, 4, 32, 5, 194, 129, 47, 48, 42, 98, 224, 151, 240, 253, 119, 144, 122, 157, 75, 234, 219, 181, 73, 77, 82, 252, 65, 244, 36, 167, 151, 14, 165, 234, 223, 173, 161, 64, 32, 172, 229, 52, 216, 184, 3, 222, 56, 223, 236, 81, 41, 83, 50, 50, 14, 117, 20, 255, 126, 240, 182, 24, 13, 123, 201, 110, 100, 13, 119, 222, 60, 254, 129, 86, 63, 130, 51, 239, 237, 91, 254, 186, 103, 56, 168, 205, 145, 195, 220, 10, 117, 195, 168, 118, 158, 19, 120, 233, 216, 89, 177, 82, 212, 243, 14, 42, 38, 213, 215, 86, 49, 87, 95, 5, 114, 80, 48, 91, 29, 73, 27, 19, 146, 13, 104, 235, 53, 160, 173, 104, 96, 29, 158, 137, 108, 235, 161, 111, 64, 15, 232, 60, 177, 161, 118, 103, 136, 123, 124, 114, 191, 163, 241, 226, 235, 51, 175, 178, 22, 109, 212, 200, 194, 26, 129, 87, 204, 49, 218, 152, 137, 6, 51, 50, 146, 197, 0, 75, 3, 90, 84, 241, 112, 88, 92, 157, 192, 146, 84, 199, 64, 219, 254, 29, 221, 221, 203, 237, 106, 128, 251, 211, 2, 218, 20, 250, 146, 208, 189, 48, 46, 41, 21, 86, 127, 21, 109, 92, 9, 49, 41, 140, 2, 244, 240, 148, 179, 85, 71, 202, 41, 71, 26, 163, 29, 166, 15, 210, 219, 50, 170, 175, 167, 38, 27, 76, 176, 87, 106, 68, 255, 14, 33, 18, 183, 169, 164, 68, 49, 177, 81, 19, 102, 49, 167, 124, 38, 107, 241, 153, 45, 155, 78, 208, 44, 152, 69, 220, 75, 58, 155, 15, 79, 113, 194, 202, 118, 193, 197, 38, 60, 150, 79, 62, 30, 165, 222, 147, 0, 208, 194, 42, 96, 97, 199, 167, 60, 108, 254, 22, 77, 121, 114, 103, 167, 210, 209, 80, 121, 186, 89, 175, 149, 68, 133, 196, 162, 50, 143, 110, 178, 181, 10, 101, 21, 232, 231, 70, 70, 53, 70, 224, 32, 49, 179, 13, 171, 117, 82, 21, 56, 165, 3, 105, 194, 143, 245, 74, 177, 53, 67, 90, 84, 98, 37, 213, 187, 75, 181, 123, 54, 209, 45, 94, 80, 6, 184, 48, 52, 112, 65, 248, 92, 226, 192, 167, 79, 180, 122, 112, 169, 125, 156, 99, 96, 105, 206, 162, 86, 12, 1, 172, 231, 140, 34, 83, 132, 55, 95, 17, 19, 122, 244, 251, 177, 255, 44, 45, 60, 124, 107, 187, 7, 14, 9, 166, 89, 91, 179, 113, 42, 196, 39, 156, 129, 117, 13, 3, 77, 250, 130, 203, 35, 90, 145, 101, 159, 75, 69, 156, 113, 86, 150, 56, 245, 238, 134, 217, 207, 187, 209, 67, 233, 36, 27, 74, 21, 134, 106, 120, 19, 161, 64, 169, 66, 169, 110, 120, 255, 64, 66, 132, 114, 108, 176, 34, 86, 26, 240, 60, 193, 48, 25, 82, 238, 40, 5, 34, 216, 74, 154, 144, 145, 195, 180, 52, 170, 50, 75, 134, 148, 54, 50, 247, 194, 133, 77, 47, 215, 108, 90, 53, 18, 190, 183, 237, 175, 107, 182, 253, 202, 193, 152, 97, 171, 177, 65, 235, 157, 213, 173, 255, 199, 250, 173, 35, 241, 63, 186, 249, 241, 154, 205, 191, 153, 186, 214, 15, 231, 252, 104, 147, 198, 127, 0, 229, 153, 155, 210, 68, 82, 243, 85, 65, 196, 126, 14, 178, 12, 72, 53, 80, 159, 74, 112, 69, 98, 85, 94, 12, 160, 101, 175, 51, 60, 83, 43, 75, 174, 184, 182, 50, 66, 104, 213, 88, 36, 77, 161, 12, 35, 251, 199, 23, 160, 249, 2, 64, 220, 10, 250, 108, 233, 133, 217, 191, 33, 174, 240, 208, 122, 1, 76, 225, 252, 88, 96, 207, 99, 81, 238, 43, 123, 104, 45, 125, 59, 218, 50, 62, 2, 211, 133, 231, 223, 190, 216, 246, 66, 91, 46, 128, 129, 158, 104, 22, 203, 248, 234, 117, 17, 90, 228, 161, 86, 66, 107, 203, 154, 100, 203, 34, 240, 221, 241, 248, 37, 32, 61, 110, 153, 153, 27, 98, 124, 235, 24, 134, 65, 42, 84, 196, 167, 1, 128, 104, 209, 248, 214, 16, 111, 21, 228, 140, 157, 41, 0, 199, 181, 138, 101, 128, 81, 240, 136, 188, 184, 253, 158, 0, 196, 169, 216, 187, 193, 120, 87, 74, 166, 231, 231, 41, 46, 64, 100, 162, 77, 5, 214, 175, 240, 149, 149, 76, 154, 81, 57, 51, 190, 106, 194, 30, 183, 199, 70, 44, 179, 105, 60, 195, 251, 243, 65, 114, 47, 77, 149, 239, 129, 73, 157, 175, 138, 150, 103, 56, 45, 165, 48, 108, 156, 186, 211, 228, 49, 171, 189, 65, 186, 189, 183, 123, 31, 146, 109, 201, 91, 53, 152, 157, 77, 168, 112, 147, 15, 99, 74, 159, 197, 186, 131, 139, 212, 101, 81, 87, 230, 244, 205, 69, 33, 131, 100, 178, 172, 116, 211, 144, 24, 127, 102, 95, 139, 156, 34, 152, 58, 36, 56, 208, 207, 78, 152, 182, 129, 75, 166, 216, 76, 136, 70, 60, 87, 195, 48, 39, 45, 187, 67, 146, 139, 217, 89, 250, 42, 108, 13, 117, 204, 250, 0, 67, 191, 78, 5, 19, 90, 91, 23, 154, 228, 22, 250, 228, 22, 150, 181, 251, 16, 165, 158, 132, 29, 234, 52, 130, 220, 35, 240, 236, 43, 195, 162, 23, 122, 88, 240, 240, 49, 79, 155, 242, 114, 121, 218, 116, 77, 1, 58, 58, 121, 139, 142, 95, 110, 25, 177, 229, 76, 177, 165, 231, 136, 36, 24, 175, 114, 210, 70, 75, 143, 175, 143, 137, 165, 221, 161, 203, 118, 243, 56, 1, 78, 28, 110, 237, 233, 52, 229, 132, 173, 196, 13, 230, 139, 201, 213, 93, 149, 168, 174, 113, 28, 135, 150, 191, 236, 175, 105, 97, 54, 149, 114, 76, 247, 120, 176, 197, 197, 248, 82, 140, 122, 124, 53, 165, 241, 85, 211, 118, 6, 169, 1, 38, 128, 109, 109, 101, 15, 181, 240, 182, 39, 25, 67, 179, 181, 222, 112, 179, 231, 35, 249, 174, 56, 9, 27, 240, 227, 57, 228, 23, 96, 25, 234, 111, 222, 188, 209, 85, 34, 173, 78, 143, 26, 85, 108, 208, 230, 166, 172, 27, 125, 190, 162, 255, 145, 53, 13, 171, 101, 226, 158, 59, 105, 150, 54, 149, 240, 53, 255, 68, 108, 21, 55, 180, 195, 195, 221, 65, 98, 107, 192, 170, 92, 24, 18, 85, 157, 28, 170, 18, 187, 238, 201, 206, 226, 162, 116, 206, 188, 150, 17, 171, 118, 154, 178, 12, 5, 3, 204, 85, 129, 248, 18, 223, 234, 179, 113, 172, 33, 221, 70, 142, 2, 230, 24, 103, 57, 113, 249, 241, 251, 199, 44, 129, 144, 215, 127, 115, 226, 23, 225, 16, 82, 104, 179, 196, 121, 193, 184, 36, 96, 27, 9, 169, 197, 13, 40, 22, 238, 166, 96, 150, 85, 40, 32, 118, 227, 28, 119, 237, 232, 194, 176, 91, 118, 173, 30, 47, 39, 150, 253, 185, 226, 218, 76, 75, 9, 237, 136, 170, 42, 84, 24, 25, 233, 161, 99, 233, 112, 195, 173, 31, 214, 116, 138, 80, 125, 229, 65, 195, 252, 189, 45, 43, 182, 235, 68, 187, 97, 211, 62, 16, 142, 125, 95, 177, 21, 55, 68, 11, 198, 51, 149, 81, 110, 242, 10, 75, 85, 226, 155, 85, 162, 161, 200, 55, 189, 108, 167, 207, 23, 38, 118, 183, 36, 32, 246, 85, 101, 229, 75, 58, 82, 29, 176, 255, 11, 143, 103, 196, 16, 163, 229, 181, 248, 22, 191, 248, 108, 224, 189, 51, 119, 102, 203, 153, 28, 236, 178, 174, 37, 239, 56, 230, 25, 51, 225, 193, 203, 12, 230, 194, 67, 7, 199, 134, 165, 155, 103, 199, 68, 73, 166, 248, 102, 167, 91, 14, 37, 117, 8, 90, 108, 132, 94, 94, 249, 67, 207, 89, 176, 43, 141, 83, 238, 52, 225, 177, 214, 110, 189, 235, 112, 231, 11, 203, 68, 37, 78, 151, 150, 225, 1, 30, 226, 34, 127, 105, 151, 121, 26, 158, 51, 43, 233, 120, 106, 13, 49, 147, 223, 72, 155, 197, 82, 59, 14, 86, 226, 64, 220, 171, 248, 246, 20, 207, 16, 112, 44, 40, 215, 55, 6, 132, 35, 200, 184, 84, 72, 123, 112, 233, 249, 159, 46, 88, 40, 68, 82, 68, 144, 84, 50, 235, 51, 38, 93, 133, 18, 155, 218, 191, 29, 19, 14, 138, 95, 197, 164, 37, 145, 211, 62, 188, 101, 179, 122, 242, 225, 224, 120, 131, 227, 223, 27, 237, 154, 20, 107, 99, 180, 115, 207, 179, 231, 242, 242, 73, 114, 123, 94, 204, 175, 72, 169, 55, 197, 221, 89, 10, 101, 16, 63, 3, 188, 198, 112, 9, 207, 4, 176, 203, 226, 148, 18, 169, 111, 4, 49, 244, 15, 213, 253, 152, 177, 75, 82, 226, 63, 151, 181, 112, 25, 68, 177, 23, 172, 202, 87, 79, 41, 63, 172, 216, 218, 150, 108, 41, 128, 122, 211, 76, 113, 137, 81, 146, 186, 34, 101, 106, 91, 158, 216, 27, 87, 82, 236, 151, 211, 149, 122, 73, 46, 145, 125, 221, 25, 110, 34, 12, 177, 82, 194, 121, 149, 78, 58, 197, 46, 106, 41, 168, 213, 97, 184, 215, 78, 113, 4, 92, 193, 188, 145, 227, 163, 136, 142, 210, 198, 67, 233, 72, 228, 237, 232, 11, 57, 58, 119, 130, 167, 208, 228, 46, 10, 27, 225, 27, 39, 80, 109, 221, 98, 252, 221, 168, 215, 227, 23, 227, 0, 185, 56, 168, 120, 149, 148, 57, 142, 15, 5, 229, 141, 117, 113, 141, 164, 20, 8, 53, 9, 49, 118, 42, 206, 199, 172, 186, 46, 152, 237, 75, 173, 134, 105, 72, 38, 174, 31, 132, 231, 30, 228, 12, 198, 233, 43, 131, 227, 100, 177, 141, 146, 60, 68, 83, 164, 91, 106, 217, 102, 59, 105, 109, 77, 117, 193, 112, 28, 74, 238, 29, 163, 49, 174, 115, 162, 181, 212, 5, 163, 5, 213, 177, 247, 21, 151, 139, 174, 153, 4, 37, 222, 237, 98, 111, 239, 18, 205, 183, 43, 8, 225, 8, 101, 222, 169, 177, 142, 94, 92, 231, 70, 78, 229, 157, 155, 143, 202, 187, 173, 147, 44, 142, 238, 218, 20, 119, 108, 42, 51, 228, 172, 125, 197, 230, 247, 95, 175, 185, 198, 52, 60, 244, 167, 217, 37, 154, 14, 248, 59, 214, 124, 136, 219, 166, 164, 59, 22, 84, 216, 169, 162, 145, 18, 61, 253, 167, 198, 4, 54, 184, 223, 115, 147, 187, 61, 195, 178, 252, 82, 43, 249, 150, 206, 208, 45, 50, 241, 154, 244, 140, 235, 59, 193, 53, 194, 246, 55, 156, 140, 128, 200, 173, 236, 90, 49, 228, 72, 226, 121, 82, 149, 244, 112, 147, 36, 46, 220, 191, 30, 90, 232, 144, 178, 172, 205, 10, 153, 219, 219, 115, 38, 2, 198, 90, 179, 159, 140, 100, 217, 63, 220, 241, 121, 130, 3, 36, 77, 67, 212, 241, 138, 151, 120, 236, 190, 151, 12, 86, 228, 112, 62, 225, 95, 248, 180, 10, 201, 124, 148, 60, 5, 39, 25, 62, 105, 219, 253, 170, 125, 22, 41, 1, 89, 96, 182, 59, 92, 212, 16, 103, 37, 202, 116, 47, 31, 190, 138, 14, 107, 228, 222, 58, 180, 134, 201, 252, 30, 47, 108, 157, 244, 4, 25, 97, 135, 76, 59, 32, 244, 63, 158, 117, 93, 161, 252, 227, 71, 26, 178, 111, 76, 90, 67, 132, 176, 181, 204, 92, 92, 134, 158, 185, 168, 152, 171, 13, 50, 175, 15, 86, 246, 54, 187, 179, 151, 0, 242, 187, 32, 195, 65, 254, 180, 230, 241, 104, 240, 250, 81, 144, 144, 239, 39, 106, 190, 175, 58, 70, 178, 230, 162, 39, 97, 124, 204, 110, 114, 145, 51, 187, 36, 144, 151, 179, 187, 36, 94, 177, 12, 47, 145, 33, 200, 136, 200, 70, 150, 52, 152, 216, 94, 72, 30, 179, 169, 98, 64, 241, 139, 177, 34, 164, 94, 74, 8, 194, 203, 143, 199, 191, 28, 159, 124, 58, 46, 232, 79, 114, 16, 86, 223, 23, 154, 199, 212, 103, 25, 26, 133, 79, 11, 214, 150, 171, 153, 53, 95, 130, 246, 66, 39, 253, 123, 82, 105, 133, 23, 133, 38, 60, 198, 13, 47, 11, 77, 156, 148, 90, 231, 194, 80, 201, 171, 148, 220, 244, 244, 173, 158, 169, 67, 88, 137, 7, 169, 219, 61, 227, 11, 212, 89, 247, 39, 73, 57, 189, 68, 106, 96, 97, 42, 249, 217, 113, 122, 186, 191, 78, 122, 58, 86, 52, 116, 255, 229, 250, 103, 246, 116, 117, 77, 30, 232, 113, 61, 21, 132, 115, 126, 61, 208, 42, 24, 116, 141, 80, 6, 10, 27, 36, 223, 136, 29, 156, 15, 57, 147, 221, 56, 43, 24, 238, 87, 138, 97, 142, 201, 146, 99, 185, 24, 192, 253, 13, 47, 250, 237, 37, 36, 29, 211, 119, 244, 52, 186, 176, 86, 220, 221, 89, 140, 159, 160, 33, 10, 161, 200, 199, 15, 175, 247, 206, 15, 52, 1, 40, 81, 74, 100, 99, 238, 101, 94, 16, 151, 186, 34, 84, 101, 101, 36, 93, 80, 78, 224, 47, 238, 34, 206, 165, 32, 188, 100, 116, 5, 13, 2, 216, 143, 160, 34, 63, 132, 45, 101, 194, 229, 249, 53, 50, 8, 248, 228, 120, 32, 143, 190, 159, 129, 186, 168, 173, 157, 29, 156, 99, 66, 180, 179, 85, 168, 43, 113, 64, 202, 63, 191, 58, 61, 249, 116, 118, 112, 154, 129, 7, 50, 81, 123, 229, 185, 183, 62, 204, 147, 213, 184, 32, 20, 141, 67, 89, 129, 6, 203, 135, 77, 29, 83, 210, 85, 24, 197, 179, 122, 103, 224, 196, 114, 157, 103, 177, 230, 252, 244, 240, 237, 219, 131, 83, 141, 195, 216, 188, 79, 193, 30, 108, 148, 50, 63, 125, 130, 154, 124, 227, 204, 181, 183, 216, 184, 230, 25, 98, 216, 57, 232, 15, 158, 187, 176, 189, 224, 174, 36, 178, 34, 101, 94, 251, 17, 3, 17, 75, 163, 112, 236, 106, 28, 59, 141, 251, 230, 213, 226, 134, 139, 147, 42, 4, 211, 89, 44, 243, 87, 203, 164, 62, 149, 62, 138, 107, 20, 50, 58, 246, 96, 126, 227, 120, 56, 251, 159, 7, 25, 157, 187, 127, 114, 252, 230, 240, 237, 199, 211, 3, 4, 117, 120, 122, 114, 252, 254, 224, 248, 92, 3, 144, 135, 123, 175, 96, 60, 252, 216, 206, 78, 220, 185, 180, 105, 63, 231, 194, 101, 146, 179, 46, 111, 255, 75, 196, 198, 142, 184, 143, 151, 16, 59, 24, 167, 100, 139, 65, 255, 173, 130, 164, 146, 35, 238, 72, 100, 136, 17, 119, 99, 50, 68, 232, 253, 201, 241, 225, 249, 201, 41, 194, 216, 68, 107, 166, 115, 205, 179, 37, 50, 70, 156, 47, 103, 52, 85, 95, 44, 23, 43, 206, 51, 217, 72, 247, 25, 200, 102, 89, 28, 65, 95, 167, 134, 176, 93, 122, 127, 157, 75, 47, 147, 87, 14, 172, 104, 66, 20, 79, 0, 207, 203, 13, 69, 24, 173, 9, 94, 182, 63, 137, 38, 66, 48, 73, 248, 251, 235, 50, 52, 113, 173, 68, 28, 252, 190, 146, 59, 210, 101, 14, 43, 128, 135, 119, 199, 196, 193, 114, 0, 171, 174, 26, 205, 135, 205, 75, 235, 249, 119, 143, 198, 252, 202, 216, 88, 142, 129, 191, 48, 46, 171, 209, 13, 148, 241, 74, 201, 212, 103, 124, 165, 51, 81, 52, 126, 11, 143, 12, 64, 87, 167, 196, 98, 45, 227, 129, 57, 167, 140, 249, 10, 231, 60, 180, 106, 31, 176, 80, 174, 148, 215, 41, 134, 14, 211, 15, 83, 123, 76, 71, 50, 177, 98, 149, 237, 160, 56, 162, 71, 168, 106, 249, 137, 227, 196, 59, 154, 227, 44, 190, 73, 170, 36, 155, 57, 126, 236, 129, 180, 137, 51, 49, 13, 113, 146, 192, 104, 10, 16, 207, 131, 195, 110, 13, 149, 166, 147, 225, 230, 169, 63, 217, 190, 196, 63, 181, 157, 228, 20, 134, 25, 17, 104, 138, 135, 74, 161, 80, 122, 223, 148, 236, 192, 107, 131, 108, 16, 152, 38, 177, 244, 103, 66, 217, 207, 214, 211, 182, 210, 60, 52, 31, 190, 179, 101, 234, 171, 205, 77, 124, 249, 90, 234, 111, 220, 60, 50, 11, 175, 103, 73, 82, 26, 189, 145, 228, 69, 189, 105, 213, 7, 99, 2, 66, 6, 115, 116, 15, 108, 10, 238, 69, 60, 68, 244, 138, 129, 117, 85, 132, 170, 137, 220, 237, 177, 33, 38, 82, 153, 82, 27, 9, 79, 32, 188, 135, 118, 147, 204, 136, 126, 82, 172, 102, 213, 248, 53, 175, 84, 64, 92, 42, 27, 10, 74, 236, 45, 140, 57, 98, 16, 14, 64, 188, 136, 26, 156, 75, 204, 225, 135, 73, 200, 89, 14, 63, 245, 96, 146, 103, 217, 234, 49, 42, 177, 240, 49, 62, 37, 4, 86, 189, 241, 220, 25, 103, 97, 44, 201, 109, 156, 185, 215, 50, 115, 41, 16, 94, 48, 68, 128, 35, 103, 37, 42, 134, 114, 92, 13, 197, 155, 190, 44, 39, 112, 41, 75, 180, 196, 197, 47, 94, 110, 43, 188, 49, 93, 172, 46, 237, 108, 179, 32, 247, 238, 255, 7, 208, 229, 207, 141, 157, 18, 1, 0, };
+#endif
+#ifndef ESP_CONP_PAGE_GZIP_ONLY
+const uint8_t ESP_CONFIG_HTML_BR[] PROGMEM = {91, 156, 18, 81, 100, 64, 198, 56, 0, 96, 220, 187, 29, 137, 208, 237, 64, 42, 222, 211, 39, 52, 138, 26, 202, 106, 1, 51, 170, 30, 142, 39, 67, 218, 97, 245, 137, 4, 43, 129, 203, 75, 193, 197, 219, 170, 235, 43, 149, 125, 248, 105, 37, 231, 40, 141, 250, 145, 135, 130, 244, 213, 82, 122, 145, 220, 26, 15, 13, 156, 125, 45, 239, 66, 104, 19, 92, 44, 139, 66, 170, 89, 154, 138, 47, 85, 39, 179, 88, 179, 31, 54, 86, 16, 54, 80, 12, 121, 170, 161, 127, 18, 123, 100, 220, 73, 142, 71, 104, 236, 147, 92, 191, 159, 105, 86, 237, 56, 133, 207, 125, 134, 129, 101, 79, 78, 93, 202, 149, 58, 229, 245, 19, 146, 142, 19, 198, 121, 95, 85, 251, 105, 253, 226, 21, 80, 79, 41, 4, 41, 209, 114, 74, 219, 126, 159, 110, 114, 154, 100, 67, 33, 156, 68, 204, 3, 97, 231, 186, 77, 23, 42, 63, 65, 66, 30, 209, 63, 14, 74, 211, 37, 175, 20, 91, 102, 124, 103, 201, 170, 166, 236, 42, 146, 21, 147, 212, 215, 31, 65, 217, 65, 56, 20, 246, 136, 215, 63, 73, 15, 150, 106, 179, 248, 43, 140, 96, 54, 160, 225, 239, 223, 222, 212, 254, 247, 231, 235, 69, 61, 128, 53, 200, 73, 79, 15, 170, 148, 113, 109, 229, 232, 229, 108, 220, 219, 245, 76, 177, 192, 10, 27, 9, 20, 192, 87, 100, 224, 251, 126, 175, 243, 49, 106, 147, 126, 146, 229, 253, 165, 212, 75, 113, 24, 3, 119, 38, 70, 80, 42, 60, 223, 82, 243, 116, 174, 172, 200, 255, 120, 75, 71, 60, 49, 217, 83, 210, 143, 141, 216, 51, 114, 87, 182, 70, 82, 58, 92, 174, 165, 178, 81, 15, 228, 160, 64, 33, 218, 228, 8, 215, 119, 170, 42, 233, 255, 247, 85, 203, 93, 71, 8, 148, 198, 33, 132, 162, 223, 179, 69, 163, 92, 84, 238, 10, 225, 134, 119, 15, 255, 199, 7, 189, 128, 40, 207, 64, 144, 198, 163, 96, 77, 210, 204, 198, 240, 110, 120, 31, 153, 35, 82, 156, 68, 133, 67, 235, 112, 157, 99, 25, 99, 81, 219, 77, 29, 43, 151, 46, 43, 58, 156, 62, 196, 114, 253, 127, 115, 165, 157, 36, 155, 107, 10, 236, 170, 0, 229, 157, 144, 251, 206, 168, 170, 86, 120, 220, 252, 63, 147, 220, 206, 229, 8, 121, 146, 236, 17, 21, 217, 1, 178, 2, 148, 125, 167, 10, 198, 176, 173, 81, 149, 21, 186, 182, 7, 207, 215, 105, 156, 210, 199, 215, 244, 191, 85, 74, 171, 102, 25, 111, 13, 44, 128, 39, 66, 103, 110, 140, 88, 233, 204, 212, 236, 177, 237, 110, 2, 188, 197, 112, 58, 186, 164, 162, 211, 24, 188, 30, 36, 212, 23, 169, 169, 35, 229, 242, 17, 66, 187, 141, 220, 217, 178, 44, 255, 178, 127, 168, 245, 159, 122, 185, 2, 89, 36, 100, 33, 106, 130, 134, 82, 73, 90, 185, 146, 251, 219, 82, 36, 243, 104, 138, 200, 39, 101, 245, 233, 213, 20, 91, 183, 49, 96, 7, 34, 174, 154, 222, 73, 62, 120, 181, 150, 163, 245, 42, 35, 170, 226, 34, 102, 68, 120, 23, 28, 177, 171, 95, 16, 24, 205, 14, 240, 250, 96, 132, 19, 122, 154, 62, 137, 219, 7, 25, 59, 14, 139, 67, 211, 227, 219, 50, 103, 54, 73, 29, 53, 187, 253, 196, 161, 141, 231, 89, 232, 127, 35, 238, 175, 55, 45, 120, 87, 215, 155, 86, 41, 147, 77, 27, 249, 32, 15, 253, 68, 126, 180, 1, 143, 163, 101, 167, 125, 145, 62, 221, 183, 108, 117, 166, 134, 223, 130, 47, 154, 6, 28, 227, 89, 30, 6, 134, 163, 148, 120, 154, 158, 153, 31, 249, 195, 120, 21, 110, 113, 82, 197, 231, 139, 112, 151, 141, 193, 244, 32, 151, 223, 153, 124, 195, 179, 117, 116, 210, 154, 153, 80, 234, 71, 16, 112, 79, 72, 230, 139, 29, 137, 77, 98, 208, 172, 185, 79, 79, 191, 213, 146, 9, 24, 173, 75, 195, 143, 132, 243, 182, 238, 33, 135, 98, 199, 142, 97, 156, 208, 85, 51, 47, 73, 74, 215, 177, 18, 103, 172, 50, 238, 50, 89, 66, 91, 110, 152, 183, 121, 159, 154, 104, 47, 201, 62, 23, 101, 208, 14, 212, 68, 35, 184, 116, 134, 154, 185, 243, 108, 127, 107, 26, 68, 75, 101, 29, 249, 48, 116, 163, 188, 53, 34, 220, 179, 136, 134, 144, 198, 158, 110, 62, 27, 46, 41, 74, 172, 232, 174, 168, 116, 209, 89, 127, 48, 205, 179, 232, 25, 151, 99, 193, 103, 254, 80, 49, 95, 79, 142, 54, 92, 202, 111, 182, 132, 235, 91, 29, 100, 60, 151, 129, 3, 162, 161, 134, 9, 236, 165, 226, 239, 37, 4, 21, 203, 129, 109, 17, 227, 237, 224, 196, 203, 242, 155, 25, 1, 160, 90, 198, 5, 48, 205, 208, 74, 238, 168, 205, 146, 36, 90, 245, 199, 25, 150, 67, 18, 178, 173, 155, 121, 192, 111, 116, 14, 78, 133, 234, 46, 219, 137, 206, 155, 153, 191, 138, 11, 14, 102, 218, 22, 209, 138, 174, 29, 148, 180, 233, 78, 4, 233, 35, 152, 114, 191, 175, 200, 145, 178, 167, 197, 61, 127, 34, 15, 125, 193, 236, 231, 246, 65, 27, 22, 201, 247, 242, 142, 251, 53, 98, 47, 126, 131, 25, 186, 129, 212, 14, 64, 155, 5, 249, 68, 76, 205, 243, 131, 65, 127, 218, 117, 243, 166, 51, 178, 222, 229, 209, 40, 115, 109, 129, 158, 126, 208, 203, 53, 137, 75, 88, 12, 221, 116, 25, 178, 239, 95, 7, 99, 195, 242, 38, 100, 249, 68, 122, 250, 194, 35, 206, 12, 103, 64, 50, 26, 150, 153, 46, 145, 178, 1, 139, 112, 207, 182, 24, 94, 163, 220, 72, 250, 142, 56, 198, 163, 221, 219, 48, 24, 150, 56, 219, 210, 189, 40, 136, 160, 142, 105, 9, 98, 204, 72, 196, 64, 1, 251, 6, 124, 55, 235, 188, 112, 168, 96, 40, 81, 80, 36, 167, 155, 47, 246, 234, 80, 128, 152, 245, 83, 221, 234, 115, 167, 31, 97, 107, 246, 82, 158, 178, 27, 239, 13, 241, 201, 231, 45, 82, 70, 59, 22, 116, 250, 23, 88, 221, 42, 147, 163, 45, 134, 52, 125, 209, 171, 102, 37, 151, 138, 21, 28, 38, 118, 19, 60, 44, 13, 131, 2, 68, 205, 198, 79, 199, 7, 30, 236, 227, 118, 137, 111, 156, 209, 170, 125, 249, 193, 190, 244, 227, 155, 26, 17, 4, 97, 15, 38, 120, 216, 125, 86, 43, 172, 104, 57, 143, 16, 60, 89, 102, 88, 169, 157, 223, 182, 52, 33, 255, 1, 197, 191, 127, 73, 209, 49, 143, 193, 117, 252, 218, 114, 101, 114, 157, 179, 40, 128, 165, 137, 211, 136, 219, 224, 148, 199, 18, 26, 234, 234, 219, 200, 34, 83, 33, 14, 230, 150, 20, 236, 106, 60, 86, 254, 140, 119, 50, 190, 14, 27, 161, 149, 202, 50, 68, 200, 165, 110, 148, 167, 2, 99, 197, 50, 217, 97, 28, 191, 47, 165, 112, 161, 167, 78, 145, 157, 84, 85, 90, 160, 241, 243, 253, 193, 147, 167, 76, 253, 51, 107, 83, 179, 141, 222, 210, 161, 44, 204, 86, 94, 11, 25, 10, 150, 155, 93, 2, 24, 27, 110, 38, 246, 9, 203, 85, 15, 69, 156, 32, 213, 136, 125, 203, 75, 53, 177, 120, 101, 156, 188, 252, 212, 143, 125, 204, 50, 122, 250, 111, 221, 140, 185, 161, 83, 171, 86, 197, 215, 97, 12, 51, 2, 158, 96, 50, 43, 168, 206, 51, 103, 253, 3, 84, 245, 226, 173, 50, 131, 51, 147, 160, 75, 43, 202, 111, 235, 252, 218, 157, 73, 129, 237, 115, 106, 150, 244, 192, 68, 18, 242, 127, 37, 6, 73, 194, 216, 165, 88, 80, 178, 166, 130, 186, 29, 59, 252, 191, 185, 222, 236, 136, 86, 152, 212, 237, 49, 185, 149, 205, 56, 37, 119, 156, 226, 89, 144, 109, 239, 179, 88, 126, 245, 127, 108, 55, 104, 141, 14, 128, 171, 62, 161, 53, 130, 83, 74, 146, 167, 8, 14, 127, 88, 43, 143, 82, 13, 213, 255, 153, 155, 37, 217, 178, 164, 188, 88, 53, 124, 53, 138, 223, 177, 239, 146, 130, 134, 26, 16, 155, 28, 148, 236, 149, 142, 146, 134, 236, 101, 111, 91, 135, 139, 229, 62, 30, 112, 109, 119, 81, 199, 37, 69, 69, 114, 129, 116, 143, 47, 234, 149, 103, 145, 208, 92, 33, 220, 203, 223, 121, 242, 20, 163, 177, 6, 165, 224, 85, 235, 35, 225, 77, 149, 216, 107, 198, 224, 203, 61, 16, 43, 55, 139, 2, 87, 80, 251, 246, 41, 8, 246, 35, 125, 41, 118, 67, 83, 48, 89, 114, 165, 4, 166, 200, 39, 197, 6, 5, 251, 37, 38, 142, 146, 230, 24, 253, 199, 228, 145, 84, 223, 127, 249, 100, 102, 186, 120, 222, 254, 53, 96, 33, 54, 116, 65, 118, 35, 213, 168, 239, 113, 217, 214, 37, 247, 126, 203, 149, 221, 231, 55, 41, 88, 137, 242, 159, 234, 102, 73, 200, 79, 203, 111, 109, 70, 27, 161, 36, 39, 7, 216, 162, 104, 70, 120, 63, 95, 242, 141, 38, 231, 178, 2, 83, 101, 180, 123, 201, 42, 1, 110, 217, 251, 93, 252, 223, 214, 197, 59, 94, 226, 95, 197, 58, 191, 249, 190, 53, 66, 228, 148, 217, 129, 105, 40, 201, 36, 153, 196, 132, 26, 192, 196, 151, 174, 252, 165, 197, 65, 98, 146, 20, 208, 161, 251, 52, 204, 223, 171, 17, 203, 138, 16, 132, 168, 228, 10, 10, 174, 190, 73, 250, 254, 142, 104, 108, 197, 13, 246, 227, 173, 254, 38, 231, 125, 51, 167, 160, 44, 206, 251, 138, 26, 187, 229, 184, 142, 116, 177, 33, 95, 54, 232, 95, 128, 175, 212, 56, 63, 104, 38, 74, 217, 225, 185, 235, 253, 122, 50, 78, 134, 241, 115, 173, 241, 21, 149, 48, 185, 201, 174, 212, 206, 166, 132, 128, 234, 47, 205, 111, 246, 179, 160, 227, 121, 40, 114, 169, 122, 68, 168, 162, 85, 35, 227, 169, 192, 236, 216, 74, 8, 163, 139, 45, 58, 242, 82, 137, 25, 245, 126, 185, 91, 106, 67, 255, 123, 45, 173, 31, 141, 159, 204, 93, 181, 133, 65, 92, 150, 188, 61, 8, 101, 13, 128, 67, 179, 140, 216, 71, 44, 115, 12, 160, 72, 221, 99, 229, 4, 222, 68, 54, 189, 189, 177, 108, 122, 251, 175, 89, 54, 189, 253, 187, 97, 211, 27, 6, 104, 47, 255, 212, 107, 205, 216, 184, 24, 82, 69, 108, 181, 88, 99, 230, 236, 114, 77, 173, 196, 231, 189, 123, 246, 90, 38, 242, 132, 251, 34, 22, 153, 249, 186, 159, 254, 213, 254, 208, 107, 141, 105, 164, 83, 35, 244, 123, 54, 7, 154, 197, 113, 136, 41, 51, 222, 169, 160, 64, 90, 203, 205, 6, 108, 71, 95, 136, 89, 93, 21, 5, 198, 82, 77, 212, 114, 53, 157, 144, 247, 132, 119, 195, 108, 161, 37, 177, 136, 105, 167, 146, 126, 153, 83, 41, 242, 114, 12, 86, 246, 2, 77, 205, 179, 12, 98, 163, 106, 166, 11, 155, 117, 162, 180, 149, 138, 23, 36, 232, 0, 123, 83, 190, 69, 144, 204, 27, 224, 243, 12, 248, 254, 37, 190, 194, 253, 204, 130, 0, 63, 157, 240, 111, 207, 114, 161, 205, 222, 158, 133, 120, 82, 114, 10, 137, 22, 49, 124, 97, 240, 15, 119, 118, 53, 62, 205, 194, 17, 201, 134, 14, 95, 230, 210, 250, 137, 86, 194, 129, 37, 52, 232, 138, 185, 60, 95, 128, 63, 188, 165, 72, 157, 189, 160, 23, 43, 187, 96, 72, 249, 131, 38, 99, 240, 221, 150, 39, 86, 130, 115, 25, 42, 22, 121, 192, 139, 248, 14, 97, 66, 102, 44, 81, 223, 156, 72, 69, 243, 130, 18, 212, 32, 38, 28, 227, 98, 80, 199, 132, 51, 72, 68, 164, 46, 166, 139, 184, 132, 43, 36, 161, 31, 101, 201, 52, 44, 151, 103, 13, 102, 191, 80, 155, 71, 219, 152, 45, 35, 92, 14, 94, 68, 219, 20, 209, 158, 200, 204, 205, 77, 201, 22, 107, 6, 89, 82, 18, 3, 117, 121, 193, 58, 70, 94, 202, 27, 174, 138, 74, 238, 153, 37, 192, 188, 41, 219, 142, 129, 72, 212, 1, 121, 38, 131, 34, 211, 45, 106, 103, 176, 255, 26, 73, 92, 164, 84, 51, 74, 192, 75, 239, 11, 233, 218, 212, 252, 86, 115, 23, 247, 189, 163, 188, 83, 180, 122, 144, 237, 63, 49, 66, 46, 47, 212, 125, 231, 78, 242, 21, 84, 4, 56, 199, 22, 246, 5, 127, 42, 241, 183, 73, 155, 140, 115, 238, 66, 52, 205, 181, 87, 187, 37, 105, 76, 14, 63, 83, 30, 172, 66, 36, 149, 255, 144, 112, 146, 254, 223, 255, 36, 128, 158, 178, 139, 125, 2, 198, 36, 250, 114, 1, 7, 38, 208, 108, 35, 102, 66, 222, 98, 60, 103, 166, 185, 3, 204, 98, 228, 114, 235, 95, 224, 214, 43, 156, 156, 214, 107, 120, 104, 21, 81, 132, 210, 0, 203, 165, 35, 161, 136, 54, 161, 79, 121, 144, 169, 153, 58, 200, 243, 223, 185, 103, 104, 219, 208, 153, 184, 92, 83, 28, 11, 57, 164, 108, 223, 40, 206, 40, 178, 97, 103, 161, 187, 228, 143, 242, 71, 239, 9, 37, 27, 172, 114, 148, 35, 62, 107, 141, 195, 216, 59, 244, 207, 50, 151, 141, 243, 182, 62, 235, 54, 198, 248, 24, 133, 103, 205, 53, 72, 30, 237, 244, 169, 2, 197, 231, 219, 54, 207, 137, 138, 250, 189, 128, 52, 186, 86, 26, 112, 247, 34, 164, 250, 215, 82, 19, 246, 2, 38, 57, 43, 27, 166, 226, 186, 196, 163, 18, 85, 235, 166, 236, 134, 21, 185, 136, 68, 83, 185, 32, 67, 59, 76, 37, 205, 108, 217, 12, 72, 56, 32, 18, 70, 94, 114, 95, 78, 196, 174, 41, 24, 131, 64, 230, 124, 65, 241, 46, 57, 113, 2, 83, 215, 21, 111, 171, 120, 170, 7, 29, 240, 90, 92, 106, 29, 18, 142, 100, 48, 150, 16, 108, 220, 74, 50, 176, 200, 175, 59, 180, 140, 207, 215, 252, 25, 159, 236, 248, 182, 143, 95, 69, 181, 65, 193, 63, 156, 68, 146, 227, 137, 230, 181, 64, 249, 177, 192, 193, 94, 53, 140, 135, 160, 60, 92, 200, 199, 210, 43, 221, 222, 92, 145, 195, 5, 51, 131, 57, 46, 193, 188, 149, 28, 17, 196, 226, 52, 189, 161, 227, 67, 190, 146, 52, 159, 247, 94, 68, 139, 169, 221, 202, 179, 8, 59, 109, 41, 4, 226, 177, 78, 145, 118, 84, 128, 22, 36, 226, 140, 51, 213, 67, 220, 62, 145, 107, 167, 249, 60, 134, 202, 121, 211, 117, 2, 26, 188, 161, 134, 142, 78, 57, 161, 101, 71, 207, 73, 201, 142, 150, 147, 26, 187, 226, 242, 179, 181, 135, 147, 74, 60, 183, 28, 169, 105, 91, 159, 40, 242, 43, 101, 206, 255, 5, 68, 131, 63, 129, 184, 216, 41, 80, 144, 205, 166, 57, 197, 107, 153, 133, 186, 163, 77, 79, 74, 119, 239, 57, 12, 155, 178, 31, 241, 36, 3, 96, 16, 130, 201, 142, 51, 29, 183, 19, 221, 140, 98, 86, 1, 190, 49, 17, 112, 117, 141, 101, 81, 223, 168, 231, 137, 42, 133, 56, 66, 216, 141, 254, 50, 106, 213, 10, 97, 255, 41, 237, 143, 149, 116, 168, 79, 127, 1, 56, 14, 148, 85, 75, 45, 191, 49, 65, 96, 66, 110, 1, 219, 84, 8, 65, 58, 252, 223, 159, 108, 238, 8, 192, 24, 134, 106, 180, 114, 163, 10, 92, 69, 138, 216, 115, 12, 255, 9, 242, 104, 214, 56, 133, 111, 11, 86, 139, 191, 186, 3, 182, 5, 245, 236, 180, 155, 210, 98, 208, 61, 219, 120, 194, 254, 40, 111, 71, 7, 15, 55, 216, 78, 148, 222, 231, 4, 7, 110, 247, 160, 82, 156, 217, 13, 169, 43, 157, 49, 24, 252, 215, 172, 222, 22, 50, 217, 156, 205, 101, 233, 165, 41, 233, 11, 97, 163, 243, 42, 141, 127, 200, 20, 155, 70, 179, 54, 253, 42, 54, 148, 103, 25, 232, 113, 76, 20, 77, 45, 215, 150, 251, 125, 167, 94, 123, 183, 97, 128, 56, 212, 103, 63, 106, 232, 36, 106, 79, 86, 88, 194, 115, 231, 255, 54, 94, 71, 205, 98, 42, 35, 164, 182, 175, 236, 83, 121, 70, 98, 6, 192, 49, 160, 7, 204, 125, 254, 103, 11, 122, 18, 136, 83, 143, 89, 93, 202, 143, 25, 122, 104, 106, 231, 21, 245, 146, 211, 150, 136, 254, 218, 68, 214, 43, 220, 136, 68, 48, 185, 169, 137, 82, 165, 147, 224, 163, 246, 82, 106, 226, 40, 76, 126, 39, 145, 218, 242, 15, 68, 19, 183, 193, 109, 245, 153, 67, 3, 28, 197, 177, 61, 60, 133, 89, 159, 59, 193, 79, 68, 120, 59, 74, 36, 173, 184, 229, 245, 48, 81, 254, 39, 255, 67, 90, 93, 207, 40, 49, 104, 80, 169, 142, 24, 24, 188, 162, 135, 43, 84, 21, 184, 82, 13, 109, 107, 131, 22, 242, 253, 59, 66, 180, 42, 209, 22, 37, 66, 137, 245, 153, 69, 29, 56, 196, 129, 114, 196, 136, 210, 8, 191, 145, 32, 139, 120, 14, 73, 146, 244, 240, 105, 114, 211, 63, 127, 193, 52, 142, 8, 99, 245, 66, 43, 27, 196, 237, 6, 236, 90, 20, 124, 110, 132, 221, 54, 18, 23, 110, 0, 55, 252, 3, 39, 73, 122, 248, 52, 201, 241, 31, 45, 232, 159, 183, 213, 90, 134, 87, 200, 132, 186, 70, 43, 164, 218, 39, 248, 208, 42, 82, 35, 147, 212, 21, 50, 129, 76, 228, 131, 23, 73, 122, 248, 52, 153, 193, 27, 115, 211, 146, 81, 214, 190, 94, 33, 64, 5, 232, 124, 142, 12, 180, 144, 89, 177, 19, 78, 193, 228, 28, 115, 1, 128, 8, 198, 253, 101, 133, 255, 161, 42, 122, 49, 96, 136, 26, 110, 198, 232, 86, 176, 77, 28, 179, 122, 249, 22, 161, 134, 139, 19, 135, 55, 1, 1, 8, 10, 253, 195, 4, 246, 210, 100, 121, 158, 97, 223, 142, 231, 115, 161, 0, 141, 56, 135, 205, 83, 192, 176, 133, 216, 53, 128, 149, 8, 162, 200, 51, 10, 198, 131, 14, 192, 64, 140, 91, 138, 99, 22, 41, 195, 226, 244, 149, 119, 150, 95, 137, 92, 37, 202, 128, 24, 165, 4, 201, 41, 7, 79, 241, 149, 146, 43, 137, 82, 87, 218, 85, 126, 21, 91, 1, 214, 1, 216, 171, 97, 165, 236, 220, 3, 86, 209, 4, 146, 47, 5, 23, 129, 243, 108, 221, 86, 102, 77, 222, 82, 130, 120, 199, 77, 42, 58, 72, 63, 18, 191, 229, 92, 29, 46, 193, 17, 253, 248, 199, 111, 206, 95, 233, 193, 67, 136, 255, 147, 142, 33, 254, 1, 198, 77, 131, 225, 200, 17, 5, 195, 19, 114, 234, 102, 103, 201, 190, 205, 28, 7, 73, 103, 240, 178, 78, 152, 4, 175, 69, 17, 145, 41, 188, 226, 121, 225, 241, 132, 167, 133, 199, 19, 158, 214, 56, 158, 176, 190, 11, 119, 61, 15, 31, 87, 168, 190, 37, 102, 45, 82, 108, 164, 128, 218, 203, 128, 213, 18, 150, 229, 250, 135, 115, 117, 212, 11, 220, 193, 124, 24, 136, 206, 153, 235, 187, 167, 49, 173, 164, 15, 92, 221, 24, 16, 147, 85, 203, 1, 66, 72, 213, 40, 170, 69, 36, 226, 115, 43, 55, 252, 3, 145, 147, 5, 47, 193, 165, 15, 104, 12, 172, 199, 254, 22, 1, 71, 4, 159, 11, 42, 213, 53, 28, 190, 240, 49, 241, 228, 212, 69, 198, 207, 39, 240, 132, 88, 69, 80, 15, 57, 10, 11, 66, 245, 151, 136, 230, 117, 122, 228, 244, 237, 20, 19, 253, 91, 211, 241, 1, 60, 64, 17, 25, 240, 251, 14, 26, 156, 227, 26, 101, 3, 208, 151, 153, 217, 93, 203, 102, 194, 183, 178, 76, 202, 91, 190, 46, 161, 125, 21, 43, 70, 57, 75, 182, 101, 218, 221, 186, 48, 0, 43, 99, 53, 243, 162, 102, 104, 169, 183, 82, 222, 179, 4, 0, 34, 157, 167, 108, 140, 173, 217, 165, 3, 0, 240, 70, 186, 182, 110, 109, 179, 161, 130, 234, 30, 140, 174, 65, 82, 181, 56, 116, 45, 213, 114, 109, 102, 17, 254, 111, 204, 128, 130, 231, 229, 164, 91, 231, 68, 32, 207, 61, 131, 221, 68, 4, 196, 46, 113, 37, 42, 126, 8, 248, 43, 200, 234, 202, 235, 77, 75, 237, 180, 235, 231, 64, 244, 174, 44, 255, 112, 208, 235, 110, 64, 84, 167, 94, 92, 96, 49, 12, 239, 228, 213, 255, 68, 67, 61, 8, 62, 65, 218, 251, 72, 60, 94, 61, 242, 116, 124, 53, 6, 232, 169, 231, 108, 46, 243, 162, 191, 246, 102, 91, 230, 71, 232, 191, 2, 35, 184, 138, 12, 206, 187, 54, 125, 243, 53, 118, 148, 151, 79, 20, 242, 132, 90, 116, 162, 74, 127, 44, 242, 48, 68, 80, 175, 24, 107, 5, 235, 150, 242, 62, 224, 4, 224, 196, 99, 62, 5, 54, 120, 7, 130, 32, 219, 248, 67, 125, 60, 189, 242, 17, 69, 245, 33, 45, 28, 210, 35, 240, 175, 197, 16, 233, 13, 59, 57, 31, 253, 120, 178, 112, 182, 61, 220, 155, 143, 207, 148, 1, 75, 79, 108, 83, 172, 255, 54, 184, 118, 169, 98, 174, 98, 160, 147, 169, 133, 135, 192, 243, 46, 128, 134, 248, 87, 65, 0, 92, 124, 82, 147, 50, 155, 98, 242, 183, 77, 113, 159, 216, 140, 128, 8, 145, 119, 125, 97, 107, 71, 198, 210, 7, 189, 112, 167, 82, 166, 81, 8, 225, 202, 233, 173, 105, 222, 158, 9, 16, 169, 205, 136, 224, 104, 188, 137, 1, 74, 85, 201, 249, 204, 48, 114, 138, 221, 216, 57, 77, 199, 26, 79, 131, 23, 189, 119, 61, 18, 0, 92, 210, 109, 248, 147, 92, 21, 74, 163, 173, 174, 28, 125, 16, 4, 11, 151, 152, 224, 44, 181, 237, 88, 64, 205, 72, 88, 30, 241, 159, 47, 12, 17, 209, 165, 203, 62, 192, 239, 31, 9, 89, 163, 6, 214, 16, 56, 88, 8, 92, 243, 42, 160, 70, 79, 28, 129, 6, 106, 103, 86, 108, 178, 39, 99, 3, 68, 109, 234, 225, 236, 87, 108, 201, 99, 35, 49, 37, 122, 132, 222, 156, 90, 170, 243, 180, 74, 99, 135, 116, 88, 175, 55, 107, 64, 224, 67, 119, 18, 45, 154, 105, 173, 23, 112, 38, 55, 62, 130, 100, 110, 141, 224, 215, 76, 194, 39, 165, 130, 97, 70, 2, 107, 107, 244, 84, 8, 142, 170, 165, 108, 58, 108, 39, 124, 102, 201, 248, 153, 219, 35, 87, 41, 109, 205, 232, 90, 213, 196, 167, 91, 186, 208, 80, 23, 70, 250, 209, 12, 247, 135, 8, 224, 2, 17, 35, 40, 97, 85, 21, 24, 78, 216, 197, 173, 112, 45, 162, 5, 133, 20, 174, 220, 200, 0, 200, 242, 58, 86, 107, 231, 94, 175, 199, 216, 206, 86, 239, 83, 202, 42, 243, 4, 25, 255, 50, 111, 207, 18, 228, 200, 148, 68, 137, 65, 188, 155, 197, 21, 60, 8, 28, 51, 130, 120, 222, 143, 28, 130, 93, 97, 2, 37, 148, 176, 241, 176, 234, 48, 152, 107, 208, 113, 65, 154, 74, 40, 65, 5, 244, 176, 67, 3, 117, 85, 222, 30, 206, 118, 102, 153, 99, 228, 126, 128, 195, 6, 165, 124, 194, 114, 95, 208, 74, 65, 230, 213, 194, 41, 44, 245, 61, 213, 193, 137, 122, 119, 32, 47, 252, 48, 36, 114, 108, 69, 180, 49, 47, 24, 19, 45, 86, 151, 9, 43, 117, 158, 236, 194, 144, 80, 153, 192, 23, 139, 59, 46, 211, 236, 170, 72, 34, 165, 171, 136, 71, 0, 159, 51, 103, 197, 140, 240, 255, 34, 57, 76, 26, 93, 133, 123, 137, 58, 63, 195, 182, 185, 97, 128, 222, 172, 36, 60, 37, 1, 162, 66, 176, 9, 189, 45, 200, 45, 206, 66, 145, 76, 71, 246, 217, 93, 213, 90, 218, 68, 96, 248, 230, 195, 230, 10, 130, 195, 166, 72, 167, 84, 31, 159, 212, 45, 211, 167, 118, 228, 164, 11, 192, 42, 105, 160, 195, 163, 228, 167, 214, 2, 98, 200, 224, 90, 97, 16, 220, 163, 45, 92, 91, 224, 43, 218, 79, 217, 109, 151, 177, 181, 9, 147, 246, 9, 74, 194, 44, 107, 254, 220, 135, 111, 221, 250, 97, 125, 192, 141, 193, 234, 111, 126, 160, 93, 159, 25, 38, 239, 78, 199, 19, 14, 13, 224, 196, 1, 26, 245, 172, 140, 29, 77, 47, 118, 131, 7, 22, 53, 88, 4, 154, 46, 171, 123, 71, 7, 141, 22, 147, 19, 11, 187, 61, 98, 81, 69, 140, 67, 1, 193, 217, 20, 192, 10, 233, 191, 34, 164, 196, 80, 216, 0, 37, 71, 241, 0, 109, 61, 236, 148, 183, 56, 60, 148, 212, 219, 119, 150, 237, 176, 72, 160, 72, 206, 218, 72, 18, 150, 36, 168, 174, 207, 32, 143, 110, 235, 33, 140, 161, 173, 200, 49, 236, 64, 147, 208, 26, 221, 11, 145, 209, 51, 240, 252, 161, 247, 39, 99, 213, 88, 163, 22, 241, 94, 71, 99, 244, 111, 129, 233, 104, 4, 51, 15, 215, 71, 210, 200, 39, 195, 86, 53, 64, 106, 125, 202, 239, 12, 233, 101, 151, 94, 99, 47, 54, 37, 172, 12, 23, 18, 1, 125, 71, 34, 214, 86, 210, 11, 226, 145, 196, 159, 244, 130, 171, 60, 148, 93, 234, 130, 179, 124, 78, 27, 24, 133, 140, 208, 78, 7, 64, 172, 34, 124, 242, 253, 248, 167, 62, 145, 20, 225, 166, 234, 239, 114, 239, 76, 78, 62, 139, 86, 224, 215, 98, 57, 208, 53, 23, 168, 162, 99, 3, 65, 177, 59, 23, 125, 92, 182, 253, 58, 216, 74, 70, 92, 232, 80, 161, 29, 215, 224, 182, 233, 249, 224, 133, 228, 171, 224, 218, 38, 69, 57, 182, 4, 136, 78, 113, 47, 73, 75, 100, 96, 5, 154, 124, 212, 185, 26, 191, 40, 234, 166, 214, 63, 217, 72, 57, 176, 18, 80, 206, 2, 124, 135, 93, 0, 207, 186, 212, 215, 160, 15, 5, 163, 220, 243, 208, 39, 210, 174, 65, 38, 1, 8, 202, 22, 111, 45, 250, 11, 162, 77, 176, 215, 247, 193, 246, 197, 76, 54, 122, 183, 251, 130, 223, 43, 73, 70, 177, 84, 5, 142, 166, 208, 112, 200, 96, 56, 207, 162, 213, 175, 99, 99, 36, 100, 28, 225, 115, 219, 38, 65, 250, 250, 167, 253, 229, 239, 111, 209, 105, 19, 213, 118, 150, 196, 214, 115, 128, 174, 236, 246, 115, 68, 226, 252, 29, 205, 228, 244, 19, 194, 84, 249, 68, 127, 107, 117, 142, 93, 112, 74, 30, 151, 167, 208, 158, 121, 183, 88, 128, 26, 205, 148, 84, 218, 119, 3, 54, 159, 18, 218, 155, 128, 140, 42, 155, 49, 16, 231, 84, 57, 91, 5, 73, 227, 206, 246, 216, 94, 40, 109, 62, 24, 34, 191, 28, 49, 174, 82, 66, 141, 159, 84, 159, 63, 230, 170, 177, 43, 132, 50, 2, 0, 135, 188, 76, 109, 164, 127, 144, 120, 23, 64, 41, 233, 105, 92, 81, 2, 127, 89, 38, 135, 171, 151, 188, 103, 202, 49, 142, 92, 143, 173, 35, 60, 53, 148, 115, 197, 107, 230, 142, 7, 28, 154, 89, 11, 134, 155, 191, 145, 17, 9, 5, 199, 13, 255, 127, 183, 220, 123, 123, 67, 1, 186, 48, 102, 92, 4, 130, 82, 3, 161, 211, 186, 105, 2, 205, 184, 17, 193, 197, 37, 136, 12, 228, 46, 190, 148, 1, 3, 226, 242, 247, 128, 106, 71, 176, 101, 68, 78, 50, 174, 221, 0, 129, 60, 161, 232, 187, 146, 141, 213, 161, 136, 230, 43, 146, 109, 245, 109, 53, 123, 185, 238, 151, 230, 136, 207, 62, 22, 89, 189, 1, 187, 79, 123, 193, 71, 142, 139, 243, 191, 188, 112, 182, 122, 40, 179, 215, 97, 120, 26, 108, 233, 37, 56, 40, 143, 96, 150, 179, 162, 133, 125, 37, 55, 48, 81, 232, 70, 179, 255, 163, 222, 38, 52, 221, 207, 1, 145, 227, 108, 122, 129, 89, 58, 31, 219, 76, 204, 0, 213, 226, 12, 182, 131, 255, 188, 121, 157, 81, 102, 146, 48, 245, 97, 243, 218, 119, 116, 97, 167, 101, 196, 233, 245, 21, 172, 153, 238, 10, 205, 242, 154, 205, 110, 210, 199, 222, 185, 159, 153, 142, 215, 169, 117, 184, 219, 172, 90, 12, 188, 59, 181, 230, 236, 250, 102, 250, 244, 236, 85, 190, 134, 212, 247, 100, 40, 120, 193, 54, 94, 193, 96, 139, 70, 167, 219, 38, 245, 190, 21, 80, 204, 146, 94, 196, 241, 99, 99, 165, 48, 108, 185, 124, 21, 204, 148, 67, 19, 56, 111, 217, 149, 82, 160, 156, 18, 18, 239, 63, 147, 255, 248, 85, 211, 228, 175, 10, 255, 21, 215, 239, 127, 9, 31, 69, 176, 54, 155, 207, 86, 168, 80, 85, 56, 67, 166, 18, 99, 96, 193, 131, 147, 189, 83, 161, 146, 14, 43, 68, 16, 134, 195, 77, 56, 107, 101, 208, 71, 177, 123, 198, 196, 143, 92, 118, 193, 52, 147, 202, 79, 75, 92, 241, 160, 68, 215, 98, 99, 44, 161, 32, 197, 104, 23, 73, 103, 117, 233, 67, 22, 22, 192, 27, 109, 101, 194, 119, 211, 59, 108, 193, 73, 11, 105, 198, 80, 85, 16, 140, 249, 22, 186, 208, 59, 103, 112, 52, 60, 72, 58, 40, 133, 171, 64, 80, 19, 111, 26, 165, 100, 89, 133, 230, 47, 35, 119, 62, 176, 159, 88, 182, 142, 32, 175, 171, 132, 78, 152, 227, 27, 206, 200, 89, 235, 183, 170, 164, 154, 146, 177, 232, 125, 92, 171, 59, 86, 136, 178, 128, 153, 101, 189, 87, 229, 40, 59, 244, 55, 39, 203, 147, 213, 186, 102, 229, 172, 55, 76, 243, 108, 253, 198, 202, 108, 87, 95, 19, 53, 173, 42, 186, 81, 99, 217, 61, 169, 18, 114, 248, 92, 69, 118, 136, 169, 15, 223, 19, 211, 22, 21, 207, 95, 173, 111, 152, 151, 55, 92, 72, 165, 141, 117, 62, 68, 72, 185, 40, 171, 186, 105, 187, 126, 24, 81, 251, 45, 245, 157, 222, 222, 55, 173, 177, 111, 15, 206, 135, 205, 126, 183, 63, 60, 162, 63, 238, 58, 70, 157, 108, 234, 221, 213, 188, 198, 67, 59, 153, 177, 47, 132, 126, 162, 214, 235, 224, 88, 90, 167, 221, 101, 95, 216, 132, 209, 177, 88, 252, 34, 211, 216, 153, 248, 242, 116, 227, 5, 70, 220, 200, 207, 105, 41, 15, 119, 134, 144, 217, 171, 38, 99, 206, 118, 196, 57, 68, 234, 216, 254, 172, 100, 238, 20, 137, 242, 229, 46, 231, 231, 30, 174, 57, 5, 38, 99, 38, 83, 176, 94, 190, 233, 106, 139, 109, 26, 187, 7, 241, 212, 148, 135, 38, 61, 143, 45, 171, 134, 156, 13, 62, 26, 255, 196, 97, 13, 13, 206, 110, 243, 121, 159, 179, 221, 227, 227, 108, 11, 203, 213, 24, 157, 24, 146, 112, 215, 156, 185, 213, 65, 86, 242, 115, 60, 24, 110, 125, 222, 97, 91, 66, 233, 72, 130, 200, 133, 252, 150, 137, 103, 129, 118, 227, 201, 42, 93, 182, 16, 173, 156, 217, 24, 72, 248, 119, 216, 216, 156, 155, 111, 213, 227, 234, 138, 29, 183, 206, 190, 71, 86, 240, 97, 192, 136, 83, 107, 144, 91, 106, 12, 62, 6, 112, 39, 243, 36, 18, 87, 161, 98, 49, 213, 232, 157, 173, 249, 92, 237, 43, 177, 74, 24, 200, 129, 132, 221, 21, 189, 38, 89, 20, 236, 11, 18, 132, 81, 254, 84, 85, 78, 159, 154, 108, 193, 196, 38, 157, 86, 117, 25, 248, 129, 52, 5, 172, 133, 103, 93, 199, 195, 204, 162, 63, 116, 193, 26, 171, 105, 167, 225, 68, 226, 237, 68, 83, 185, 25, 147, 102, 68, 53, 254, 185, 49, 105, 102, 198, 176, 88, 10, 214, 187, 136, 129, 249, 55, 197, 141, 39, 75, 52, 96, 141, 63, 111, 135, 180, 209, 176, 129, 37, 3, 218, 134, 18, 31, 128, 135, 200, 227, 85, 243, 176, 124, 189, 203, 55, 127, 239, 75, 106, 126, 142, 235, 17, 66, 126, 93, 99, 111, 71, 5, 145, 254, 86, 36, 225, 238, 19, 40, 32, 124, 90, 231, 23, 200, 90, 29, 63, 223, 144, 127, 238, 205, 233, 247, 155, 34, 165, 21, 7, 131, 202, 27, 94, 42, 210, 204, 26, 55, 202, 221, 173, 180, 217, 124, 133, 242, 211, 83, 52, 83, 207, 135, 64, 60, 239, 225, 245, 231, 221, 151, 201, 53, 155, 132, 9, 77, 215, 119, 67, 183, 237, 118, 221, 216, 93, 116, 251, 238, 178, 143, 83, 110, 220, 53, 86, 27, 190, 193, 78, 140, 156, 213, 38, 226, 61, 180, 93, 243, 249, 166, 19, 165, 119, 123, 68, 170, 175, 252, 147, 224, 238, 220, 162, 39, 178, 93, 69, 165, 96, 99, 96, 71, 240, 148, 143, 4, 192, 95, 242, 221, 239, 52, 39, 233, 152, 127, 78, 157, 156, 58, 221, 56, 163, 58, 72, 186, 224, 77, 147, 120, 112, 117, 219, 145, 56, 199, 123, 61, 190, 173, 191, 171, 205, 208, 168, 148, 182, 220, 29, 137, 21, 30, 154, 138, 15, 121, 229, 254, 106, 33, 175, 145, 10, 73, 185, 202, 188, 27, 34, 104, 105, 42, 172, 41, 91, 61, 244, 62, 69, 19, 171, 59, 157, 209, 186, 202, 47, 76, 51, 110, 79, 79, 130, 9, 183, 41, 204, 117, 211, 144, 173, 10, 58, 89, 111, 133, 76, 172, 84, 215, 106, 201, 218, 128, 168, 39, 165, 44, 114, 71, 241, 37, 248, 193, 122, 108, 159, 106, 184, 112, 74, 243, 38, 94, 90, 104, 129, 58, 209, 165, 216, 208, 26, 93, 96, 229, 9, 104, 66, 55, 157, 156, 106, 190, 7, 199, 157, 160, 197, 120, 118, 35, 209, 119, 79, 176, 133, 24, 225, 121, 89, 139, 3, 253, 202, 194, 25, 142, 211, 97, 39, 23, 88, 72, 180, 154, 204, 12, 14, 175, 162, 9, 211, 67, 55, 47, 149, 181, 146, 138, 196, 174, 184, 184, 164, 124, 182, 10, 24, 198, 169, 125, 67, 154, 173, 58, 179, 224, 131, 164, 253, 211, 42, 202, 55, 46, 178, 69, 93, 220, 110, 135, 38, 154, 230, 159, 110, 15, 70, 109, 150, 248, 236, 116, 218, 104, 29, 149, 109, 74, 174, 8, 250, 110, 168, 181, 166, 148, 154, 169, 251, 221, 243, 91, 117, 184, 17, 50, 31, 104, 1, 196, 36, 175, 220, 158, 238, 143, 154, 158, 252, 226, 225, 92, 202, 38, 223, 165, 120, 4, 23, 146, 67, 107, 187, 179, 129, 109, 96, 134, 241, 3, 100, 209, 75, 108, 38, 110, 251, 98, 115, 151, 174, 142, 16, 199, 100, 139, 152, 11, 252, 92, 18, 182, 38, 156, 217, 229, 190, 245, 54, 58, 225, 172, 119, 235, 20, 230, 154, 40, 49, 126, 16, 186, 225, 10, 85, 198, 159, 110, 174, 245, 207, 9, 160, 233, 250, 110, 232, 182, 221, 174, 27, 187, 139, 110, 127, 98, 137, 40, 180, 145, 55, 242, 70, 222, 200, 39, 243, 77, 213, 98, 97, 6, 56, 154, 101, 247, 5, 26, 39, 198, 176, 66, 159, 144, 108, 69, 14, 115, 42, 125, 253, 148, 248, 155, 200, 19, 246, 161, 176, 65, 28, 56, 116, 232, 41, 58, 69, 52, 21, 135, 13, 82, 135, 134, 130, 19, 213, 30, 150, 194, 121, 82, 39, 81, 4, 20, 54, 72, 39, 35, 161, 56, 109, 194, 231, 105, 8, 173, 147, 127, 159, 166, 105, 78, 59, 159, 83, 56, 91, 167, 32, 107, 145, 96, 54, 120, 203, 74, 113, 70, 71, 156, 211, 17, 152, 158, 124, 239, 201, 87, 199, 153, 201, 56, 120, 16, 190, 91, 74, 183, 93, 101, 40, 154, 68, 33, 241, 192, 250, 57, 70, 116, 147, 34, 139, 61, 128, 77, 224, 179, 215, 148, 166, 218, 151, 148, 113, 26, 73, 147, 114, 80, 92, 30, 9, 217, 33, 46, 147, 124, 75, 206, 154, 87, 30, 26, 192, 46, 214, 95, 129, 114, 67, 228, 99, 123, 245, 248, 103, 47, 105, 72, 241, 118, 92, 43, 106, 188, 205, 169, 31, 185, 41, 37, 159, 44, 129, 223, 169, 56, 199, 226, 202, 137, 21, 136, 211, 191, 77, 57, 27, 235, 75, 134, 135, 243, 125, 230, 200, 203, 247, 167, 61, 35, 34, 90, 106, 92, 84, 12, 102, 104, 42, 158, 176, 25, 168, 10, 253, 254, 247, 64, 14, 232, 2, 6, 59, 122, 18, 113, 150, 90, 65, 166, 73, 36, 252, 85, 118, 41, 136, 76, 85, 26, 186, 68, 209, 241, 199, 44, 41, 192, 83, 69, 21, 149, 85, 86, 89, 101, 149, 85, 86, 89, 101, 149, 85, 81, 69, 21, 85, 84, 209, 32, 101, 221, 166, 156, 242, 223, 157, 5, 27, 202, 132, 205, 250, 246, 57, 39, 224, 163, 223, 210, 105, 255, 34, 75, 236, 107, 147, 35, 74, 40, 77, 69, 51, 31, 174, 75, 38, 68, 105, 245, 201, 202, 79, 165, 231, 61, 214, 254, 82, 244, 185, 230, 68, 55, 94, 23, 23, 59, 125, 158, 111, 56, 91, 252, 104, 218, 207, 87, 95, 231, 135, 99, 239, 220, 159, 224, 190, 51, 75, 216, 32, 244, 247, 97, 18, 75, 172, 235, 135, 80, 109, 120, 249, 235, 129, 152, 139, 225, 47, 181, 50, 39, 190, 14, 57, 107, 12, 92, 57, 13, 245, 227, 2, 185, 248, 138, 198, 219, 207, 68, 24, 171, 118, 18, 89, 41, 234, 212, 216, 169, 181, 53, 142, 30, 86, 226, 225, 8, 30, 85, 114, 72, 179, 85, 39, 220, 2, 175, 31, 33, 144, 168, 224, 183, 85, 74, 166, 137, 150, 77, 162, 105, 19, 110, 73, 68, 74, 11, 255, 69, 240, 192, 214, 103, 204, 196, 88, 154, 113, 58, 54, 9, 121, 245, 88, 17, 201, 232, 251, 35, 68, 34, 186, 157, 67, 51, 53, 64, 2, 89, 25, 172, 125, 216, 171, 78, 109, 103, 232, 76, 88, 255, 193, 36, 162, 137, 90, 94, 179, 54, 72, 74, 101, 99, 144, 47, 111, 253, 152, 35, 146, 13, 29, 167, 195, 221, 155, 31, 162, 94, 65, 1, 88, 68, 237, 247, 223, 175, 195, 140, 101, 58, 108, 201, 92, 69, 91, 131, 186, 245, 170, 59, 205, 156, 125, 229, 6, 31, 192, 21, 118, 40, 189, 215, 225, 89, 240, 145, 39, 156, 112, 237, 137, 215, 181, 66, 155, 155, 88, 50, 198, 27, 246, 16, 132, 173, 75, 12, 117, 110, 232, 139, 52, 220, 171, 149, 233, 215, 181, 240, 94, 16, 12, 36, 201, 88, 40, 199, 1, 233, 176, 67, 189, 95, 99, 119, 185, 172, 11, 140, 38, 32, 39, 202, 240, 8, 236, 217, 157, 34, 36, 118, 205, 117, 17, 86, 119, 81, 71, 52, 159, 144, 232, 43, 176, 45, 107, 201, 134, 106, 224, 216, 16, 5, 112, 100, 87, 64, 91, 137, 241, 112, 134, 170, 242, 68, 93, 193, 179, 219, 132, 241, 222, 24, 90, 242, 96, 164, 197, 16, 169, 181, 95, 128, 85, 219, 71, 102, 61, 41, 18, 182, 239, 59, 172, 219, 90, 245, 186, 216, 128, 68, 226, 192, 2, 201, 198, 217, 162, 202, 179, 217, 111, 126, 175, 116, 189, 73, 199, 251, 97, 26, 15, 199, 163, 94, 105, 238, 238, 158, 236, 0, 118, 213, 59, 110, 95, 115, 111, 250, 117, 50, 219, 231, 234, 100, 129, 156, 105, 250, 35, 71, 95, 166, 103, 195, 50, 159, 220, 142, 129, 12, 123, 140, 33, 62, 8, 4, 126, 177, 167, 155, 49, 56, 206, 188, 141, 220, 57, 110, 204, 56, 39, 146, 140, 93, 138, 45, 212, 217, 118, 70, 10, 91, 205, 13, 179, 250, 229, 105, 213, 165, 210, 107, 239, 60, 164, 154, 4, 173, 44, 114, 51, 133, 34, 142, 132, 37, 49, 252, 230, 14, 184, 62, 24, 213, 106, 61, 173, 182, 161, 246, 86, 161, 140, 171, 234, 179, 226, 145, 62, 22, 8, 57, 198, 116, 12, 39, 52, 216, 224, 193, 156, 11, 101, 180, 103, 87, 224, 19, 239, 57, 171, 220, 180, 143, 4, 191, 72, 196, 101, 140, 14, 86, 223, 212, 175, 196, 165, 230, 56, 249, 160, 64, 115, 67, 212, 150, 71, 210, 158, 120, 221, 44, 164, 18, 111, 238, 87, 213, 175, 44, 26, 58, 238, 109, 105, 246, 119, 181, 49, 112, 39, 59, 123, 106, 185, 55, 74, 43, 46, 107, 93, 214, 68, 234, 218, 116, 198, 68, 37, 52, 11, 245, 186, 229, 173, 233, 237, 98, 128, 14, 110, 91, 23, 89, 201, 191, 129, 60, 36, 222, 182, 177, 137, 21, 207, 106, 251, 194, 34, 201, 75, 161, 96, 185, 100, 143, 161, 5, 46, 130, 100, 243, 238, 104, 203, 251, 68, 152, 227, 1, 162, 180, 28, 38, 180, 138, 19, 121, 48, 129, 72, 205, 3, 114, 187, 137, 49, 24, 152, 81, 184, 45, 201, 150, 230, 254, 215, 110, 128, 108, 213, 240, 68, 65, 244, 6, 186, 220, 118, 163, 3, 181, 253, 99, 45, 150, 124, 38, 252, 5, 121, 84, 78, 154, 187, 13, 5, 241, 171, 223, 177, 105, 215, 237, 205, 44, 238, 6, 10, 104, 114, 146, 61, 111, 87, 191, 198, 13, 222, 122, 113, 250, 229, 249, 21, 52, 142, 197, 78, 75, 129, 198, 48, 174, 210, 252, 76, 244, 179, 230, 60, 204, 183, 66, 196, 218, 119, 146, 25, 128, 119, 89, 112, 103, 71, 229, 239, 217, 97, 199, 33, 54, 144, 78, 57, 220, 228, 243, 122, 91, 118, 193, 252, 150, 204, 163, 109, 121, 164, 195, 133, 167, 19, 100, 46, 79, 250, 223, 57, 133, 220, 248, 167, 241, 187, 207, 96, 57, 85, 178, 80, 254, 89, 84, 159, 28, 255, 179, 75, 244, 204, 97, 151, 200, 145, 195, 46, 161, 51, 7, 226, 218, 154, 235, 221, 181, 250, 218, 232, 229, 4, 35, 91, 175, 11, 102, 250, 100, 22, 79, 234, 203, 170, 164, 195, 225, 185, 224, 213, 251, 76, 9, 67, 212, 192, 158, 163, 19, 180, 212, 53, 123, 221, 220, 123, 58, 194, 174, 147, 28, 164, 199, 219, 230, 240, 65, 82, 48, 5, 34, 5, 2, 129, 64, 52, 100, 18, 72, 18, 8, 4, 2, 105, 216, 100, 176, 100, 48, 24, 236, 113, 165, 227, 121, 237, 248, 83, 174, 248, 249, 88, 121, 149, 223, 31, 217, 194, 120, 225, 35, 68, 85, 221, 137, 51, 152, 126, 203, 125, 116, 202, 116, 52, 37, 42, 66, 52, 162, 72, 73, 144, 134, 20, 43, 11, 118, 121, 73, 64, 121, 101, 203, 75, 46, 141, 249, 106, 122, 229, 139, 125, 82, 90, 174, 68, 252, 137, 169, 42, 117, 131, 211, 26, 222, 180, 174, 163, 18, 109, 236, 185, 104, 156, 184, 222, 56, 117, 195, 199, 153, 42, 23, 253, 72, 219, 22, 154, 231, 227, 230, 215, 28, 153, 177, 145, 87, 179, 84, 139, 187, 220, 162, 151, 49, 187, 90, 26, 174, 136, 130, 90, 151, 63, 126, 167, 128, 177, 235, 145, 146, 146, 200, 157, 202, 127, 79, 209, 45, 22, 222, 60, 245, 227, 91, 222, 82, 116, 177, 90, 250, 65, 119, 29, 104, 191, 142, 240, 226, 246, 20, 174, 208, 84, 16, 24, 185, 25, 17, 68, 242, 215, 146, 232, 45, 134, 115, 83, 244, 149, 21, 170, 58, 227, 94, 241, 229, 161, 238, 34, 211, 172, 94, 108, 150, 212, 123, 177, 78, 185, 14, 172, 193, 163, 18, 198, 108, 93, 163, 230, 84, 145, 25, 53, 108, 106, 107, 13, 122, 61, 86, 143, 14, 172, 70, 165, 168, 190, 248, 127, 158, 228, 21, 174, 139, 15, 212, 37, 3, 241, 195, 30, 172, 90, 171, 165, 33, 149, 120, 85, 218, 226, 90, 81, 61, 47, 59, 47, 144, 145, 164, 207, 218, 203, 86, 201, 126, 251, 112, 193, 109, 9, 223, 90, 235, 184, 164, 82, 102, 229, 197, 111, 73, 166, 117, 246, 227, 171, 92, 91, 178, 124, 240, 223, 176, 84, 117, 253, 17, 153, 93, 94, 229, 235, 135, 116, 186, 243, 227, 140, 212, 138, 74, 43, 79, 49, 7, 253, 121, 221, 54, 31, 0, 255, 118, 31, 250, 189, 109, 201, 118, 49, 233, 108, 207, 1, 54, 231, 133, 203, 238, 230, 233, 9, 175, 116, 54, 176, 165, 201, 238, 131, 45, 209, 63, 228, 227, 63, 240, 95, 226, 81, 202, 27, 74, 251, 35, 82, 200, 145, 11, 21, 218, 101, 13, 191, 57, 213, 244, 67, 27, 10, 240, 20, 68, 105, 199, 183, 245, 169, 221, 147, 207, 195, 126, 236, 95, 21, 163, 105, 210, 71, 15, 93, 251, 31, 165, 144, 163, 106, 192, 69, 134, 56, 247, 242, 36, 109, 204, 253, 224, 194, 246, 0, 112, 238, 15, 57, 44, 134, 59, 168, 71, 213, 119, 37, 109, 5, 193, 237, 146, 210, 144, 195, 102, 41, 24, 250, 43, 142, 155, 218, 60, 1, 140, 43, 63, 222, 115, 91, 46, 87, 84, 143, 59, 253, 22, 187, 204, 174, 176, 36, 40, 61, 126, 177, 61, 254, 92, 223, 158, 46, 99, 103, 109, 202, 126, 250, 6, 151, 109, 170, 7, 158, 254, 227, 153, 18, 132, 158, 248, 34, 27, 174, 153, 84, 175, 204, 150, 226, 248, 241, 146, 237, 181, 206, 92, 227, 62, 131, 199, 78, 23, 176, 22, 83, 239, 131, 252, 170, 1, 175, 167, 79, 158, 187, 185, 6, 141, 141, 110, 208, 121, 175, 88, 197, 117, 85, 223, 40, 227, 36, 252, 138, 18, 31, 122, 47, 183, 212, 129, 179, 83, 42, 29, 251, 241, 198, 78, 196, 71, 168, 114, 132, 37, 96, 171, 121, 79, 71, 236, 166, 189, 254, 142, 34, 64, 112, 2, 216, 186, 217, 21, 42, 96, 26, 108, 200, 73, 20, 219, 3, 67, 111, 47, 82, 186, 95, 155, 57, 14, 195, 165, 28, 158, 244, 50, 20, 0, 69, 83, 130, 104, 105, 171, 95, 36, 224, 197, 216, 176, 173, 251, 153, 25, 68, 183, 168, 178, 224, 30, 106, 5, 75, 139, 46, 71, 201, 238, 25, 233, 225, 16, 128, 215, 155, 232, 190, 188, 106, 143, 45, 62, 117, 95, 254, 51, 58, 9, 120, 246, 186, 56, 146, 134, 252, 73, 125, 229, 14, 255, 137, 70, 133, 10, 241, 96, 129, 63, 189, 213, 6, 99, 98, 0, 80, 168, 58, 117, 83, 255, 78, 80, 247, 113, 41, 231, 212, 172, 160, 173, 109, 147, 110, 249, 218, 7, 135, 155, 191, 1, 197, 198, 16, 253, 15, 188, 19, 52, 37, 25, 253, 85, 188, 213, 149, 242, 6, 110, 126, 34, 134, 120, 153, 18, 252, 215, 245, 26, 220, 249, 117, 48, 229, 73, 155, 101, 238, 121, 225, 124, 94, 105, 108, 141, 205, 80, 114, 62, 232, 211, 156, 124, 172, 233, 211, 193, 118, 81, 162, 174, 182, 229, 128, 148, 222, 242, 106, 219, 125, 220, 60, 78, 103, 31, 139, 197, 171, 23, 246, 216, 63, 100, 158, 171, 123, 21, 170, 190, 76, 62, 169, 213, 142, 49, 134, 221, 74, 138, 220, 15, 154, 146, 248, 53, 54, 243, 138, 31, 229, 224, 10, 118, 252, 56, 195, 157, 71, 168, 129, 253, 212, 251, 72, 66, 253, 134, 201, 23, 218, 7, 59, 35, 96, 16, 31, 171, 86, 109, 236, 4, 130, 170, 166, 169, 247, 9, 21, 233, 21, 129, 99, 132, 190, 58, 254, 106, 78, 213, 2, 74, 229, 17, 89, 28, 168, 156, 94, 132, 68, 84, 29, 35, 15, 235, 62, 23, 210, 18, 68, 219, 12, 132, 74, 3, 26, 193, 225, 37, 4, 52, 187, 10, 13, 173, 231, 37, 134, 160, 208, 210, 234, 80, 218, 1, 104, 125, 109, 39, 180, 178, 42, 245, 64, 182, 201, 151, 187, 189, 37, 127, 195, 42, 21, 57, 183, 34, 9, 134, 195, 170, 108, 202, 195, 57, 26, 102, 26, 153, 137, 253, 70, 170, 97, 102, 62, 199, 121, 26, 65, 94, 118, 186, 218, 20, 144, 208, 154, 15, 67, 121, 36, 202, 137, 180, 84, 39, 149, 142, 66, 12, 136, 187, 216, 164, 230, 113, 96, 152, 98, 155, 30, 12, 251, 199, 132, 158, 142, 195, 81, 226, 125, 22, 27, 226, 44, 181, 212, 220, 248, 86, 220, 102, 38, 45, 249, 66, 125, 245, 230, 179, 217, 242, 204, 32, 99, 21, 140, 247, 175, 248, 2, 38, 232, 24, 97, 122, 215, 190, 162, 143, 249, 208, 154, 186, 116, 42, 156, 142, 82, 123, 19, 254, 229, 52, 39, 64, 148, 44, 15, 55, 16, 248, 58, 190, 119, 17, 110, 136, 168, 60, 36, 209, 191, 23, 133, 8, 112, 184, 221, 128, 96, 180, 174, 204, 115, 2, 109, 30, 238, 60, 244, 0, 148, 223, 212, 166, 31, 165, 226, 219, 187, 136, 180, 139, 20, 3, 170, 27, 29, 108, 95, 85, 136, 60, 183, 164, 154, 220, 172, 160, 245, 107, 66, 76, 241, 229, 118, 139, 186, 15, 145, 6, 183, 164, 229, 56, 245, 170, 107, 172, 226, 97, 168, 164, 74, 119, 97, 17, 21, 72, 116, 169, 153, 225, 154, 12, 202, 0, 243, 121, 33, 254, 176, 174, 202, 107, 153, 132, 19, 20, 148, 146, 34, 196, 225, 123, 11, 0, 203, 17, 72, 3, 161, 49, 57, 84, 53, 84, 201, 87, 145, 1, 77, 133, 92, 194, 174, 48, 84, 76, 58, 69, 200, 65, 97, 188, 161, 68, 94, 127, 120, 61, 12, 90, 113, 189, 170, 233, 234, 90, 197, 56, 106, 156, 74, 43, 186, 138, 193, 180, 142, 141, 92, 37, 38, 59, 21, 116, 179, 212, 99, 228, 22, 78, 180, 251, 62, 112, 0, 83, 29, 185, 42, 198, 150, 204, 205, 188, 170, 116, 112, 184, 69, 39, 98, 123, 20, 182, 80, 49, 215, 71, 35, 32, 110, 188, 235, 150, 98, 177, 238, 111, 146, 164, 42, 49, 171, 115, 88, 57, 24, 191, 82, 77, 45, 79, 43, 144, 103, 160, 52, 102, 18, 241, 159, 226, 208, 178, 41, 92, 78, 148, 188, 2, 251, 146, 57, 93, 168, 81, 195, 179, 236, 229, 126, 189, 140, 119, 23, 43, 152, 142, 215, 217, 209, 254, 10, 7, 183, 4, 214, 30, 195, 254, 24, 76, 16, 68, 217, 4, 71, 35, 221, 98, 48, 226, 50, 23, 180, 187, 211, 252, 152, 251, 18, 127, 84, 120, 57, 59, 178, 215, 211, 49, 70, 163, 45, 146, 172, 25, 109, 36, 252, 127, 215, 216, 115, 255, 33, 10, 68, 64, 219, 13, 84, 45, 157, 31, 159, 115, 8, 167, 105, 133, 174, 232, 75, 234, 175, 80, 184, 138, 30, 112, 59, 225, 40, 10, 39, 203, 139, 247, 203, 252, 97, 18, 54, 221, 240, 213, 142, 105, 242, 251, 229, 206, 63, 249, 91, 36, 74, 199, 131, 247, 211, 99, 119, 31, 117, 166, 169, 217, 89, 203, 39, 221, 56, 194, 148, 50, 63, 123, 142, 119, 6, 197, 206, 87, 35, 28, 32, 16, 225, 72, 172, 207, 105, 164, 166, 35, 102, 205, 194, 25, 94, 230, 77, 115, 118, 229, 39, 140, 214, 63, 202, 8, 68, 229, 53, 133, 117, 160, 146, 20, 46, 231, 119, 192, 240, 73, 253, 183, 98, 158, 6, 109, 186, 21, 50, 173, 112, 57, 223, 68, 43, 52, 206, 174, 29, 65, 31, 7, 83, 244, 179, 27, 228, 139, 88, 126, 198, 108, 245, 225, 225, 247, 162, 212, 91, 80, 13, 105, 105, 1, 194, 179, 135, 109, 229, 235, 15, 14, 56, 73, 124, 89, 75, 186, 250, 133, 142, 27, 237, 149, 92, 134, 97, 23, 218, 253, 33, 170, 251, 26, 2, 31, 185, 89, 255, 128, 252, 100, 208, 14, 61, 168, 96, 96, 165, 1, 103, 16, 84, 157, 103, 143, 0, 8, 216, 209, 241, 154, 37, 107, 71, 70, 137, 95, 200, 57, 11, 113, 148, 217, 30, 92, 177, 102, 200, 67, 64, 167, 244, 67, 148, 88, 100, 5, 68, 40, 103, 0, 165, 105, 229, 98, 247, 175, 171, 17, 121, 210, 92, 241, 215, 61, 12, 123, 1, 129, 125, 218, 173, 151, 73, 227, 164, 166, 146, 10, 90, 128, 216, 102, 92, 178, 208, 68, 82, 171, 156, 158, 62, 250, 212, 138, 189, 186, 118, 242, 156, 97, 181, 156, 212, 138, 27, 6, 7, 71, 201, 162, 175, 65, 68, 183, 218, 222, 241, 212, 218, 62, 110, 191, 29, 228, 226, 64, 136, 188, 35, 162, 111, 214, 230, 44, 129, 195, 160, 73, 193, 215, 244, 46, 111, 19, 188, 221, 100, 133, 231, 187, 26, 26, 220, 63, 167, 0, 101, 74, 82, 195, 238, 114, 45, 199, 166, 54, 227, 62, 191, 102, 208, 219, 78, 244, 163, 137, 50, 53, 93, 111, 184, 25, 52, 254, 96, 90, 250, 181, 245, 18, 157, 28, 71, 156, 85, 3, 246, 228, 143, 244, 102, 142, 57, 25, 225, 66, 219, 196, 53, 38, 252, 115, 186, 242, 62, 200, 42, 156, 39, 126, 223, 182, 3, 243, 35, 32, 241, 68, 212, 244, 19, 80, 229, 137, 167, 233, 39, 156, 166, 159, 104, 154, 126, 130, 233, 120, 39, 150, 116, 43, 73, 101, 170, 230, 130, 11, 193, 147, 95, 60, 245, 4, 135, 109, 19, 197, 197, 197, 245, 83, 200, 110, 43, 137, 254, 201, 113, 142, 164, 241, 136, 21, 161, 221, 139, 69, 217, 65, 221, 248, 149, 110, 11, 138, 11, 68, 216, 229, 36, 126, 182, 48, 211, 218, 130, 46, 43, 193, 29, 14, 115, 121, 137, 166, 229, 203, 10, 40, 37, 199, 109, 22, 29, 186, 239, 14, 125, 194, 26, 78, 205, 153, 157, 247, 211, 14, 151, 101, 189, 109, 10, 221, 108, 164, 90, 119, 226, 147, 160, 222, 161, 96, 144, 94, 240, 155, 78, 77, 82, 133, 153, 231, 54, 200, 188, 85, 9, 59, 47, 132, 225, 37, 227, 88, 218, 68, 240, 249, 249, 106, 184, 226, 40, 245, 229, 114, 126, 97, 188, 22, 213, 242, 219, 86, 247, 117, 126, 45, 118, 240, 11, 137, 15, 17, 124, 34, 234, 77, 103, 199, 243, 72, 59, 185, 36, 196, 45, 128, 67, 79, 240, 117, 91, 137, 96, 191, 85, 220, 49, 243, 46, 68, 59, 140, 8, 179, 85, 40, 7, 189, 138, 106, 235, 65, 237, 189, 232, 78, 152, 45, 96, 98, 66, 83, 0, 137, 145, 88, 227, 146, 27, 100, 171, 151, 3, 68, 180, 192, 196, 156, 91, 253, 66, 67, 183, 126, 137, 69, 240, 76, 223, 47, 51, 165, 127, 115, 38, 187, 88, 162, 95, 199, 162, 117, 30, 230, 140, 59, 110, 21, 168, 146, 209, 90, 147, 204, 81, 223, 243, 243, 161, 98, 86, 238, 149, 188, 28, 83, 218, 201, 229, 158, 125, 94, 125, 207, 77, 126, 135, 61, 58, 125, 18, 15, 207, 87, 126, 132, 217, 196, 31, 244, 175, 10, 124, 121, 164, 140, 251, 171, 81, 241, 42, 25, 234, 98, 181, 30, 103, 69, 5, 203, 93, 102, 15, 24, 254, 136, 46, 69, 36, 236, 8, 117, 58, 229, 249, 195, 143, 95, 153, 237, 89, 223, 102, 79, 182, 233, 103, 215, 255, 130, 175, 204, 118, 146, 77, 159, 120, 122, 72, 23, 174, 79, 206, 64, 10, 251, 193, 16, 53, 67, 61, 51, 236, 243, 143, 9, 41, 160, 55, 170, 201, 216, 200, 9, 134, 70, 250, 126, 160, 62, 34, 31, 230, 35, 29, 34, 219, 250, 66, 226, 246, 111, 146, 190, 32, 112, 22, 6, 140, 118, 252, 130, 106, 71, 147, 48, 250, 147, 96, 79, 131, 199, 170, 169, 193, 61, 62, 244, 192, 89, 174, 196, 136, 90, 69, 109, 82, 232, 13, 139, 180, 39, 44, 84, 172, 171, 123, 133, 22, 74, 83, 13, 208, 195, 25, 53, 104, 84, 125, 226, 176, 177, 96, 223, 98, 34, 247, 190, 233, 189, 186, 98, 29, 72, 115, 74, 2, 238, 9, 183, 62, 14, 10, 12, 243, 110, 199, 176, 195, 14, 82, 167, 151, 84, 39, 59, 63, 97, 243, 199, 36, 220, 68, 219, 58, 25, 209, 118, 63, 33, 85, 151, 40, 74, 253, 200, 93, 133, 6, 1, 167, 219, 195, 197, 163, 74, 189, 125, 167, 130, 110, 128, 128, 57, 174, 119, 28, 88, 216, 156, 145, 40, 52, 182, 133, 198, 189, 178, 192, 232, 216, 226, 29, 76, 224, 184, 226, 163, 24, 163, 128, 208, 21, 191, 51, 108, 117, 7, 184, 95, 6, 87, 70, 18, 193, 134, 31, 21, 44, 5, 169, 24, 0, 25, 65, 107, 141, 117, 35, 140, 130, 70, 248, 209, 128, 163, 159, 40, 32, 164, 127, 252, 54, 230, 87, 171, 70, 219, 1, 76, 213, 222, 140, 203, 215, 61, 153, 112, 232, 80, 170, 170, 16, 29, 44, 198, 19, 57, 44, 82, 251, 201, 45, 188, 19, 22, 57, 210, 210, 72, 90, 164, 51, 202, 117, 78, 58, 48, 107, 171, 49, 244, 213, 99, 145, 29, 154, 212, 198, 54, 105, 247, 21, 31, 96, 227, 27, 37, 180, 184, 234, 178, 17, 175, 193, 23, 60, 185, 100, 243, 204, 128, 43, 196, 34, 214, 13, 97, 73, 119, 129, 211, 138, 160, 104, 102, 201, 90, 67, 164, 194, 25, 133, 78, 196, 2, 17, 176, 194, 200, 133, 86, 190, 197, 155, 132, 94, 73, 62, 132, 91, 12, 165, 136, 207, 187, 223, 74, 132, 38, 229, 33, 138, 111, 134, 190, 198, 168, 183, 161, 246, 187, 35, 226, 15, 134, 97, 58, 226, 159, 108, 37, 216, 24, 36, 218, 189, 40, 232, 190, 44, 95, 231, 90, 64, 208, 157, 4, 172, 58, 48, 203, 22, 15, 174, 144, 64, 148, 4, 141, 173, 58, 68, 122, 122, 42, 52, 248, 140, 87, 136, 26, 98, 84, 154, 233, 48, 139, 115, 167, 77, 161, 118, 71, 150, 97, 225, 70, 159, 163, 145, 142, 19, 20, 99, 200, 235, 181, 60, 45, 104, 174, 241, 17, 236, 131, 211, 149, 197, 167, 219, 130, 189, 246, 75, 195, 31, 159, 208, 138, 32, 143, 173, 242, 4, 206, 209, 48, 211, 230, 115, 43, 144, 182, 212, 134, 225, 141, 85, 213, 132, 2, 174, 82, 174, 47, 123, 123, 90, 164, 15, 127, 133, 26, 56, 46, 19, 47, 188, 132, 210, 34, 249, 57, 46, 90, 174, 175, 121, 119, 184, 214, 186, 145, 184, 240, 184, 190, 195, 59, 226, 82, 254, 154, 234, 134, 186, 192, 218, 47, 155, 106, 207, 181, 201, 107, 2, 120, 233, 234, 82, 218, 118, 119, 83, 49, 198, 161, 222, 234, 229, 251, 192, 140, 238, 158, 86, 53, 49, 76, 202, 202, 252, 244, 18, 121, 204, 1, 166, 85, 30, 165, 44, 136, 254, 129, 74, 24, 152, 64, 121, 136, 206, 115, 102, 28, 249, 188, 224, 138, 97, 226, 147, 28, 157, 41, 178, 122, 98, 28, 90, 6, 76, 42, 61, 110, 60, 181, 25, 26, 127, 54, 123, 188, 168, 105, 221, 49, 83, 237, 39, 231, 30, 51, 186, 25, 243, 184, 198, 5, 13, 241, 134, 249, 98, 195, 133, 6, 168, 187, 15, 153, 84, 117, 50, 70, 81, 6, 35, 46, 27, 221, 72, 158, 188, 74, 187, 192, 126, 171, 207, 16, 79, 232, 55, 0, 0, 229, 173, 190, 218, 118, 1, 63, 206, 194, 138, 231, 3, 193, 70, 66, 236, 64, 156, 65, 191, 42, 50, 173, 21, 128, 244, 12, 222, 81, 23, 159, 233, 209, 92, 55, 195, 79, 209, 38, 242, 234, 11, 57, 7, 11, 99, 113, 8, 95, 51, 172, 85, 151, 123, 78, 78, 3, 205, 214, 215, 117, 90, 27, 20, 216, 147, 180, 63, 220, 63, 96, 23, 199, 27, 235, 30, 36, 194, 9, 239, 232, 83, 169, 206, 203, 249, 254, 193, 168, 139, 140, 205, 108, 111, 68, 172, 164, 92, 182, 212, 249, 114, 42, 74, 97, 43, 125, 61, 113, 216, 248, 36, 183, 39, 210, 89, 63, 90, 198, 27, 68, 141, 52, 230, 189, 106, 142, 0, 89, 224, 4, 241, 29, 238, 233, 194, 143, 199, 65, 64, 220, 50, 199, 159, 41, 155, 187, 113, 46, 60, 196, 15, 213, 220, 88, 147, 158, 211, 141, 57, 201, 35, 88, 191, 21, 25, 190, 55, 49, 224, 178, 5, 72, 104, 189, 210, 82, 251, 172, 62, 86, 148, 122, 212, 182, 187, 6, 110, 191, 80, 189, 61, 8, 58, 249, 84, 197, 192, 187, 93, 113, 175, 71, 228, 171, 112, 142, 47, 64, 142, 116, 249, 97, 171, 107, 215, 185, 36, 187, 246, 70, 0, 86, 82, 208, 99, 153, 101, 86, 148, 172, 75, 142, 42, 225, 80, 238, 196, 56, 186, 173, 134, 97, 81, 234, 232, 116, 157, 203, 120, 255, 187, 162, 70, 158, 15, 30, 191, 232, 129, 228, 41, 181, 114, 16, 58, 10, 171, 20, 211, 230, 69, 220, 199, 160, 67, 158, 78, 66, 43, 104, 43, 124, 147, 139, 87, 217, 100, 207, 180, 204, 173, 47, 55, 238, 8, 108, 95, 5, 154, 201, 152, 230, 84, 136, 130, 86, 164, 103, 212, 211, 108, 85, 96, 138, 119, 87, 71, 57, 60, 4, 164, 59, 146, 132, 66, 126, 125, 187, 226, 20, 158, 72, 160, 16, 250, 67, 199, 70, 222, 22, 175, 89, 199, 180, 233, 239, 205, 121, 148, 186, 184, 76, 99, 152, 226, 28, 8, 116, 130, 100, 68, 33, 141, 64, 252, 129, 141, 60, 69, 73, 16, 85, 138, 155, 241, 163, 42, 88, 92, 12, 90, 131, 38, 212, 10, 249, 202, 114, 251, 97, 0, 148, 139, 162, 20, 127, 193, 174, 133, 92, 137, 103, 40, 33, 30, 47, 87, 248, 202, 32, 157, 46, 54, 29, 217, 39, 44, 53, 127, 70, 135, 129, 249, 121, 199, 218, 241, 123, 89, 76, 151, 146, 231, 26, 178, 130, 86, 42, 45, 52, 127, 137, 95, 26, 6, 81, 238, 93, 202, 185, 208, 239, 42, 119, 18, 100, 138, 229, 24, 239, 146, 226, 92, 226, 161, 53, 143, 197, 119, 89, 0, 12, 151, 33, 165, 106, 52, 204, 205, 127, 38, 55, 131, 215, 27, 143, 225, 178, 206, 200, 217, 13, 12, 49, 34, 199, 157, 123, 171, 239, 62, 231, 251, 175, 78, 251, 165, 46, 85, 81, 53, 151, 247, 46, 186, 157, 174, 142, 105, 52, 19, 203, 142, 54, 180, 236, 53, 77, 187, 97, 30, 7, 245, 11, 216, 138, 14, 23, 87, 61, 176, 14, 174, 74, 91, 214, 161, 75, 247, 245, 238, 160, 132, 234, 51, 151, 100, 32, 107, 180, 127, 64, 165, 116, 131, 237, 253, 155, 98, 229, 177, 244, 191, 119, 58, 230, 47, 208, 33, 28, 157, 175, 219, 128, 75, 191, 83, 36, 245, 46, 124, 150, 42, 177, 239, 88, 92, 9, 209, 52, 119, 217, 125, 226, 241, 228, 220, 153, 81, 99, 61, 243, 164, 255, 152, 232, 240, 150, 135, 226, 3, 17, 159, 177, 135, 132, 233, 69, 41, 16, 144, 135, 72, 135, 201, 196, 226, 224, 126, 57, 53, 89, 52, 239, 97, 68, 139, 83, 97, 88, 235, 14, 164, 194, 61, 60, 211, 129, 227, 145, 99, 251, 198, 207, 149, 7, 8, 18, 143, 81, 62, 141, 175, 70, 180, 163, 243, 114, 9, 105, 92, 241, 86, 77, 216, 233, 247, 137, 206, 50, 91, 35, 67, 72, 155, 229, 157, 39, 51, 198, 52, 153, 224, 130, 33, 238, 212, 143, 241, 207, 123, 63, 246, 14, 14, 134, 187, 179, 238, 223, 62, 210, 5, 126, 75, 223, 34, 167, 228, 187, 184, 207, 105, 1, 38, 23, 223, 161, 78, 161, 119, 108, 145, 171, 252, 109, 220, 219, 6, 118, 44, 63, 248, 201, 201, 193, 215, 226, 189, 179, 146, 95, 6, 138, 41, 125, 188, 34, 146, 210, 178, 99, 209, 90, 19, 56, 234, 170, 132, 107, 179, 165, 217, 184, 200, 22, 143, 148, 104, 182, 59, 41, 16, 213, 133, 157, 41, 96, 115, 204, 194, 253, 103, 186, 197, 38, 133, 59, 93, 90, 118, 146, 76, 145, 175, 173, 180, 220, 52, 252, 52, 107, 220, 104, 182, 217, 245, 220, 56, 4, 132, 55, 171, 124, 250, 39, 122, 178, 138, 192, 233, 244, 11, 89, 153, 114, 179, 161, 165, 138, 55, 163, 116, 250, 199, 234, 114, 184, 126, 71, 134, 75, 228, 102, 155, 164, 177, 37, 181, 111, 99, 182, 74, 215, 254, 146, 59, 230, 78, 205, 148, 84, 135, 194, 169, 94, 115, 88, 159, 151, 132, 31, 2, 199, 64, 55, 173, 227, 86, 202, 57, 141, 254, 10, 202, 227, 121, 211, 82, 205, 148, 168, 80, 209, 105, 187, 4, 69, 30, 21, 224, 57, 1, 87, 7, 117, 197, 170, 71, 201, 199, 3, 230, 93, 59, 24, 17, 61, 82, 161, 108, 32, 70, 53, 83, 83, 80, 22, 160, 105, 14, 52, 148, 232, 211, 122, 129, 228, 13, 63, 241, 26, 89, 224, 207, 70, 237, 186, 160, 91, 244, 5, 6, 37, 135, 248, 71, 167, 181, 166, 87, 30, 243, 14, 120, 182, 168, 216, 77, 67, 213, 99, 81, 192, 168, 31, 115, 80, 144, 136, 205, 73, 200, 96, 205, 17, 225, 22, 152, 191, 62, 117, 216, 112, 163, 141, 112, 135, 185, 100, 225, 76, 216, 104, 166, 54, 12, 231, 128, 206, 192, 66, 48, 114, 5, 62, 253, 73, 216, 25, 62, 216, 225, 1, 130, 102, 62, 119, 12, 231, 197, 35, 225, 42, 191, 165, 221, 156, 220, 82, 184, 226, 251, 241, 245, 250, 39, 81, 142, 233, 155, 148, 193, 88, 128, 231, 249, 84, 213, 36, 110, 227, 224, 39, 110, 8, 20, 219, 218, 215, 237, 239, 248, 139, 69, 38, 224, 21, 111, 249, 143, 150, 224, 117, 252, 11, 217, 96, 193, 213, 192, 36, 85, 225, 65, 233, 223, 187, 6, 255, 76, 70, 231, 115, 142, 25, 203, 197, 199, 206, 255, 123, 94, 31, 206, 206, 57, 37, 187, 20, 255, 62, 231, 21, 206, 189, 181, 100, 59, 103, 75, 203, 29, 82, 244, 235, 156, 158, 214, 9, 164, 235, 93, 87, 46, 238, 224, 177, 124, 202, 245, 153, 132, 107, 163, 98, 7, 104, 159, 247, 61, 10, 212, 51, 157, 17, 194, 145, 125, 8, 10, 64, 36, 28, 7, 143, 149, 240, 96, 162, 178, 101, 222, 171, 30, 188, 173, 194, 68, 96, 24, 10, 46, 114, 254, 128, 246, 204, 217, 3, 40, 103, 80, 107, 132, 31, 121, 201, 91, 84, 3, 81, 103, 144, 158, 22, 239, 242, 173, 29, 176, 131, 102, 205, 98, 183, 37, 54, 143, 103, 227, 60, 131, 117, 142, 115, 13, 96, 76, 112, 94, 46, 99, 162, 11, 206, 34, 7, 109, 48, 183, 92, 254, 59, 202, 179, 180, 30, 96, 144, 128, 162, 230, 167, 145, 132, 110, 74, 203, 21, 200, 207, 54, 204, 194, 1, 1, 73, 24, 32, 220, 189, 115, 186, 36, 238, 210, 172, 187, 237, 136, 206, 128, 12, 127, 243, 85, 155, 179, 176, 33, 217, 147, 79, 147, 145, 203, 230, 253, 14, 139, 232, 13, 50, 97, 217, 60, 97, 31, 186, 210, 230, 48, 91, 65, 213, 246, 78, 31, 30, 113, 244, 61, 187, 160, 52, 52, 177, 241, 196, 57, 61, 100, 7, 234, 91, 144, 61, 43, 49, 156, 5, 45, 236, 173, 10, 144, 1, 28, 120, 194, 16, 105, 98, 209, 106, 17, 19, 178, 64, 9, 230, 41, 201, 11, 17, 209, 180, 51, 15, 155, 109, 167, 72, 163, 101, 195, 116, 36, 77, 204, 104, 118, 177, 15, 130, 67, 154, 208, 240, 143, 62, 204, 184, 186, 127, 167, 54, 1, 236, 111, 171, 185, 80, 187, 206, 78, 111, 73, 211, 67, 182, 143, 210, 28, 110, 138, 221, 158, 68, 252, 53, 0, 158, 6, 175, 34, 190, 86, 189, 147, 155, 27, 66, 106, 65, 58, 102, 204, 174, 8, 231, 89, 92, 140, 140, 30, 37, 49, 160, 149, 204, 156, 231, 60, 205, 134, 84, 207, 35, 31, 104, 1, 248, 193, 236, 159, 239, 76, 27, 205, 25, 230, 119, 154, 79, 27, 135, 37, 200, 44, 63, 23, 180, 120, 179, 82, 28, 171, 186, 254, 94, 116, 103, 17, 66, 211, 240, 189, 138, 85, 240, 57, 132, 235, 255, 118, 127, 28, 84, 110, 91, 48, 132, 31, 135, 166, 84, 217, 26, 135, 178, 139, 47, 58, 114, 56, 238, 73, 248, 251, 60, 203, 39, 88, 157, 6, 90, 202, 190, 131, 201, 200, 252, 127, 20, 120, 183, 52, 18, 56, 139, 187, 231, 124, 147, 153, 74, 76, 21, 64, 64, 51, 138, 0, 23, 140, 0, 235, 36, 102, 34, 112, 122, 69, 182, 15, 35, 95, 15, 57, 104, 178, 17, 177, 89, 178, 224, 81, 180, 177, 244, 63, 74, 229, 29, 179, 54, 36, 98, 67, 205, 197, 213, 20, 53, 108, 157, 78, 154, 115, 99, 221, 231, 90, 61, 229, 222, 70, 176, 162, 160, 187, 89, 46, 238, 129, 2, 7, 56, 165, 173, 147, 44, 0, 58, 204, 251, 19, 231, 15, 10, 99, 178, 87, 86, 9, 102, 100, 100, 152, 84, 189, 6, 209, 27, 244, 183, 8, 136, 118, 84, 20, 220, 34, 111, 76, 228, 93, 178, 187, 215, 84, 35, 89, 217, 68, 135, 126, 143, 103, 54, 185, 1, 184, 229, 178, 39, 187, 111, 114, 125, 46, 242, 63, 169, 249, 220, 160, 230, 169, 60, 125, 119, 119, 252, 125, 237, 75, 115, 124, 223, 127, 142, 63, 199, 237, 81, 225, 127, 28, 105, 169, 55, 251, 159, 185, 82, 229, 250, 226, 233, 178, 116, 207, 154, 169, 166, 76, 141, 23, 89, 2, 166, 92, 52, 242, 116, 21, 85, 101, 25, 187, 14, 105, 107, 232, 164, 76, 163, 21, 64, 50, 81, 56, 136, 188, 117, 158, 49, 22, 65, 72, 59, 141, 114, 113, 177, 91, 164, 94, 181, 32, 23, 244, 72, 233, 163, 193, 66, 85, 210, 164, 4, 17, 212, 125, 241, 85, 34, 44, 163, 90, 59, 127, 161, 144, 161, 222, 207, 0, 81, 148, 103, 149, 139, 56, 185, 106, 205, 161, 91, 112, 14, 209, 156, 147, 20, 89, 35, 250, 128, 73, 171, 29, 245, 80, 162, 187, 195, 231, 175, 207, 177, 209, 46, 117, 47, 192, 120, 65, 14, 120, 20, 220, 97, 123, 34, 250, 101, 16, 11, 192, 131, 180, 247, 110, 0, 167, 248, 195, 51, 205, 227, 99, 57, 233, 183, 72, 55, 10, 209, 234, 248, 56, 177, 215, 85, 51, 220, 87, 223, 235, 108, 245, 159, 135, 207, 223, 174, 219, 81, 101, 250, 4, 48, 105, 219, 177, 191, 226, 165, 94, 30, 94, 145, 166, 212, 201, 213, 29, 139, 191, 182, 206, 56, 61, 26, 194, 119, 224, 9, 34, 8, 145, 15, 46, 91, 129, 254, 124, 204, 70, 112, 218, 86, 201, 7, 156, 126, 33, 212, 8, 45, 170, 171, 223, 190, 193, 174, 89, 145, 159, 200, 135, 195, 14, 104, 38, 109, 161, 246, 241, 179, 202, 147, 72, 60, 53, 139, 181, 142, 71, 32, 238, 254, 9, 53, 70, 99, 15, 157, 236, 208, 67, 126, 97, 223, 100, 106, 168, 174, 174, 172, 241, 5, 150, 76, 52, 177, 150, 191, 101, 185, 239, 172, 81, 38, 104, 209, 96, 252, 178, 16, 168, 163, 198, 194, 150, 161, 207, 199, 145, 213, 144, 130, 109, 233, 98, 218, 54, 36, 13, 66, 8, 192, 106, 164, 230, 8, 176, 69, 186, 167, 34, 96, 90, 122, 61, 255, 250, 226, 92, 154, 90, 30, 220, 24, 37, 127, 97, 173, 212, 215, 22, 47, 138, 231, 6, 214, 174, 9, 224, 164, 229, 25, 151, 150, 106, 117, 188, 138, 126, 150, 122, 235, 238, 85, 192, 33, 155, 175, 62, 254, 255, 106, 26, 236, 20, 235, 225, 25, 16, 209, 150, 162, 35, 169, 227, 21, 17, 149, 113, 156, 122, 8, 95, 141, 237, 238, 97, 25, 34, 53, 21, 109, 255, 171, 30, 136, 47, 34, 98, 47, 46, 238, 31, 17, 195, 205, 87, 225, 34, 192, 133, 64, 41, 209, 40, 106, 165, 178, 209, 113, 15, 86, 40, 118, 222, 17, 91, 80, 49, 165, 238, 251, 1, 64, 107, 212, 187, 112, 134, 170, 124, 72, 39, 100, 105, 36, 74, 237, 82, 177, 127, 26, 202, 228, 65, 198, 137, 157, 142, 119, 246, 46, 169, 98, 134, 126, 198, 228, 139, 128, 227, 55, 190, 123, 249, 110, 154, 78, 29, 224, 57, 38, 186, 196, 23, 10, 213, 96, 91, 88, 235, 100, 154, 35, 80, 100, 114, 185, 215, 11, 187, 153, 174, 21, 209, 58, 54, 146, 70, 215, 183, 130, 115, 184, 162, 254, 87, 1, 61, 202, 233, 107, 169, 178, 227, 196, 22, 233, 120, 171, 103, 23, 247, 140, 36, 99, 40, 237, 193, 139, 254, 66, 233, 9, 76, 6, 19, 203, 253, 42, 174, 125, 4, 87, 53, 193, 72, 241, 140, 90, 31, 201, 195, 182, 247, 4, 2, 154, 15, 205, 156, 206, 72, 243, 80, 2, 78, 78, 209, 228, 169, 174, 27, 170, 211, 155, 215, 95, 158, 237, 100, 72, 174, 178, 58, 33, 75, 61, 114, 61, 2, 136, 86, 30, 233, 208, 186, 204, 140, 94, 22, 247, 50, 88, 171, 179, 164, 248, 65, 226, 129, 152, 101, 145, 111, 18, 170, 244, 166, 146, 189, 148, 210, 29, 193, 162, 9, 56, 225, 13, 212, 11, 132, 170, 165, 203, 199, 187, 152, 125, 208, 44, 151, 152, 181, 23, 152, 48, 0, 137, 223, 199, 50, 44, 194, 174, 175, 144, 10, 53, 255, 223, 92, 76, 115, 107, 45, 208, 172, 124, 119, 4, 213, 81, 20, 167, 56, 127, 134, 32, 106, 136, 126, 2, 33, 29, 142, 110, 206, 102, 57, 131, 133, 49, 171, 189, 39, 210, 126, 115, 44, 85, 85, 54, 158, 38, 49, 171, 33, 54, 202, 229, 165, 50, 176, 78, 195, 118, 168, 44, 16, 246, 153, 165, 168, 38, 68, 100, 151, 106, 31, 8, 117, 65, 89, 105, 201, 146, 44, 185, 182, 142, 249, 230, 104, 117, 121, 91, 216, 76, 171, 125, 49, 54, 255, 198, 190, 233, 237, 98, 60, 12, 223, 51, 211, 240, 141, 122, 115, 113, 189, 192, 254, 34, 253, 7, 186, 63, 86, 151, 139, 177, 254, 220, 186, 120, 177, 130, 244, 59, 37, 191, 166, 253, 25, 44, 149, 198, 173, 79, 151, 113, 17, 87, 45, 108, 9, 10, 172, 130, 113, 16, 183, 109, 136, 123, 100, 101, 228, 160, 121, 181, 111, 201, 62, 215, 42, 194, 67, 155, 75, 89, 105, 174, 111, 200, 144, 37, 7, 154, 114, 0, 204, 96, 176, 246, 79, 229, 63, 124, 188, 114, 113, 38, 224, 196, 217, 227, 201, 75, 243, 84, 37, 165, 204, 120, 154, 64, 61, 76, 83, 244, 67, 126, 118, 84, 118, 234, 162, 160, 21, 134, 140, 17, 204, 229, 193, 111, 9, 110, 73, 205, 108, 45, 85, 38, 218, 193, 179, 192, 143, 14, 115, 60, 228, 253, 220, 215, 40, 9, 242, 137, 65, 13, 16, 88, 201, 30, 125, 234, 149, 171, 31, 122, 194, 50, 66, 94, 193, 236, 60, 15, 222, 10, 192, 105, 38, 152, 156, 197, 69, 196, 163, 241, 182, 218, 225, 54, 216, 153, 172, 84, 65, 37, 198, 129, 68, 66, 141, 112, 84, 55, 141, 239, 167, 216, 141, 0, 185, 226, 141, 54, 187, 169, 252, 206, 142, 85, 152, 166, 73, 11, 193, 88, 174, 75, 229, 207, 176, 102, 72, 29, 191, 83, 147, 149, 162, 130, 231, 224, 160, 203, 113, 86, 76, 151, 213, 160, 128, 214, 242, 195, 251, 222, 29, 99, 32, 203, 230, 193, 118, 170, 90, 6, 165, 5, 173, 218, 151, 235, 89, 143, 6, 90, 28, 224, 91, 176, 32, 86, 116, 144, 2, 144, 96, 62, 3, 209, 126, 156, 204, 150, 41, 161, 120, 220, 139, 161, 88, 90, 208, 68, 204, 220, 236, 144, 135, 37, 202, 129, 39, 83, 12, 81, 71, 236, 252, 27, 40, 215, 6, 56, 21, 47, 220, 240, 207, 82, 63, 112, 154, 225, 232, 161, 79, 137, 160, 43, 254, 95, 250, 153, 209, 104, 248, 29, 220, 187, 114, 244, 78, 73, 160, 119, 106, 215, 6, 193, 131, 117, 243, 240, 121, 65, 80, 42, 115, 230, 149, 233, 233, 252, 211, 87, 125, 57, 209, 12, 206, 243, 188, 93, 158, 21, 248, 118, 23, 150, 58, 71, 203, 47, 71, 110, 111, 83, 217, 187, 132, 71, 171, 245, 113, 40, 255, 235, 72, 244, 0, 184, 73, 167, 42, 13, 231, 46, 114, 94, 76, 220, 129, 157, 222, 117, 252, 226, 124, 75, 208, 120, 28, 222, 241, 238, 158, 52, 138, 175, 255, 236, 202, 189, 65, 72, 173, 58, 139, 203, 209, 185, 38, 44, 232, 247, 50, 220, 215, 203, 231, 119, 233, 222, 78, 251, 28, 7, 145, 73, 97, 74, 36, 173, 142, 148, 93, 81, 210, 97, 103, 250, 226, 56, 138, 96, 96, 100, 250, 91, 204, 213, 81, 94, 165, 59, 141, 33, 78, 225, 89, 162, 173, 115, 142, 124, 10, 83, 64, 187, 95, 32, 97, 75, 186, 13, 197, 154, 66, 33, 5, 65, 102, 191, 32, 253, 100, 148, 245, 9, 211, 173, 92, 145, 184, 15, 204, 40, 35, 10, 45, 183, 181, 27, 178, 17, 146, 1, 172, 69, 7, 125, 53, 242, 206, 130, 47, 166, 85, 0, 69, 46, 169, 233, 37, 225, 196, 251, 41, 104, 101, 31, 136, 187, 156, 195, 184, 29, 253, 32, 243, 18, 35, 129, 148, 239, 47, 62, 87, 123, 222, 148, 120, 143, 224, 87, 137, 143, 193, 25, 227, 241, 150, 117, 165, 236, 199, 184, 109, 26, 176, 75, 125, 77, 195, 120, 225, 22, 223, 231, 119, 139, 195, 186, 145, 32, 28, 179, 141, 87, 22, 55, 225, 5, 14, 26, 5, 249, 165, 188, 228, 58, 239, 74, 171, 136, 91, 148, 82, 47, 7, 30, 241, 55, 45, 99, 33, 10, 47, 205, 4, 171, 94, 58, 108, 19, 120, 50, 247, 68, 48, 163, 252, 53, 93, 198, 207, 74, 14, 232, 233, 45, 81, 252, 251, 222, 161, 142, 30, 235, 168, 113, 77, 31, 49, 148, 20, 69, 239, 187, 7, 63, 0, 151, 10, 159, 167, 100, 79, 96, 236, 90, 208, 76, 125, 245, 84, 67, 177, 227, 211, 132, 72, 105, 233, 23, 16, 152, 190, 169, 41, 170, 84, 189, 244, 42, 69, 164, 22, 23, 70, 152, 170, 129, 8, 143, 204, 255, 164, 102, 160, 166, 14, 229, 165, 197, 204, 34, 7, 69, 72, 232, 57, 63, 201, 21, 204, 3, 144, 203, 65, 111, 43, 22, 194, 197, 3, 48, 251, 98, 196, 146, 89, 72, 190, 165, 181, 103, 199, 100, 23, 224, 214, 182, 3, 66, 3, 189, 199, 108, 212, 94, 186, 217, 172, 210, 135, 107, 168, 165, 250, 223, 237, 21, 155, 148, 204, 177, 244, 140, 80, 201, 137, 106, 150, 207, 227, 136, 133, 239, 191, 233, 206, 179, 130, 190, 129, 174, 4, 92, 238, 94, 164, 82, 192, 254, 136, 88, 201, 29, 3, 164, 120, 129, 1, 131, 140, 20, 147, 244, 102, 111, 32, 249, 32, 94, 97, 48, 178, 89, 220, 64, 236, 62, 18, 165, 100, 218, 75, 190, 125, 209, 103, 211, 252, 245, 194, 59, 123, 5, 230, 44, 191, 217, 19, 18, 235, 239, 12, 75, 17, 10, 90, 62, 160, 37, 239, 91, 157, 162, 158, 90, 150, 39, 226, 185, 176, 157, 95, 7, 220, 165, 94, 154, 187, 184, 132, 30, 225, 152, 68, 188, 72, 159, 144, 244, 177, 27, 29, 52, 245, 248, 108, 151, 32, 76, 58, 140, 7, 111, 76, 224, 114, 99, 143, 247, 140, 67, 83, 254, 103, 57, 118, 120, 204, 7, 116, 151, 117, 97, 49, 202, 70, 148, 232, 65, 211, 211, 11, 149, 139, 250, 11, 246, 71, 231, 41, 39, 134, 98, 246, 25, 236, 235, 139, 74, 74, 166, 113, 173, 98, 55, 181, 27, 43, 201, 92, 115, 123, 24, 22, 48, 197, 157, 140, 106, 178, 179, 174, 23, 67, 15, 163, 221, 164, 188, 119, 209, 242, 82, 230, 65, 115, 79, 133, 123, 171, 77, 248, 253, 246, 12, 247, 24, 217, 182, 160, 220, 99, 44, 239, 146, 83, 119, 186, 25, 139, 207, 69, 105, 44, 157, 109, 114, 20, 149, 181, 220, 114, 31, 155, 211, 239, 95, 179, 60, 29, 78, 40, 101, 120, 164, 133, 39, 49, 70, 255, 233, 161, 231, 178, 35, 115, 72, 173, 99, 83, 222, 193, 103, 235, 157, 123, 106, 193, 192, 17, 53, 78, 18, 47, 250, 82, 97, 172, 255, 78, 158, 128, 72, 121, 106, 68, 219, 185, 50, 179, 37, 34, 178, 149, 231, 86, 85, 208, 60, 205, 205, 46, 192, 46, 65, 180, 104, 45, 82, 90, 33, 88, 190, 61, 150, 18, 176, 133, 148, 199, 120, 142, 105, 204, 167, 237, 24, 208, 235, 33, 194, 176, 160, 145, 34, 152, 223, 66, 250, 178, 8, 70, 62, 93, 251, 168, 15, 71, 22, 197, 41, 119, 175, 108, 70, 185, 13, 217, 124, 222, 140, 185, 26, 169, 178, 4, 47, 87, 116, 86, 91, 195, 246, 9, 218, 12, 51, 167, 21, 13, 139, 187, 119, 207, 221, 151, 7, 4, 172, 44, 86, 118, 13, 233, 205, 33, 174, 182, 153, 109, 219, 33, 80, 46, 212, 24, 151, 108, 173, 114, 119, 165, 255, 224, 98, 227, 166, 32, 157, 252, 35, 234, 156, 71, 92, 249, 52, 212, 135, 186, 193, 45, 177, 65, 132, 240, 231, 158, 69, 235, 145, 180, 151, 235, 137, 40, 211, 216, 46, 116, 211, 46, 22, 246, 170, 121, 23, 235, 24, 53, 241, 146, 133, 4, 116, 13, 106, 145, 22, 140, 128, 223, 73, 158, 184, 40, 238, 25, 43, 195, 106, 54, 98, 216, 99, 249, 111, 25, 238, 206, 18, 67, 40, 239, 48, 52, 78, 85, 59, 232, 49, 210, 5, 173, 88, 44, 90, 72, 50, 140, 165, 79, 35, 214, 160, 111, 13, 0, 110, 191, 183, 80, 209, 69, 97, 143, 161, 126, 180, 50, 143, 167, 59, 221, 122, 90, 176, 197, 69, 196, 186, 247, 148, 28, 234, 104, 7, 74, 20, 149, 208, 109, 3, 167, 176, 82, 42, 143, 227, 238, 242, 89, 66, 145, 88, 137, 255, 43, 0, 143, 56, 167, 70, 170, 76, 108, 218, 5, 193, 11, 241, 89, 246, 86, 169, 192, 8, 14, 109, 181, 190, 161, 107, 206, 19, 105, 194, 170, 147, 72, 84, 216, 222, 192, 29, 235, 198, 24, 160, 243, 186, 124, 216, 43, 124, 64, 79, 75, 2, 123, 172, 229, 206, 59, 205, 137, 70, 128, 22, 65, 12, 253, 189, 32, 73, 144, 172, 91, 106, 142, 121, 37, 222, 67, 92, 120, 18, 89, 190, 103, 176, 192, 26, 144, 206, 136, 195, 87, 233, 101, 180, 228, 42, 208, 166, 124, 37, 63, 166, 248, 146, 26, 216, 136, 232, 32, 45, 118, 85, 4, 247, 36, 61, 61, 123, 179, 138, 78, 46, 18, 168, 245, 6, 159, 242, 101, 17, 68, 128, 138, 188, 136, 111, 145, 55, 0, 115, 138, 148, 224, 161, 71, 244, 237, 162, 100, 52, 235, 29, 185, 82, 99, 231, 33, 218, 240, 223, 119, 19, 2, 82, 246, 229, 103, 14, 182, 215, 102, 190, 83, 133, 122, 223, 64, 55, 154, 218, 97, 83, 19, 49, 92, 17, 58, 61, 51, 127, 82, 179, 72, 224, 166, 203, 96, 216, 211, 75, 97, 244, 248, 239, 39, 208, 234, 40, 119, 178, 252, 102, 55, 99, 89, 214, 40, 219, 82, 155, 111, 234, 71, 193, 55, 89, 61, 163, 164, 136, 233, 78, 38, 51, 120, 46, 163, 229, 207, 75, 42, 121, 244, 231, 166, 104, 218, 241, 78, 151, 90, 54, 232, 48, 96, 178, 58, 237, 16, 247, 248, 127, 251, 83, 150, 250, 127, 12, 173, 83, 54, 201, 61, 115, 76, 34, 242, 201, 241, 152, 136, 29, 226, 39, 18, 27, 0, 105, 205, 219, 180, 27, 155, 231, 60, 50, 210, 29, 23, 11, 14, 15, 198, 73, 139, 167, 34, 134, 170, 67, 3, 21, 46, 147, 249, 149, 74, 209, 189, 242, 23, 247, 122, 153, 2, 142, 54, 176, 74, 226, 9, 122, 121, 227, 80, 136, 82, 27, 240, 85, 0, 100, 168, 33, 112, 252, 217, 92, 149, 67, 55, 194, 18, 235, 74, 96, 252, 9, 139, 149, 67, 103, 159, 204, 130, 75, 16, 162, 13, 102, 149, 3, 103, 225, 107, 236, 59, 31, 213, 17, 75, 237, 152, 53, 252, 201, 194, 245, 252, 69, 28, 89, 118, 219, 103, 156, 213, 105, 137, 213, 77, 163, 104, 8, 43, 144, 54, 177, 72, 105, 168, 49, 55, 102, 42, 94, 203, 188, 213, 61, 85, 57, 94, 18, 13, 142, 61, 8, 92, 133, 132, 27, 176, 126, 31, 21, 161, 168, 62, 157, 208, 175, 229, 42, 199, 214, 65, 76, 228, 12, 186, 217, 212, 20, 80, 103, 190, 236, 17, 41, 118, 58, 100, 142, 161, 73, 26, 64, 127, 213, 175, 221, 134, 250, 83, 149, 59, 241, 189, 131, 157, 173, 153, 134, 73, 15, 167, 135, 204, 95, 238, 188, 182, 205, 3, 50, 65, 24, 240, 8, 163, 47, 218, 250, 246, 235, 182, 222, 173, 78, 136, 150, 40, 240, 89, 242, 0, 9, 111, 140, 252, 235, 220, 192, 161, 244, 200, 214, 107, 255, 44, 230, 151, 28, 82, 22, 198, 47, 181, 154, 230, 62, 197, 127, 61, 18, 129, 99, 8, 248, 189, 2, 65, 172, 208, 60, 233, 68, 134, 118, 4, 210, 150, 41, 42, 34, 81, 1, 93, 164, 179, 189, 166, 17, 81, 188, 101, 25, 196, 149, 137, 8, 178, 31, 202, 166, 168, 195, 246, 58, 112, 241, 3, 158, 64, 161, 79, 196, 53, 73, 50, 59, 230, 72, 115, 26, 14, 226, 167, 180, 152, 4, 203, 189, 198, 47, 138, 237, 109, 81, 247, 140, 26, 151, 22, 184, 58, 229, 112, 148, 100, 69, 105, 156, 13, 127, 200, 80, 123, 175, 165, 145, 153, 161, 154, 177, 236, 159, 33, 112, 52, 64, 2, 72, 246, 82, 190, 170, 38, };
+#endif
+#endif
\ No newline at end of file
@@ -4,11 +4,14 @@
 #ifdef ESP32
 #include "WebServer.h"
 #include "Update.h"
+#include "mbedtls/md.h"
 #elif ESP8266
 #include "ESP8266WebServer.h"
+#include <bearssl/bearssl_hmac.h>
 #endif
 
 #include "LittleFS.h"
+#include "esp-config-page-metrics.h"
 
 #ifdef ESP_CONFIG_PAGE_ENABLE_LOGGING
 #define LOGH() Serial.print("[ESP-CONFIG-PAGE] ")
@@ -23,6 +26,58 @@
 
 #define VALIDATE_AUTH() if (!ESP_CONFIG_PAGE::validateAuth()) return
 
+// Modules compiled into the firmware, define ESP_CONP_MODULES as an OR of the bits below to leave the others out.
+// The page served must be built with the same modules, see buildtool/update_modules.py.
+#define ESP_CONP_MODULE_OTA (1 << 0)
+#define ESP_CONP_MODULE_WIRELESS (1 << 1)
+#define ESP_CONP_MODULE_FILES (1 << 2)
+#define ESP_CONP_MODULE_ACTIONS (1 << 3)
+#define ESP_CONP_MODULE_ENVIRONMENT (1 << 4)
+#define ESP_CONP_MODULE_ATTRIBUTES (1 << 5)
+#define ESP_CONP_MODULE_LOGGING (1 << 6)
+// Page only, checksums OTA uploads in the browser
+#define ESP_CONP_MODULE_MD5 (1 << 7)
+#define ESP_CONP_MODULE_SCHEDULING (1 << 8)
+#define ESP_CONP_MODULE_ALL 0x1ff
+
+#ifndef ESP_CONP_MODULES
+#define ESP_CONP_MODULES ESP_CONP_MODULE_ALL
+#endif
+
+#define ESP_CONP_HAS_MODULE(m) ((ESP_CONP_MODULES & ESP_CONP_MODULE_##m) != 0)
+
+// Modules that change the page html, attributes and scheduling have no page section
+#define ESP_CONP_PAGE_MODULES (ESP_CONP_MODULES & ~ESP_CONP_MODULE_ATTRIBUTES & ~ESP_CONP_MODULE_SCHEDULING & 0xff)
+
+#ifndef ESP_CONP_SESSION_COOKIE
+#define ESP_CONP_SESSION_COOKIE "ESPCONP_SESSION"
+#endif
+
+#ifndef ESP_CONP_RESPONSE_BUFFER_SIZE
+#define ESP_CONP_RESPONSE_BUFFER_SIZE 512
+#endif
+
+#ifndef ESP_CONP_TOKENIZER_MAX_CARRY
+#define ESP_CONP_TOKENIZER_MAX_CARRY 4096
+#endif
+
+#ifndef ESP_CONP_AUTH_THROTTLE_SLOTS
+#define ESP_CONP_AUTH_THROTTLE_SLOTS 8
+#endif
+
+#ifndef ESP_CONP_AUTH_THROTTLE_BURST
+#define ESP_CONP_AUTH_THROTTLE_BURST 5
+#endif
+
+#ifndef ESP_CONP_AUTH_THROTTLE_REFILL_MS
+#define ESP_CONP_AUTH_THROTTLE_REFILL_MS 2000
+#endif
+
+// Longest key visited by KeyValueStorage::doForEachKeyOnly and the built-in doForEachKey, longer keys are skipped
+#ifndef ESP_CONP_KV_MAX_KEY_LEN
+#define ESP_CONP_KV_MAX_KEY_LEN 255
+#endif
+
 namespace ESP_CONFIG_PAGE
 {
 #ifdef ESP32
@@ -31,117 +86,1249 @@ namespace ESP_CONFIG_PAGE
     using WEBSERVER_T = ESP8266WebServer;
 #endif
 
-    WEBSERVER_T *server;
-    String username;
-    String password;
-    String nodeName;
+    WEBSERVER_T *server;
+    String username;
+    String password;
+    String nodeName;
+
+    inline unsigned int getMaxLineLength(const char* str) {
+        unsigned int maxLength = 0;
+        unsigned int currentLength = 0;
+
+        unsigned int len = strlen(str);
+        for (unsigned int i = 0; i < len; i++)
+        {
+            const char c = str[i];
+            if (c == '\n' || c == '\r')
+            {
+                if (currentLength > maxLength)
+                {
+                    maxLength = currentLength;
+                }
+
+                currentLength = 0;
+                if (c == '\r' && i < len-1 && str[i+1] == '\n')
+                {
+                    i++;
+                }
+            }
+            else
+            {
+                currentLength++;
+            }
+        }
+
+        return maxLength;
+    }
+
+    constexpr size_t SESSION_TOKEN_LEN = 48;
+    bool sessionAuthEnabled = false;
+    unsigned long sessionTtl = 0;
+    uint32_t sessionCounter = 0;
+    uint8_t sessionSecret[32]{};
+
+    /**
+     * Headers read by the library, the webserver only keeps the headers listed here.
+     * If your code calls collectHeaders on the server, include these too.
+     */
+    const char *collectedHeaders[] = {"Cookie", "If-None-Match", "Accept-Encoding"};
+
+    inline void collectRequestHeaders()
+    {
+        server->collectHeaders(collectedHeaders, sizeof(collectedHeaders) / sizeof(collectedHeaders[0]));
+    }
+
+    inline void hmacSha256(const uint8_t *data, size_t len, uint8_t out[32])
+    {
+#ifdef ESP32
+        mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), sessionSecret, sizeof(sessionSecret), data, len, out);
+#elif ESP8266
+        br_hmac_key_context keyContext;
+        br_hmac_context context;
+        br_hmac_key_init(&keyContext, &br_sha256_vtable, sessionSecret, sizeof(sessionSecret));
+        br_hmac_init(&context, &keyContext, 0);
+        br_hmac_update(&context, data, len);
+        br_hmac_out(&context, out);
+#endif
+    }
+
+    /**
+     * Compares two buffers without exiting early, so the time taken doesn't leak how many characters matched.
+     */
+    inline bool constantTimeEquals(const char *a, const char *b, size_t len)
+    {
+        uint8_t diff = 0;
+        for (size_t i = 0; i < len; i++)
+        {
+            diff |= a[i] ^ b[i];
+        }
+        return diff == 0;
+    }
+
+    /**
+     * Token format: 8 hex chars expiry (millis) + 8 hex chars counter + 32 hex chars of the truncated HMAC-SHA256 of the first 16.
+     */
+    inline void signSessionToken(const char *payload, char *outMac)
+    {
+        uint8_t mac[32];
+        hmacSha256((const uint8_t*) payload, 16, mac);
+        for (uint8_t i = 0; i < 16; i++)
+        {
+            sprintf(outMac + i*2, "%02x", mac[i]);
+        }
+    }
+
+    inline void createSessionToken(char out[SESSION_TOKEN_LEN+1])
+    {
+        sprintf(out, "%08lx%08lx", (unsigned long) (uint32_t) (millis() + sessionTtl), (unsigned long) sessionCounter++);
+        signSessionToken(out, out + 16);
+    }
+
+    /**
+     * Checks the signature and expiry of a session token.
+     */
+    inline bool verifySessionToken(const char *token, size_t len)
+    {
+        if (!sessionAuthEnabled || token == nullptr || len != SESSION_TOKEN_LEN)
+        {
+            return false;
+        }
+
+        char mac[33]{};
+        signSessionToken(token, mac);
+        if (!constantTimeEquals(mac, token + 16, 32))
+        {
+            return false;
+        }
+
+        char expiryHex[9]{};
+        memcpy(expiryHex, token, 8);
+        unsigned long expiry = strtoul(expiryHex, nullptr, 16);
+        return (int32_t) (uint32_t) (expiry - millis()) > 0;
+    }
+
+    inline bool requestHasValidSession()
+    {
+        String auth = server->header("Authorization");
+        if (auth.startsWith("Bearer "))
+        {
+            return verifySessionToken(auth.c_str() + 7, auth.length() - 7);
+        }
+
+        String cookie = server->header("Cookie");
+        int start = cookie.indexOf(ESP_CONP_SESSION_COOKIE "=");
+        if (start < 0)
+        {
+            return false;
+        }
+
+        start += strlen(ESP_CONP_SESSION_COOKIE "=");
+        int end = cookie.indexOf(';', start);
+        end = end < 0 ? cookie.length() : end;
+        return verifySessionToken(cookie.c_str() + start, end - start);
+    }
+
+    /**
+     * Enables session tokens: after a successful basic auth the server sets a signed, expiring session cookie
+     * that is accepted by the HTTP routes (cookie or "Authorization: Bearer <token>") and by the logging and
+     * OTA websockets, so the password is only checked once per session.
+     * Tokens are signed with a random secret generated on every boot, restarting the device invalidates them.
+     *
+     * @param ttl - Token lifetime in milliseconds.
+     */
+    inline void enableSessionAuth(unsigned long ttl = 3600000)
+    {
+#ifdef ESP32
+        esp_fill_random(sessionSecret, sizeof(sessionSecret));
+#elif ESP8266
+        ESP.random(sessionSecret, sizeof(sessionSecret));
+#endif
+        sessionTtl = ttl;
+        sessionAuthEnabled = true;
+    }
+
+    /**
+     * Failed login token bucket of a client IP. Every failed login takes a token, tokens refill one every
+     * ESP_CONP_AUTH_THROTTLE_REFILL_MS, a client without tokens is answered with 429 without checking its credentials.
+     */
+    struct AuthThrottleEntry
+    {
+        uint32_t ip;
+        uint32_t lastSeen;
+        uint32_t lastRefill;
+        uint8_t tokens;
+    };
+
+    struct AuthStats
+    {
+        uint32_t failed;
+        uint32_t throttled;
+        uint32_t evicted;
+    };
+
+    AuthThrottleEntry authThrottle[ESP_CONP_AUTH_THROTTLE_SLOTS]{};
+    AuthStats authStats{};
+
+    /**
+     * Finds the bucket of the ip and refills its tokens.
+     * @return nullptr if the ip has no failed login in the table.
+     */
+    inline AuthThrottleEntry *findAuthThrottleEntry(uint32_t ip)
+    {
+        const uint32_t now = millis();
+
+        for (uint8_t i = 0; i < ESP_CONP_AUTH_THROTTLE_SLOTS; i++)
+        {
+            AuthThrottleEntry &entry = authThrottle[i];
+            if (entry.ip == ip && entry.ip != 0)
+            {
+                const uint32_t refill = (now - entry.lastRefill) / ESP_CONP_AUTH_THROTTLE_REFILL_MS;
+                if (refill > 0)
+                {
+                    entry.tokens = min((uint32_t) ESP_CONP_AUTH_THROTTLE_BURST, entry.tokens + refill);
+                    entry.lastRefill = entry.tokens == ESP_CONP_AUTH_THROTTLE_BURST ? now : entry.lastRefill + refill * ESP_CONP_AUTH_THROTTLE_REFILL_MS;
+                }
+
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Takes a token from the bucket of the ip, replacing the bucket with the oldest failure if it isn't in the table.
+     * Only failed logins reach the table, so successful ones can't evict a throttled client.
+     */
+    inline void chargeAuthFailure(uint32_t ip)
+    {
+        const uint32_t now = millis();
+        authStats.failed++;
+
+        AuthThrottleEntry *entry = findAuthThrottleEntry(ip);
+        if (entry == nullptr)
+        {
+            entry = &authThrottle[0];
+            for (uint8_t i = 1; i < ESP_CONP_AUTH_THROTTLE_SLOTS && entry->ip != 0; i++)
+            {
+                if (authThrottle[i].ip == 0 || now - authThrottle[i].lastSeen > now - entry->lastSeen)
+                {
+                    entry = &authThrottle[i];
+                }
+            }
+
+            if (entry->ip != 0)
+            {
+                authStats.evicted++;
+            }
+
+            *entry = {ip, now, now, ESP_CONP_AUTH_THROTTLE_BURST};
+        }
+
+        if (entry->tokens > 0)
+        {
+            entry->tokens--;
+        }
+        entry->lastSeen = now;
+    }
+
+    inline uint32_t requestIp()
+    {
+        return (uint32_t) server->client().remoteIP();
+    }
+
+    inline bool isThrottled(uint32_t ip)
+    {
+        const AuthThrottleEntry *entry = findAuthThrottleEntry(ip);
+        return entry != nullptr && entry->tokens == 0;
+    }
+
+    /**
+     * Validates credentials sent by websocket clients, either "username:password" or a session token. Failed
+     * credentials are charged to the client ip like in validateAuth(), a throttled client is refused without checking
+     * them.
+     */
+    inline bool validateWsCredentials(const char *payload, size_t len, const String &username, const String &password,
+                                      uint32_t ip)
+    {
+        if (isThrottled(ip))
+        {
+            authStats.throttled++;
+            return false;
+        }
+
+        if (verifySessionToken(payload, len))
+        {
+            return true;
+        }
+
+        const char *separator = (const char*) memchr(payload, ':', len);
+        const size_t userLen = separator != nullptr ? separator - payload : 0;
+        const size_t passLen = separator != nullptr ? len - userLen - 1 : 0;
+        if (separator == nullptr || userLen != username.length() || passLen != password.length() ||
+            strncmp(payload, username.c_str(), userLen) != 0 || strncmp(separator + 1, password.c_str(), passLen) != 0)
+        {
+            chargeAuthFailure(ip);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Checks the request credentials without sending any response, a throttled client is refused without checking
+     * them. Nothing is charged here, validateAuth() runs on the same request once the body is read and charges it.
+     */
+    inline bool isAuthenticated()
+    {
+        if (sessionAuthEnabled && requestHasValidSession())
+        {
+            return true;
+        }
+
+        return !isThrottled(requestIp()) && server->authenticate(username.c_str(), password.c_str());
+    }
+
+    inline bool validateAuth()
+    {
+        if (sessionAuthEnabled && requestHasValidSession())
+        {
+            return true;
+        }
+
+        const uint32_t ip = requestIp();
+        const AuthThrottleEntry *throttle = findAuthThrottleEntry(ip);
+        if (throttle != nullptr && throttle->tokens == 0)
+        {
+            authStats.throttled++;
+            const uint32_t retryAfter = (ESP_CONP_AUTH_THROTTLE_REFILL_MS - (millis() - throttle->lastRefill) + 999) / 1000;
+            server->sendHeader("Retry-After", String(retryAfter));
+            server->send(429, "text/plain", F("Too many failed login attempts."));
+            return false;
+        }
+
+        if (!server->authenticate(username.c_str(), password.c_str()))
+        {
+            // Requests without credentials are only the browser asking for the login prompt
+            if (server->hasHeader("Authorization"))
+            {
+                chargeAuthFailure(ip);
+            }
+
+            server->requestAuthentication();
+            return false;
+        }
+
+        if (sessionAuthEnabled)
+        {
+            char token[SESSION_TOKEN_LEN+1];
+            createSessionToken(token);
+
+            char cookie[SESSION_TOKEN_LEN + sizeof(ESP_CONP_SESSION_COOKIE) + 64];
+            sprintf(cookie, ESP_CONP_SESSION_COOKIE "=%s; Path=/; Max-Age=%lu; SameSite=Strict", token, sessionTtl / 1000);
+            server->sendHeader("Set-Cookie", cookie);
+        }
+
+        return true;
+    }
+
+    /**
+     * Counters of failed and throttled login attempts and of throttle table evictions.
+     */
+    inline const AuthStats &getAuthStats()
+    {
+        return authStats;
+    }
+
+    Stream* serial = &Serial;
+
+    PROGMEM char httpMethodMapping[5][8] = {"DELETE", "GET", "HEAD", "POST", "PUT"};
+
+    String name;
+    const char escapeChars[] = {':', ';', '+', '\0'};
+    const char escaper = '|';
+
+    inline uint8_t countChar(const char str[], const char separator)
+    {
+        uint8_t delimiterCount = 0;
+        bool escaped = false;
+        int len = strlen(str);
+
+        for (int i = 0; i < len; i++)
+        {
+            char cstr = str[i];
+            if (cstr == escaper && !escaped)
+            {
+                escaped = true;
+            }
+            else if (cstr == separator && !escaped)
+            {
+                delimiterCount++;
+            }
+            else
+            {
+                escaped = false;
+            }
+        }
+
+        return delimiterCount;
+    }
+
+    /**
+     * Splits "key\nvalue\n..." request bodies into key/value pairs in a single pass.
+     * Lines are terminated in place, keys and values are handed out as views into the fed buffer without copying.
+     * Only a pair split between two feed calls is copied, into a carry buffer of at most ESP_CONP_TOKENIZER_MAX_CARRY bytes.
+     * With escaping enabled an escaped newline doesn't end the line, use unescape to remove the escapers from a value.
+     */
+    class PairTokenizer
+    {
+    public:
+        ~PairTokenizer()
+        {
+            free(carry);
+        }
+
+        void reset(bool escaping = false)
+        {
+            this->escaping = escaping;
+            key = nullptr;
+            keyLength = 0;
+            carryLength = 0;
+            carryLineStart = 0;
+            pairCount = 0;
+            escapeNext = false;
+            stopped = false;
+            overflowed = false;
+            fed = false;
+        }
+
+        /**
+         * Tokenizes the next chunk of the body, calling fn(key, keyLength, value, valueLength) for every complete pair.
+         * Keys and values are null terminated and only valid during the call, fn returns false to stop tokenizing.
+         */
+        template <typename Fn>
+        void feed(char *data, size_t length, Fn &&fn)
+        {
+            fed = true;
+            size_t start = 0;
+
+            while (!stopped && start < length)
+            {
+                char *line = data + start;
+                char *end = findLineEnd(line, length - start);
+
+                if (end == nullptr)
+                {
+                    keepKey();
+                    appendCarry(line, length - start);
+                    break;
+                }
+
+                size_t lineLength = end - line;
+                start += lineLength + 1;
+                *end = 0;
+
+                if (carryLength > carryLineStart)
+                {
+                    appendCarry(line, lineLength);
+                    if (overflowed)
+                    {
+                        break;
+                    }
+
+                    line = carry + carryLineStart;
+                    lineLength = carryLength - carryLineStart;
+                    carry[carryLength] = 0;
+                }
+
+                if (lineLength > 0 && line[lineLength-1] == '\r')
+                {
+                    line[--lineLength] = 0;
+                }
+
+                if (key == nullptr)
+                {
+                    key = line;
+                    keyLength = lineLength;
+                    carryLineStart = carryLength = line == carry ? lineLength + 1 : 0;
+                    continue;
+                }
+
+                pairCount++;
+                stopped = !fn(key, keyLength, line, lineLength);
+                key = nullptr;
+                carryLength = carryLineStart = 0;
+            }
+
+            keepKey();
+        }
+
+        /**
+         * Removes the escapers from str in place, returns the new length.
+         */
+        static size_t unescape(char *str, size_t length)
+        {
+            size_t out = 0;
+            for (size_t i = 0; i < length; i++)
+            {
+                if (str[i] == escaper && i + 1 < length)
+                {
+                    i++;
+                }
+
+                str[out++] = str[i];
+            }
+
+            str[out] = 0;
+            return out;
+        }
+
+        /**
+         * Number of complete pairs found so far.
+         */
+        size_t pairs() const
+        {
+            return pairCount;
+        }
+
+        /**
+         * True if a pair didn't fit in the carry buffer, tokenizing stops when that happens.
+         */
+        bool overflow() const
+        {
+            return overflowed;
+        }
+
+        /**
+         * True if anything was fed since the last reset.
+         */
+        bool wasFed() const
+        {
+            return fed;
+        }
+
+    private:
+        char *findLineEnd(char *str, size_t length)
+        {
+            if (!escaping)
+            {
+                return (char*) memchr(str, '\n', length);
+            }
+
+            for (size_t i = 0; i < length; i++)
+            {
+                if (escapeNext)
+                {
+                    escapeNext = false;
+                }
+                else if (str[i] == escaper)
+                {
+                    escapeNext = true;
+                }
+                else if (str[i] == '\n')
+                {
+                    return str + i;
+                }
+            }
+
+            return nullptr;
+        }
+
+        void appendCarry(const char *str, size_t length)
+        {
+            if (carryLength + length + 1 > carryCapacity)
+            {
+                size_t newCapacity = max(carryLength + length + 1, (size_t) 64);
+                char *newCarry = newCapacity > ESP_CONP_TOKENIZER_MAX_CARRY ? nullptr : (char*) realloc(carry, newCapacity);
+                if (newCarry == nullptr)
+                {
+                    overflowed = true;
+                    stopped = true;
+                    return;
+                }
+
+                if (key != nullptr && key == carry)
+                {
+                    key = newCarry;
+                }
+
+                carry = newCarry;
+                carryCapacity = newCapacity;
+            }
+
+            memcpy(carry + carryLength, str, length);
+            carryLength += length;
+        }
+
+        // The key line is a view into the fed chunk, copy it before the chunk goes away
+        void keepKey()
+        {
+            if (key == nullptr || key == carry || stopped)
+            {
+                return;
+            }
+
+            const char *chunkKey = key;
+            key = nullptr;
+            carryLength = 0;
+            appendCarry(chunkKey, keyLength + 1);
+            key = overflowed ? nullptr : carry;
+            carryLineStart = carryLength;
+        }
+
+        bool escaping = false;
+        char *key = nullptr;
+        size_t keyLength = 0;
+        char *carry = nullptr;
+        size_t carryCapacity = 0;
+        size_t carryLength = 0;
+        size_t carryLineStart = 0;
+        size_t pairCount = 0;
+        bool escapeNext = false;
+        bool stopped = false;
+        bool overflowed = false;
+        bool fed = false;
+    };
+
+    /**
+     * Tokenizer for the body of the request being handled, fed by the route dispatcher.
+     */
+    PairTokenizer bodyTokenizer;
+
+    /**
+     * Writes a response with chunked transfer encoding through a fixed buffer, a chunk is sent every time the buffer fills.
+     * Memory used doesn't depend on the response size. The response is finished by end() or when the writer goes out of scope.
+     */
+    class ResponseWriter : public Print
+    {
+    public:
+        explicit ResponseWriter(int code = 200, const char *contentType = "text/plain")
+        {
+            server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+            server->send(code, contentType, "");
+        }
+
+        ~ResponseWriter() override
+        {
+            end();
+        }
+
+        using Print::write;
+
+        size_t write(uint8_t c) override
+        {
+            if (length == sizeof(buffer))
+            {
+                flush();
+            }
+
+            buffer[length++] = c;
+            return 1;
+        }
+
+        size_t write(const uint8_t *data, size_t size) override
+        {
+            if (length + size > sizeof(buffer))
+            {
+                flush();
+            }
+
+            if (size > sizeof(buffer))
+            {
+                server->sendContent((const char*) data, size);
+                return size;
+            }
+
+            memcpy(buffer + length, data, size);
+            length += size;
+            return size;
+        }
+
+        void flush() override
+        {
+            if (length > 0)
+            {
+                server->sendContent(buffer, length);
+                length = 0;
+            }
+        }
+
+        /**
+         * Sends what is left in the buffer and the last, empty chunk.
+         */
+        void end()
+        {
+            if (ended)
+            {
+                return;
+            }
+
+            flush();
+            server->sendContent("", 0);
+            ended = true;
+        }
+
+    private:
+        char buffer[ESP_CONP_RESPONSE_BUFFER_SIZE];
+        size_t length = 0;
+        bool ended = false;
+    };
+
+    /**
+     * Returns true if the Accept-Encoding header value lists the encoding with a non zero quality.
+     */
+    inline bool acceptsEncoding(const String &acceptEncoding, const char *encoding)
+    {
+        const size_t encodingLength = strlen(encoding);
+        const char *token = acceptEncoding.c_str();
+
+        while (*token != 0)
+        {
+            while (*token == ' ' || *token == ',')
+            {
+                token++;
+            }
+
+            const char *end = strchr(token, ',');
+            end = end == nullptr ? token + strlen(token) : end;
+
+            const char next = token[encodingLength];
+            if ((size_t) (end - token) >= encodingLength && strncasecmp(token, encoding, encodingLength) == 0 &&
+                (next == 0 || next == ',' || next == ';' || next == ' '))
+            {
+                const char *quality = strstr(token, "q=");
+                return quality == nullptr || quality > end || strtod(quality + 2, nullptr) > 0;
+            }
+
+            token = end;
+        }
+
+        return false;
+    }
+
+    /**
+     * Sets the esp-config-page serial for printing.
+     * @param toSet serial to set.
+     */
+    inline void setSerial(Stream* toSet)
+    {
+        serial = toSet;
+    }
+
+    enum Modules
+    {
+        OTA,
+        WIRELESS,
+        FILES,
+        ACTIONS,
+        ENVIRONMENT,
+        ATTRIBUTES,
+        SCHEDULING = 8,
+    };
+    Modules *enabledModules = nullptr;
+    uint8_t enabledModulesCount = 0;
+
+    constexpr uint16_t compiledModules = ESP_CONP_MODULES;
+
+    /**
+     * If the module was compiled in with ESP_CONP_MODULES, enum values match the ESP_CONP_MODULE_* bits.
+     */
+    constexpr bool isModuleCompiled(Modules module)
+    {
+        return (compiledModules & (1 << module)) != 0;
+    }
+
+    static_assert(ESP_CONP_MODULE_OTA == 1 << OTA && ESP_CONP_MODULE_ATTRIBUTES == 1 << ATTRIBUTES &&
+                  ESP_CONP_MODULE_SCHEDULING == 1 << SCHEDULING,
+                  "ESP_CONP_MODULE_* bits must follow the Modules enum.");
+
+    /**
+     * Run time of a module's ticks, in microseconds.
+     */
+    struct ModuleStats
+    {
+        uint32_t ticks;
+        uint32_t lastMicros;
+        uint32_t maxMicros;
+        uint64_t totalMicros;
+    };
+
+    /**
+     * Module ticked by ESP_CONFIG_PAGE::loop(). Modules are only ticked once their deadline has passed, so an idle
+     * module costs nothing, register your own with registerModule.
+     */
+    class ConfigPageModule
+    {
+    public:
+        virtual ~ConfigPageModule() = default;
+
+        virtual const char *name() const = 0;
+
+        /**
+         * Called once, when the module is registered.
+         */
+        virtual void init()
+        {
+        }
+
+        virtual void tick(unsigned long now) = 0;
+
+        /**
+         * millis() time of the next tick, return now + MODULE_IDLE_MS when there is nothing to do until wakeModules().
+         */
+        virtual unsigned long nextDeadline(unsigned long now) = 0;
+
+        /**
+         * Called by ESP_CONFIG_PAGE::restart() before the device restarts, e.g. to save pending writes.
+         */
+        virtual void beforeRestart()
+        {
+        }
+
+        const ModuleStats &stats() const
+        {
+            return moduleStats;
+        }
+
+        ModuleStats moduleStats{};
+#if ESP_CONP_METRICS
+        LatencyHistogram latency{};
+#endif
+    };
+
+    constexpr unsigned long MODULE_IDLE_MS = 0x7fffffff;
+
+    ConfigPageModule **registeredModules = nullptr;
+    uint8_t registeredModulesCount = 0;
+    unsigned long nextModuleDeadline = 0;
+    bool modulesWoken = true;
+
+    inline bool deadlinePassed(unsigned long deadline, unsigned long now)
+    {
+        return (int32_t) (uint32_t) (now - deadline) >= 0;
+    }
+
+    /**
+     * Makes the next loop() recompute every deadline, call it when something outside a module's tick gives it work.
+     */
+    inline void wakeModules()
+    {
+        modulesWoken = true;
+    }
+
+    inline bool registerModule(ConfigPageModule *module)
+    {
+        for (uint8_t i = 0; i < registeredModulesCount; i++)
+        {
+            if (registeredModules[i] == module)
+            {
+                return true;
+            }
+        }
+
+        auto **newModules = (ConfigPageModule**) realloc(registeredModules, (registeredModulesCount + 1) * sizeof(ConfigPageModule*));
+        if (newModules == nullptr)
+        {
+            LOGN("Memory allocation failed for registered modules array.");
+            return false;
+        }
+
+        registeredModules = newModules;
+        registeredModules[registeredModulesCount++] = module;
+        module->init();
+        wakeModules();
+        return true;
+    }
+
+    inline void unregisterModule(ConfigPageModule *module)
+    {
+        for (uint8_t i = 0; i < registeredModulesCount; i++)
+        {
+            if (registeredModules[i] == module)
+            {
+                memmove(registeredModules + i, registeredModules + i + 1, (registeredModulesCount - i - 1) * sizeof(ConfigPageModule*));
+                registeredModulesCount--;
+                wakeModules();
+                return;
+            }
+        }
+    }
+
+    /**
+     * Ticks every module whose deadline has passed, a single comparison when none is due.
+     */
+    inline void tickModules()
+    {
+        unsigned long now = millis();
+        if (!modulesWoken && !deadlinePassed(nextModuleDeadline, now))
+        {
+            return;
+        }
+
+        modulesWoken = false;
+        unsigned long next = now + MODULE_IDLE_MS;
+
+        for (uint8_t i = 0; i < registeredModulesCount; i++)
+        {
+            ConfigPageModule *module = registeredModules[i];
+            if (deadlinePassed(module->nextDeadline(now), now))
+            {
+                const uint32_t start = micros();
+                module->tick(now);
+                const uint32_t elapsed = (uint32_t) micros() - start;
+
+                ModuleStats &stats = module->moduleStats;
+                stats.ticks++;
+                stats.lastMicros = elapsed;
+                stats.maxMicros = elapsed > stats.maxMicros ? elapsed : stats.maxMicros;
+                stats.totalMicros += elapsed;
+#if ESP_CONP_METRICS
+                module->latency.record(elapsed);
+#endif
+                now = millis();
+            }
+
+            const unsigned long deadline = module->nextDeadline(now);
+            if ((int32_t) (uint32_t) (deadline - next) < 0)
+            {
+                next = deadline;
+            }
+        }
+
+        nextModuleDeadline = next;
+    }
+
+    /**
+     * Restarts the device after letting every module finish its pending work, use it instead of ESP.restart().
+     */
+    inline void restart()
+    {
+        for (uint8_t i = 0; i < registeredModulesCount; i++)
+        {
+            registeredModules[i]->beforeRestart();
+        }
+
+        ESP.restart();
+    }
+
+    /**
+     * Milliseconds until a module needs loop() again, the device can sleep this long if nothing else needs it.
+     */
+    inline unsigned long millisUntilNextTick()
+    {
+        const unsigned long now = millis();
+        return modulesWoken || deadlinePassed(nextModuleDeadline, now) ? 0 : (uint32_t) (nextModuleDeadline - now);
+    }
+
+#ifdef ESP32
+    using REQUEST_HANDLER_T = RequestHandler;
+#elif ESP8266
+    using REQUEST_HANDLER_T = esp8266webserver::RequestHandler<WiFiServer>;
+#endif
+
+    /**
+     * Module bit for the routes that are always enabled (config page and info).
+     */
+    constexpr uint8_t ROUTE_MODULE_CORE = 15;
+
+    /**
+     * Entry of the config page route table. Tables are sorted by uri and method and live in flash, see routesSorted.
+     * Routes with a pair callback get their "key\nvalue\n" body tokenized by the dispatcher, streamed from the raw
+     * request body when the webserver supports it, before the handler is called. When the request is dropped after
+     * pairs were tokenized, abort is called instead of the handler to undo what the pair callback started.
+     */
+    struct Route
+    {
+        const char *uri;
+        HTTPMethod method;
+        uint8_t module;
+        void (*handler)();
+        void (*upload)();
+        bool (*pair)(char *key, size_t keyLength, char *value, size_t valueLength);
+        void (*abort)();
+        bool escaped;
+    };
+
+    /**
+     * Route added at runtime with addServerHandler.
+     */
+    struct ExtraRoute
+    {
+        const char *uri;
+        HTTPMethod method;
+        std::function<void(void)> fn;
+#if ESP_CONP_METRICS
+        // Zeroed by the braces in addServerHandler, a member initializer is not allowed in a C++11 aggregate
+        LatencyHistogram latency;
+#endif
+    };
+
+    const Route *routeTable = nullptr;
+    size_t routeCount = 0;
+#if ESP_CONP_METRICS
+    LatencyHistogram *routeLatency = nullptr;
+#endif
+    uint16_t enabledRouteModules = 1 << ROUTE_MODULE_CORE;
+
+    ExtraRoute** extraRoutes = nullptr;
+    uint8_t extraRoutesCount = 0;
+    uint8_t maxExtraRoutes = 0;
 
-    inline unsigned int getMaxLineLength(const char* str) {
-        unsigned int maxLength = 0;
-        unsigned int currentLength = 0;
+    // Single return statements, so the route table checks also compile as C++11
+    constexpr int compareRoutes(const Route &a, const Route &b, size_t i = 0)
+    {
+        return a.uri[i] != b.uri[i] || a.uri[i] == 0
+            ? ((unsigned char) a.uri[i] != (unsigned char) b.uri[i]
+                ? (unsigned char) a.uri[i] - (unsigned char) b.uri[i]
+                : (int) a.method - (int) b.method)
+            : compareRoutes(a, b, i + 1);
+    }
 
-        unsigned int len = strlen(str);
-        for (unsigned int i = 0; i < len; i++)
+    /**
+     * Compile time check for route tables, lookups are a binary search so tables must be strictly sorted.
+     */
+    constexpr bool routesSorted(const Route *routes, size_t count)
+    {
+        return count < 2 || (compareRoutes(routes[0], routes[1]) < 0 && routesSorted(routes + 1, count - 1));
+    }
+
+    inline void enableRoutes(uint8_t module)
+    {
+        enabledRouteModules |= 1 << module;
+    }
+
+    inline const char* methodName(HTTPMethod method)
+    {
+        return method < sizeof(httpMethodMapping) / sizeof(httpMethodMapping[0]) ? httpMethodMapping[method] : "";
+    }
+
+    /**
+     * Finds the first table route with the given uri, using method as the lower bound.
+     * @return true if found, route is copied to out and its table index to index, if not null.
+     */
+    inline bool findRoute(const char *uri, HTTPMethod method, Route &out, size_t *index = nullptr)
+    {
+        size_t low = 0;
+        size_t high = routeCount;
+
+        while (low < high)
         {
-            const char c = str[i];
-            if (c == '\n' || c == '\r')
+            size_t mid = (low + high) / 2;
+            Route route;
+            memcpy_P(&route, &routeTable[mid], sizeof(Route));
+
+            int cmp = strcmp_P(uri, route.uri);
+            if (cmp > 0 || (cmp == 0 && (int) method > (int) route.method))
             {
-                if (currentLength > maxLength)
-                {
-                    maxLength = currentLength;
-                }
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
 
-                currentLength = 0;
-                if (c == '\r' && i < len-1 && str[i+1] == '\n')
+        for (; low < routeCount; low++)
+        {
+            memcpy_P(&out, &routeTable[low], sizeof(Route));
+            if (strcmp_P(uri, out.uri) != 0)
+            {
+                return false;
+            }
+
+            if ((out.method == method || method == HTTP_ANY) && (enabledRouteModules & (1 << out.module)))
+            {
+                if (index != nullptr)
                 {
-                    i++;
+                    *index = low;
                 }
+                return true;
             }
-            else
+        }
+
+        return false;
+    }
+
+    inline ExtraRoute* findExtraRoute(const char *uri, HTTPMethod method)
+    {
+        for (uint8_t i = 0; i < extraRoutesCount; i++)
+        {
+            if (extraRoutes[i]->method == method && strcmp(extraRoutes[i]->uri, uri) == 0)
             {
-                currentLength++;
+                return extraRoutes[i];
             }
         }
 
-        return maxLength;
+        return nullptr;
     }
 
-    inline bool validateAuth()
+    /**
+     * Single request handler registered in the webserver for every config page route.
+     * Authentication and request logging are done here, once, before calling the route handler.
+     */
+    class RouteDispatcher : public REQUEST_HANDLER_T
     {
-        if (!server->authenticate(username.c_str(), password.c_str()))
+    public:
+        bool canHandle(HTTPMethod method, const String& uri) override
         {
-            delay(1000);
-            server->requestAuthentication();
-            return false;
+            Route route;
+            return findRoute(uri.c_str(), method, route) || findExtraRoute(uri.c_str(), method) != nullptr;
         }
 
-        return true;
-    }
+        bool canUpload(const String& uri) override
+        {
+            Route route;
+            return findRoute(uri.c_str(), HTTP_POST, route) && route.upload != nullptr;
+        }
 
-    Stream* serial = &Serial;
+        bool canRaw(const String& uri) override
+        {
+            Route route;
+            return findRoute(uri.c_str(), HTTP_POST, route) && route.pair != nullptr;
+        }
 
-    PROGMEM char httpMethodMapping[5][8] = {"DELETE", "GET", "HEAD", "POST", "PUT"};
+        bool handle(WEBSERVER_T& server, HTTPMethod method, const String& uri) override
+        {
+            Route route;
+            size_t index = 0;
+            ExtraRoute *extra = nullptr;
+            bool found = findRoute(uri.c_str(), method, route, &index);
 
-    inline void addServerHandler(char *uri, HTTPMethod method, std::function<void(void)> fn)
-    {
-        server->on(uri, method, [uri, method, fn]()
+            if (!found && (extra = findExtraRoute(uri.c_str(), method)) == nullptr)
+            {
+                return false;
+            }
+
+#if ESP_CONP_METRICS
+            LatencyHistogram unmeasured{};
+            ESP_CONP_MEASURE(found ? (routeLatency != nullptr ? routeLatency[index] : unmeasured) : extra->latency);
+#endif
+
+            if (!validateAuth())
+            {
+                if (found)
+                {
+                    abortBody(route);
+                }
+                bodyTokenizer.reset();
+                return true;
+            }
+
+            LOGF("Received request: %s - %s.\n", uri.c_str(), methodName(method));
+
+            if (found && route.pair != nullptr && !bodyTokenizer.wasFed())
+            {
+                String body = server.arg("plain");
+                bodyTokenizer.reset(route.escaped);
+                if (body.length() > 0)
+                {
+                    bodyTokenizer.feed(&body[0], body.length(), route.pair);
+                }
+            }
+
+            if (found)
+            {
+                route.handler();
+                bodyTokenizer.reset();
+            }
+            else
+            {
+                extra->fn();
+            }
+
+            return true;
+        }
+
+        void upload(WEBSERVER_T& server, const String& uri, HTTPUpload& upload) override
         {
-            VALIDATE_AUTH();
-            LOGF("Received request: %s - %s.\n", uri, (method < sizeof(httpMethodMapping) ? httpMethodMapping[method] : ""));
-            fn();
-        });
-    }
+            Route route;
+            if (!findRoute(uri.c_str(), HTTP_POST, route) || route.upload == nullptr)
+            {
+                return;
+            }
 
-    String name;
-    const char escapeChars[] = {':', ';', '+', '\0'};
-    const char escaper = '|';
+            // Auth is checked once when the upload starts, not for every chunk
+            if (upload.status == UPLOAD_FILE_START)
+            {
+                uploadAuthed = isAuthenticated();
+            }
 
-    inline uint8_t countChar(const char str[], const char separator)
-    {
-        uint8_t delimiterCount = 0;
-        bool escaped = false;
-        int len = strlen(str);
+            if (!uploadAuthed)
+            {
+                return;
+            }
 
-        for (int i = 0; i < len; i++)
+            route.upload();
+        }
+
+        void raw(WEBSERVER_T& server, const String& uri, HTTPRaw& raw) override
         {
-            char cstr = str[i];
-            if (cstr == escaper && !escaped)
+            Route route;
+            if (!findRoute(uri.c_str(), HTTP_POST, route) || route.pair == nullptr)
             {
-                escaped = true;
+                return;
             }
-            else if (cstr == separator && !escaped)
+
+            if (raw.status == RAW_START)
             {
-                delimiterCount++;
+                bodyTokenizer.reset(route.escaped);
+                uploadAuthed = isAuthenticated();
             }
-            else
+            else if (raw.status == RAW_WRITE && uploadAuthed)
             {
-                escaped = false;
+                bodyTokenizer.feed((char*) raw.buf, raw.currentSize, route.pair);
+            }
+            else if (raw.status == RAW_ABORTED)
+            {
+                // The handler is not called for a dropped body, the batch its pairs opened would stay open
+                abortBody(route);
+                bodyTokenizer.reset();
             }
         }
 
-        return delimiterCount;
-    }
+    private:
+        bool uploadAuthed = false;
+
+        static void abortBody(const Route &route)
+        {
+            if (route.abort != nullptr && bodyTokenizer.pairs() > 0)
+            {
+                route.abort();
+            }
+        }
+    };
 
     /**
-     * Sets the esp-config-page serial for printing.
-     * @param toSet serial to set.
+     * Sets the route table used by the dispatcher.
      */
-    inline void setSerial(Stream* toSet)
+    inline void setRouteTable(const Route *routes, size_t count)
     {
-        serial = toSet;
+        routeTable = routes;
+        routeCount = count;
+#if ESP_CONP_METRICS
+        free(routeLatency);
+        routeLatency = (LatencyHistogram*) calloc(count, sizeof(LatencyHistogram));
+#endif
     }
 
-    enum Modules
+    /**
+     * Adds an authenticated route to the config page server, served by the same dispatcher as the library's routes.
+     *
+     * @param uri - Route uri, has to stay valid while the server is running.
+     * @param method - Route HTTP method.
+     * @param fn - Route handler.
+     */
+    inline void addServerHandler(const char *uri, HTTPMethod method, std::function<void(void)> fn)
     {
-        OTA,
-        WIRELESS,
-        FILES,
-        ACTIONS,
-        ENVIRONMENT,
-        ATTRIBUTES,
-    };
-    Modules *enabledModules = nullptr;
-    uint8_t enabledModulesCount = 0;
+        if (extraRoutesCount + 1 > maxExtraRoutes)
+        {
+            maxExtraRoutes = maxExtraRoutes == 0 ? 1 : ceil(maxExtraRoutes * 1.5);
+            extraRoutes = (ExtraRoute**) realloc(extraRoutes, sizeof(ExtraRoute*) * maxExtraRoutes);
+        }
+
+        extraRoutes[extraRoutesCount] = new ExtraRoute{uri, method, fn};
+        extraRoutesCount++;
+    }
 
     /**
      * Free dynamically allocated array of arrays.
@@ -205,6 +1392,42 @@ namespace ESP_CONFIG_PAGE
         return true;
     }
 
+    constexpr uint32_t fnv1aHash(const char *str, size_t len, uint32_t hash)
+    {
+        return len == 0 ? hash : fnv1aHash(str + 1, len - 1, (hash ^ (uint8_t) *str) * 16777619u);
+    }
+
+    constexpr uint32_t fnv1aHash(const char *str, size_t len)
+    {
+        return fnv1aHash(str, len, 2166136261u);
+    }
+
+    constexpr uint32_t fnv1aHashString(const char *str, uint32_t hash)
+    {
+        return *str == 0 ? hash : fnv1aHashString(str + 1, (hash ^ (uint8_t) *str) * 16777619u);
+    }
+
+    /**
+     * Hash of a null terminated string, computed by the compiler when str is a literal in a constant expression.
+     */
+    constexpr uint32_t fnv1aHash(const char *str)
+    {
+        return fnv1aHashString(str, 2166136261u);
+    }
+
+    /**
+     * How the saved values are read when a storage is set with setAndUpdateEnvVarStorage or setAndUpdateAttributeStorage.
+     */
+    enum RestoreMode
+    {
+        // One recover per registered key
+        RESTORE_EACH,
+        // One pass over the keys in the storage, keys that were never saved cost no lookup
+        RESTORE_SCAN,
+        // Nothing is read until the value is used
+        RESTORE_LAZY,
+    };
+
     /**
      * Storage class for any key value pair.
      */
@@ -230,11 +1453,192 @@ namespace ESP_CONFIG_PAGE
          */
         virtual size_t recover(const char *key, char *out, size_t outSize) = 0;
 
+        /**
+         * Calls fn with every key and its value, values longer than maxValueSize are cut. Use nextKey and readValue to
+         * read whole values or only the keys.
+         */
         virtual void doForEachKey(std::function<bool(const char *key, const char *value)> fn, const size_t maxValueSize) = 0;
 
+        /**
+         * Reads the next key into key without reading its value, keys that do not fit in keySize are skipped.
+         * @param cursor Position of the iteration, start it at 0 and pass it again to continue, also after other calls.
+         * Keys saved or removed in between may or may not be visited.
+         * @return false when there are no more keys.
+         */
+        virtual bool nextKey(size_t &cursor, char *key, size_t keySize)
+        {
+            size_t position = 0;
+            bool found = false;
+            doForEachKey([&](const char *next, const char *value)
+            {
+                if (position++ < cursor || strlen(next) >= keySize)
+                {
+                    return true;
+                }
+
+                strcpy(key, next);
+                found = true;
+                return false;
+            }, 0);
+
+            cursor = position;
+            return found;
+        }
+
+        /**
+         * Reads up to outSize bytes of the value of key from offset on, without a null terminator, so values of any
+         * length can be read in chunks.
+         * @param valueLength Set to the whole length of the value, 0 if the key does not exist.
+         * @return bytes read.
+         */
+        virtual size_t readValue(const char *key, size_t offset, char *out, size_t outSize, size_t *valueLength = nullptr)
+        {
+            char *value = recover(key);
+            const size_t length = value != nullptr ? strlen(value) : 0;
+            const size_t read = copyValueChunk(value, length, offset, out, outSize, valueLength);
+            free(value);
+            return read;
+        }
+
+        /**
+         * Calls fn with every key without reading the values, keys longer than ESP_CONP_KV_MAX_KEY_LEN are skipped.
+         */
+        void doForEachKeyOnly(std::function<bool(const char *key)> fn)
+        {
+            char key[ESP_CONP_KV_MAX_KEY_LEN + 1];
+            size_t cursor = 0;
+            while (nextKey(cursor, key, sizeof(key)))
+            {
+                if (!fn(key))
+                {
+                    endIteration();
+                    break;
+                }
+            }
+        }
+
+        /**
+         * Frees what nextKey keeps open between calls, call it when stopping before nextKey returned false.
+         */
+        virtual void endIteration()
+        {
+        }
+
         virtual bool exists(const char *key) = 0;
+
+        /**
+         * Remove a key from storage, storages without deletion save an empty value instead.
+         */
+        virtual void remove(const char *key)
+        {
+            save(key, "");
+        }
+
+        /**
+         * Starts a batch, the saves and removes until commit() are applied all together or not at all. Recovering a key
+         * during the batch returns its value from before it. Storages without batches apply every save right away.
+         */
+        virtual void beginBatch()
+        {
+            batchOpen = true;
+        }
+
+        /**
+         * Applies the batch.
+         * @return false if it could not be applied, the storage is left as it was before the batch then.
+         */
+        virtual bool commit()
+        {
+            batchOpen = false;
+            return true;
+        }
+
+        /**
+         * Drops the saves and removes of the batch.
+         */
+        virtual void abort()
+        {
+            batchOpen = false;
+        }
+
+        bool inBatch() const
+        {
+            return batchOpen;
+        }
+
+    protected:
+        bool batchOpen = false;
+
+        /**
+         * doForEachKey over nextKey and readValue, with one value buffer for the whole iteration.
+         */
+        void doForEachKeyByCursor(std::function<bool(const char *key, const char *value)> &fn, const size_t maxValueSize)
+        {
+            char *value = (char*) malloc(maxValueSize + 1);
+            if (value == nullptr)
+            {
+                LOGN("Memory allocation failed for key value iteration.");
+                return;
+            }
+
+            char key[ESP_CONP_KV_MAX_KEY_LEN + 1];
+            size_t cursor = 0;
+            while (nextKey(cursor, key, sizeof(key)))
+            {
+                value[readValue(key, 0, value, maxValueSize)] = 0;
+                if (!fn(key, value))
+                {
+                    endIteration();
+                    break;
+                }
+            }
+
+            free(value);
+        }
+
+        static size_t copyValueChunk(const char *value, size_t length, size_t offset, char *out, size_t outSize, size_t *valueLength)
+        {
+            if (valueLength != nullptr)
+            {
+                *valueLength = length;
+            }
+
+            if (value == nullptr || offset >= length)
+            {
+                return 0;
+            }
+
+            const size_t n = length - offset < outSize ? length - offset : outSize;
+            memcpy(out, value + offset, n);
+            return n;
+        }
     };
 
+    /**
+     * Mounts LittleFS for the storages, formatting it when the mount fails.
+     */
+    inline void mountLittleFS()
+    {
+        LOGN("Trying to mount LittleFS.");
+#ifdef ESP32
+        if (!LittleFS.begin(false /* false: Do not format if mount failed */))
+        {
+            LOGN("Failed to mount LittleFS");
+            if (!LittleFS.begin(true /* true: format */))
+            {
+                LOGN("Failed to format LittleFS");
+            }
+            else
+            {
+                LOGN("LittleFS formatted successfully");
+                ESP.restart();
+            }
+        }
+#elif ESP8266
+        LittleFS.begin();
+#endif
+    }
+
     /**
      * Default EnvVarStorage subclass for the library, will store all environment variables in a LittleFS text file.
      * File path is defined by the class's constructor argument.
@@ -244,6 +1648,13 @@ namespace ESP_CONFIG_PAGE
     public:
         ~LittleFSKeyValueStorage() override
         {
+            closeIteration();
+            freeBatch();
+            free(batchKeys);
+            free(batchValues);
+            free(folderPath);
+            free(journalPath);
+            free(journalTmpPath);
         }
 
         /**
@@ -252,24 +1663,7 @@ namespace ESP_CONFIG_PAGE
          */
         LittleFSKeyValueStorage(const char *folderPath)
         {
-            LOGN("Trying to mount LittleFS.");
-#ifdef ESP32
-            if (!LittleFS.begin(false /* false: Do not format if mount failed */))
-            {
-                LOGN("Failed to mount LittleFS");
-                if (!LittleFS.begin(true /* true: format */))
-                {
-                    LOGN("Failed to format LittleFS");
-                }
-                else
-                {
-                    LOGN("LittleFS formatted successfully");
-                    ESP.restart();
-                }
-            }
-#elif ESP8266
-            LittleFS.begin();
-#endif
+            mountLittleFS();
 
 #ifdef ESP32
             this->folderPath = (char*) malloc(strlen(folderPath)+1);
@@ -282,25 +1676,78 @@ namespace ESP_CONFIG_PAGE
 
             if (!LittleFS.exists(this->folderPath))
             {
-                LOGF("Path %s does not exist, creating: %s.\n", this->folderPath, LittleFS.mkdir(this->folderPath) ? "true" : "false");
+                const bool created = LittleFS.mkdir(this->folderPath);
+                (void) created;
+                LOGF("Path %s does not exist, creating: %s.\n", this->folderPath, created ? "true" : "false");
             }
+
+            journalPath = (char*) malloc(strlen(folderPath) + 9);
+            sprintf(journalPath, "%s.journal", folderPath);
+            journalTmpPath = (char*) malloc(strlen(folderPath) + 13);
+            sprintf(journalTmpPath, "%s.journal.tmp", folderPath);
+            recoverJournal();
         }
 
         void save(const char *key, const char *value) override
         {
-            char filePath[filePathLength(key)];
-            getFilePath(key, filePath);
-            LOGF("Saving value for key %s in path %s.\n", key, filePath);
+            if (batchOpen)
+            {
+                stage(key, value);
+                return;
+            }
 
-            File file = LittleFS.open(filePath, "w");
+            writeFile(key, value);
+        }
 
-#ifdef ESP32
-            file.print(value);
-#elif ESP8266
-            file.write(value);
-#endif
+        void beginBatch() override
+        {
+            freeBatch();
+            batchOpen = true;
+            batchFailed = false;
+        }
 
-            file.close();
+        /**
+         * Writes the batch to a journal file first, renaming it into place is the commit point and a journal found on
+         * boot is applied again, so a power loss while the keys are written leaves either all or none of them.
+         */
+        bool commit() override
+        {
+            batchOpen = false;
+            if (batchFailed)
+            {
+                LOGN("Batch not applied, a save of it could not be kept.");
+                freeBatch();
+                return false;
+            }
+
+            if (batchCount == 0)
+            {
+                return true;
+            }
+
+            bool committed = writeJournal();
+            if (committed)
+            {
+                for (size_t i = 0; i < batchCount; i++)
+                {
+                    applyStaged(batchKeys[i], batchValues[i]);
+                }
+                LittleFS.remove(journalPath);
+            }
+            else
+            {
+                LOGF("Failed to write batch journal %s.\n", journalTmpPath);
+                LittleFS.remove(journalTmpPath);
+            }
+
+            freeBatch();
+            return committed;
+        }
+
+        void abort() override
+        {
+            batchOpen = false;
+            freeBatch();
         }
 
         char* recover(const char *key) override
@@ -345,53 +1792,81 @@ namespace ESP_CONFIG_PAGE
             return read;
         }
 
+        /**
+         * Values are read into one buffer for the whole iteration instead of one per file.
+         */
         void doForEachKey(std::function<bool(const char* key, const char* value)> fn, const size_t maxValueSize) override
         {
-#ifdef ESP32
-            File file = LittleFS.open(folderPath);
-            File nextFile;
-            while (file.isDirectory() && ((nextFile = file.openNextFile())))
+            doForEachKeyByCursor(fn, maxValueSize);
+        }
+
+        /**
+         * Walks the folder entries without opening the files. The folder stays open between calls, so continuing from
+         * the last cursor does not scan it again.
+         */
+        bool nextKey(size_t &cursor, char *key, size_t keySize) override
+        {
+            if (cursor == 0 || cursor != iterPosition || !iterOpen)
             {
-                if (!nextFile || nextFile.isDirectory())
+                openIteration();
+                while (iterPosition < cursor && nextFileName() != nullptr)
                 {
-                    continue;
                 }
+            }
 
-                char buf[maxValueSize+1]{};
-                nextFile.readBytes(buf, maxValueSize);
-                bool result = fn(nextFile.name(), buf);
-                nextFile.close();
-
-                if (!result)
+            const char *name;
+            while ((name = nextFileName()) != nullptr)
+            {
+                if (strlen(name) < keySize)
                 {
-                    break;
+                    strcpy(key, name);
+                    cursor = iterPosition;
+                    return true;
                 }
+
+                LOGF("Skipping key %s, longer than the key buffer.\n", name);
             }
 
-            if (file)
+            cursor = iterPosition;
+            closeIteration();
+            return false;
+        }
+
+        void endIteration() override
+        {
+            closeIteration();
+        }
+
+        size_t readValue(const char *key, size_t offset, char *out, size_t outSize, size_t *valueLength = nullptr) override
+        {
+            char filePath[filePathLength(key)];
+            getFilePath(key, filePath);
+
+            if (valueLength != nullptr)
             {
-                file.close();
+                *valueLength = 0;
             }
-#elif ESP8266
-            Dir dir = LittleFS.openDir(folderPath);
 
-            while (dir.next()) {
-                if (!dir.isDirectory())
-                {
-                    File file = dir.openFile("r");
+            if (!LittleFS.exists(filePath))
+            {
+                return 0;
+            }
 
-                    char buf[maxValueSize+1]{};
-                    file.readBytes(buf, maxValueSize);
-                    bool result = fn(file.name(), buf);
-                    file.close();
+            File file = LittleFS.open(filePath, "r");
+            const size_t size = file.size();
+            if (valueLength != nullptr)
+            {
+                *valueLength = size;
+            }
 
-                    if (!result)
-                    {
-                        break;
-                    }
-                }
+            size_t read = 0;
+            if (offset < size && file.seek(offset))
+            {
+                read = file.readBytes(out, size - offset < outSize ? size - offset : outSize);
             }
-#endif
+
+            file.close();
+            return read;
         }
 
         bool exists(const char* key) override
@@ -401,7 +1876,283 @@ namespace ESP_CONFIG_PAGE
             return LittleFS.exists(filePath);
         }
 
+        void remove(const char* key) override
+        {
+            if (batchOpen)
+            {
+                stage(key, nullptr);
+                return;
+            }
+
+            removeFile(key);
+        }
+
     protected:
+        void writeFile(const char *key, const char *value)
+        {
+            ESP_CONP_MEASURE(flashWriteLatency);
+            char filePath[filePathLength(key)];
+            getFilePath(key, filePath);
+            LOGF("Saving value for key %s in path %s.\n", key, filePath);
+
+            File file = LittleFS.open(filePath, "w");
+
+#ifdef ESP32
+            file.print(value);
+#elif ESP8266
+            file.write(value);
+#endif
+
+            file.close();
+        }
+
+        void removeFile(const char *key)
+        {
+            char filePath[filePathLength(key)];
+            getFilePath(key, filePath);
+            LittleFS.remove(filePath);
+        }
+
+        void applyStaged(const char *key, const char *value)
+        {
+            if (value != nullptr)
+            {
+                writeFile(key, value);
+            }
+            else
+            {
+                removeFile(key);
+            }
+        }
+
+        /**
+         * Keeps a copy of the save until commit(), value is nullptr for removes. If the copy fails the whole batch fails.
+         */
+        void stage(const char *key, const char *value)
+        {
+            char *valueCopy = nullptr;
+            if (value != nullptr)
+            {
+                valueCopy = (char*) malloc(strlen(value) + 1);
+                if (valueCopy == nullptr)
+                {
+                    LOGN("Memory allocation failed for batch value.");
+                    batchFailed = true;
+                    return;
+                }
+                strcpy(valueCopy, value);
+            }
+
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                if (strcmp(batchKeys[i], key) == 0)
+                {
+                    free(batchValues[i]);
+                    batchValues[i] = valueCopy;
+                    return;
+                }
+            }
+
+            if (batchCount + 1 > maxBatch)
+            {
+                const size_t newMax = maxBatch == 0 ? 4 : ceil(maxBatch * 1.5);
+                auto **newKeys = (char**) realloc(batchKeys, newMax * sizeof(char*));
+                if (newKeys != nullptr)
+                {
+                    batchKeys = newKeys;
+                }
+
+                auto **newValues = (char**) realloc(batchValues, newMax * sizeof(char*));
+                if (newValues != nullptr)
+                {
+                    batchValues = newValues;
+                }
+
+                if (newKeys == nullptr || newValues == nullptr)
+                {
+                    LOGN("Memory allocation failed for batch array.");
+                    free(valueCopy);
+                    batchFailed = true;
+                    return;
+                }
+                maxBatch = newMax;
+            }
+
+            char *keyCopy = (char*) malloc(strlen(key) + 1);
+            if (keyCopy == nullptr)
+            {
+                LOGN("Memory allocation failed for batch key.");
+                free(valueCopy);
+                batchFailed = true;
+                return;
+            }
+            strcpy(keyCopy, key);
+
+            batchKeys[batchCount] = keyCopy;
+            batchValues[batchCount] = valueCopy;
+            batchCount++;
+        }
+
+        void freeBatch()
+        {
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                free(batchKeys[i]);
+                free(batchValues[i]);
+            }
+            batchCount = 0;
+        }
+
+        /**
+         * Journal entries are 'S', key, 0, value, 0 for saves and 'R', key, 0 for removes.
+         */
+        bool writeJournal()
+        {
+            File journal = LittleFS.open(journalTmpPath, "w");
+            if (!journal)
+            {
+                return false;
+            }
+
+            size_t expected = 0;
+            size_t written = 0;
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                const size_t keyLength = strlen(batchKeys[i]) + 1;
+                written += journal.write((uint8_t) (batchValues[i] != nullptr ? 'S' : 'R'));
+                written += journal.write((const uint8_t*) batchKeys[i], keyLength);
+                expected += keyLength + 1;
+
+                if (batchValues[i] != nullptr)
+                {
+                    const size_t valueLength = strlen(batchValues[i]) + 1;
+                    written += journal.write((const uint8_t*) batchValues[i], valueLength);
+                    expected += valueLength;
+                }
+            }
+
+            journal.flush();
+            journal.close();
+            return written == expected && LittleFS.rename(journalTmpPath, journalPath);
+        }
+
+        static bool readJournalString(File &journal, String &out)
+        {
+            out = "";
+            int c;
+            while ((c = journal.read()) > 0)
+            {
+                out += (char) c;
+            }
+            return c == 0;
+        }
+
+        /**
+         * Applies a journal left by a commit interrupted by a power loss, a journal that was not renamed yet is dropped.
+         */
+        void recoverJournal()
+        {
+            if (LittleFS.exists(journalTmpPath))
+            {
+                LOGF("Dropping uncommitted batch %s.\n", journalTmpPath);
+                LittleFS.remove(journalTmpPath);
+            }
+
+            if (!LittleFS.exists(journalPath))
+            {
+                return;
+            }
+
+            LOGF("Applying interrupted batch %s.\n", journalPath);
+            File journal = LittleFS.open(journalPath, "r");
+            String key;
+            String value;
+            int op;
+            while ((op = journal.read()) == 'S' || op == 'R')
+            {
+                if (!readJournalString(journal, key) || (op == 'S' && !readJournalString(journal, value)))
+                {
+                    break;
+                }
+
+                applyStaged(key.c_str(), op == 'S' ? value.c_str() : nullptr);
+            }
+
+            journal.close();
+            LittleFS.remove(journalPath);
+        }
+
+        void openIteration()
+        {
+            closeIteration();
+#ifdef ESP32
+            iterDir = LittleFS.open(folderPath);
+            iterOpen = iterDir && iterDir.isDirectory();
+#elif ESP8266
+            iterOpen = LittleFS.exists(folderPath);
+            if (iterOpen)
+            {
+                iterDir = LittleFS.openDir(folderPath);
+            }
+#endif
+            iterPosition = 0;
+        }
+
+        void closeIteration()
+        {
+#ifdef ESP32
+            if (iterDir)
+            {
+                iterDir.close();
+            }
+#endif
+            iterOpen = false;
+        }
+
+        /**
+         * Name of the next file in the folder, folders are skipped.
+         * @return the name or nullptr at the end of the folder.
+         */
+        const char *nextFileName()
+        {
+            while (iterOpen)
+            {
+#ifdef ESP32
+                bool isDir = false;
+                iterName = iterDir.getNextFileName(&isDir);
+                if (iterName.length() == 0)
+                {
+                    break;
+                }
+
+                if (isDir)
+                {
+                    continue;
+                }
+
+                iterPosition++;
+                const int slash = iterName.lastIndexOf('/');
+                return iterName.c_str() + slash + 1;
+#elif ESP8266
+                if (!iterDir.next())
+                {
+                    break;
+                }
+
+                if (iterDir.isDirectory())
+                {
+                    continue;
+                }
+
+                iterName = iterDir.fileName();
+                iterPosition++;
+                return iterName.c_str();
+#endif
+            }
+
+            return nullptr;
+        }
+
         unsigned int filePathLength(const char *key)
         {
             return strlen(key) + strlen(this->folderPath) + 2;
@@ -413,8 +2164,29 @@ namespace ESP_CONFIG_PAGE
         }
     private:
         char *folderPath;
+        char *journalPath = nullptr;
+        char *journalTmpPath = nullptr;
+        char **batchKeys = nullptr;
+        char **batchValues = nullptr;
+        size_t batchCount = 0;
+        size_t maxBatch = 0;
+        // A save or remove of the open batch could not be staged, commit() fails
+        bool batchFailed = false;
+
+#ifdef ESP32
+        File iterDir;
+#elif ESP8266
+        Dir iterDir;
+#endif
+        String iterName;
+        size_t iterPosition = 0;
+        bool iterOpen = false;
     };
 
 }
 
+#include "esp-config-page-string-pool.h"
+#include "esp-config-page-log-storage.h"
+#include "esp-config-page-cache-storage.h"
+
 #endif
\ No newline at end of file
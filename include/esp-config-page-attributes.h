@@ -34,52 +34,75 @@ namespace ESP_CONFIG_PAGE
     public:
         Attribute(const char *key, const char *nameStr, const AttributeType type) : key(key), name(nameStr), type(type), onChange(nullptr)
         {
-            this->isStrDinamic = false;
         }
 
         ~Attribute()
         {
-            if (this->isStrDinamic)
-            {
-                free(this->value.str);
-            }
+            stringPool.release(this->strHandle);
         }
 
+        // The string pool keeps the address of value.str, a copy would not be updated when it moves
+        Attribute(const Attribute &) = delete;
+        Attribute &operator=(const Attribute &) = delete;
+
         void set(const AttributeValue value)
         {
             this->set(value, true);
         }
 
+        /**
+         * Text values are copied into the string pool, which may move them later, read getValue() again instead of
+         * keeping the pointer.
+         */
         void set(const AttributeValue value, bool save)
         {
-            if (this->isStrDinamic)
+            this->pending = false;
+            if (this->type != ATTR_TEXT)
             {
-                free(value.str);
+                this->value = value;
             }
+            else if (value.str != this->value.str || this->strHandle == STRING_POOL_NONE)
+            {
+                const uint16_t handle = stringPool.add(value.str != nullptr ? value.str : "", &this->value.str);
+                if (handle == STRING_POOL_NONE)
+                {
+                    return;
+                }
 
-            this->value = value;
-            this->isStrDinamic = false;
+                stringPool.release(this->strHandle);
+                this->strHandle = handle;
+            }
 
             if (onChange != nullptr)
             {
-                onChange(value);
+                onChange(this->value);
             }
 
             if (save && attributeStorage != nullptr)
             {
-                char buf[this->serializedValueSize()];
+                char buf[this->serializedValueSize() + 1];
                 serializeValue(buf);
                 attributeStorage->save(this->key, buf);
             }
         }
 
+        /**
+         * With RESTORE_LAZY the saved value is read from the storage on the first call.
+         */
         AttributeValue getValue()
         {
+            restoreIfPending();
             return this->value;
         }
 
+        AttributeType getType()
+        {
+            return this->type;
+        }
+
         unsigned int serializedValueSize()
         {
+            restoreIfPending();
             switch (this->type)
             {
             case ATTR_INT:
@@ -105,6 +128,7 @@ namespace ESP_CONFIG_PAGE
 
         bool serializeValue(char *out)
         {
+            restoreIfPending();
             switch (this->type)
             {
             case ATTR_INT:
@@ -160,8 +184,8 @@ namespace ESP_CONFIG_PAGE
                 }
             case ATTR_TEXT:
                 {
-                    newVal.str = (char*) malloc(strlen(in)+1);
-                    strcpy(newVal.str, in);
+                    // Copied into the pool by set
+                    newVal.str = (char*) in;
                     changed = true;
                     break;
                 }
@@ -172,12 +196,24 @@ namespace ESP_CONFIG_PAGE
                 set(newVal, false);
             }
 
-            if (type == ATTR_TEXT)
+            return changed;
+        }
+
+        /**
+         * Reads the saved value from the storage, if there is one.
+         */
+        void restore()
+        {
+            this->pending = false;
+            char *saved = attributeStorage->recover(this->key);
+            if (saved == nullptr)
             {
-                this->isStrDinamic = true;
+                return;
             }
 
-            return changed;
+            LOGF("Found value saved for attribute %s: %s\n", this->key, saved);
+            deserializeValue(saved);
+            free(saved);
         }
 
         const char *key;
@@ -186,8 +222,21 @@ namespace ESP_CONFIG_PAGE
          * Function that will be called any time the value changes.
          */
         void (*onChange)(AttributeValue newValue);
+
+        // Not read from the storage yet
+        bool pending = false;
     private:
-        bool isStrDinamic;
+        void restoreIfPending()
+        {
+            if (this->pending && attributeStorage != nullptr)
+            {
+                ESP_CONP_MEASURE(attributeRestoreLatency);
+                restore();
+            }
+        }
+
+        // Handle of value.str in stringPool, STRING_POOL_NONE before the first text value is set
+        uint16_t strHandle = STRING_POOL_NONE;
         const char *name;
         const AttributeType type;
         AttributeValue value;
@@ -217,8 +266,10 @@ namespace ESP_CONFIG_PAGE
     /**
      * Sets the storage for attributes and recovers saved attributes in the filesystem.
      * @param storage Storage to be used in the attributes module.
+     * @param mode RESTORE_EACH recovers every attribute now, RESTORE_SCAN reads the saved keys in one pass, which is
+     * faster when few of the attributes were saved, and RESTORE_LAZY reads each attribute on its first use.
      */
-    inline void setAndUpdateAttributeStorage(KeyValueStorage *storage)
+    inline void setAndUpdateAttributeStorage(KeyValueStorage *storage, RestoreMode mode = RESTORE_EACH)
     {
         LOGN("Setting up attribute storage.");
         attributeStorage = storage;
@@ -228,6 +279,7 @@ namespace ESP_CONFIG_PAGE
             return;
         }
 
+        ESP_CONP_MEASURE(attributeRestoreLatency);
         for (uint8_t i = 0; i < attributeCount; i++)
         {
             Attribute *attribute = attributes[i];
@@ -236,45 +288,70 @@ namespace ESP_CONFIG_PAGE
                 continue;
             }
 
-            char *value = attributeStorage->recover(attribute->key);
-            if (value == nullptr)
+            attribute->pending = mode != RESTORE_EACH;
+            if (mode == RESTORE_EACH)
             {
-                continue;
+                attribute->restore();
             }
+        }
 
-            LOGF("Found value saved for attribute %s: %s\n", attribute->key, value);
-            attribute->deserializeValue(value);
-            free(value);
+        if (mode != RESTORE_SCAN)
+        {
+            return;
         }
-    }
 
-    inline void getAttributes()
-    {
-        unsigned int size = 16;
+        attributeStorage->doForEachKeyOnly([](const char *key)
+        {
+            for (uint8_t i = 0; i < attributeCount; i++)
+            {
+                Attribute *attribute = attributes[i];
+                if (attribute != nullptr && attribute->pending && strcmp(attribute->key, key) == 0)
+                {
+                    attribute->restore();
+                    break;
+                }
+            }
+            return true;
+        });
+
         for (uint8_t i = 0; i < attributeCount; i++)
         {
-            size += attributes[i] != nullptr ? attributes[i]->serializedValueSize()+2 : 0;
+            if (attributes[i] != nullptr)
+            {
+                attributes[i]->pending = false;
+            }
         }
+    }
+
+    inline void getAttributes()
+    {
+        ResponseWriter writer;
+        bool first = true;
 
-        char buf[size];
         for (uint8_t i = 0; i < attributeCount; i++)
         {
-            if (attributes[i] == nullptr)
+            Attribute *attribute = attributes[i];
+            if (attribute == nullptr)
             {
                 continue;
             }
 
-            char serialized[attributes[i]->serializedValueSize()];
-            attributes[i]->serializeValue(serialized);
+            if (!first)
+            {
+                writer.print('\n');
+            }
+            first = false;
 
-            strcat(buf, serialized);
-            if (i < attributeCount-1)
+            if (attribute->getType() == ATTR_TEXT)
             {
-                strcat(buf, "\n");
+                writer.print(attribute->getValue().str);
+                continue;
             }
-        }
 
-        server->send(200, "text/plain", buf);
+            char serialized[attribute->serializedValueSize()+1];
+            attribute->serializeValue(serialized);
+            writer.print(serialized);
+        }
     }
 
     inline void findAndSet(const char* key, const char* value)
@@ -284,59 +361,48 @@ namespace ESP_CONFIG_PAGE
             if (attributes[i] != nullptr && strcmp(attributes[i]->key, key) == 0)
             {
                 attributes[i]->deserializeValue(value);
-                attributeStorage->save(key, value);
+                if (attributeStorage != nullptr)
+                {
+                    attributeStorage->save(key, value);
+                }
                 break;
             }
         }
     }
 
-    inline void setAttribute()
+    inline bool setAttributePair(char *key, size_t keyLength, char *value, size_t valueLength)
     {
-        String text = server->arg("plain");
-
-        unsigned int maxLineLength = getMaxLineLength(text.c_str());
-        char buf[maxLineLength];
-
-        bool keySet = false;
-        char *key = nullptr;
-
-        unsigned int currentChar = 0;
-        for (unsigned int i = 0; i < text.length(); i++)
+        if (attributeStorage != nullptr && bodyTokenizer.pairs() == 1)
         {
-            const char c = text[i];
-            if (c == '\n')
-            {
-                buf[currentChar] = 0;
-
-                if (keySet)
-                {
-                    findAndSet(key, buf);
-                    break;
-                }
+            attributeStorage->beginBatch();
+        }
 
-                key = (char*) malloc(currentChar+1);
-                strcpy(key, buf);
-                keySet = true;
+        findAndSet(key, value);
+        return false;
+    }
 
-                currentChar = 0;
-            }
-            else
-            {
-                buf[currentChar] = c;
-                currentChar++;
-            }
+    inline void abortAttributeBatch()
+    {
+        if (attributeStorage != nullptr)
+        {
+            attributeStorage->abort();
         }
+    }
 
-        if (key != nullptr)
+    inline void setAttribute()
+    {
+        if (attributeStorage != nullptr && !attributeStorage->commit())
         {
-            free(key);
+            server->send(500, "text/plain", "Failed to save the attribute.");
+            return;
         }
+
+        server->send(bodyTokenizer.pairs() == 0 ? 400 : 200);
     }
 
     inline void enableAttributesModule()
     {
-        addServerHandler((char*) "/config/attributes", HTTP_GET, getAttributes);
-        addServerHandler((char*) "/config/attributes", HTTP_POST, setAttribute);
+        enableRoutes(ATTRIBUTES);
     }
 }
 
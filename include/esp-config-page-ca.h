@@ -19,19 +19,6 @@ namespace ESP_CONFIG_PAGE
     uint8_t customActionsCount = 0;
     uint8_t maxCustomActions = 0;
 
-    inline int caSize()
-    {
-        int infoSize = 0;
-
-        for (uint8_t i = 0; i < customActionsCount; i++)
-        {
-            CustomAction* ca = customActions[i];
-            infoSize += strlen(ca->key) + 3;
-        }
-
-        return infoSize;
-    }
-
     inline void tiggerCustomAction()
     {
         if (customActionsCount == 0)
@@ -66,7 +53,8 @@ namespace ESP_CONFIG_PAGE
      * Adds a custom action to the webpage.
      *
      * @param key - name of the action, has to be unique for all added actions.
-     * @param handler - handler function for the action.
+     * @param handler - handler function for the action. Actions run by the scheduling module are called outside of any
+     * request, the handler must not read arguments from or answer with the server then.
      */
     inline void addCustomAction(const char *key, std::function<void(WEBSERVER_T& server)> handler)
     {
@@ -84,23 +72,18 @@ namespace ESP_CONFIG_PAGE
 
     inline void getCa()
     {
-        char buf[caSize()+1];
-        buf[0] = 0;
+        ResponseWriter writer;
 
         for (uint8_t i = 0; i < customActionsCount; i++)
         {
-            CustomAction* ca = customActions[i];
-            strcat(buf, ca->key);
-            strcat(buf, "\n");
+            writer.print(customActions[i]->key);
+            writer.print('\n');
         }
-
-        server->send(200, "text/plain", buf);
     }
 
     inline void enableCustomActionsModule()
     {
-        addServerHandler((char*) F("/config/customa"), HTTP_POST, tiggerCustomAction);
-      addServerHandler((char*) F("/config/customa"), HTTP_GET, getCa);
+        enableRoutes(ACTIONS);
     }
 }
 
@@ -0,0 +1,550 @@
+#ifndef ESP_CONFIG_PAGE_CACHE_STORAGE_H
+#define ESP_CONFIG_PAGE_CACHE_STORAGE_H
+
+#include "esp-config-defines.h"
+
+// Default time a changed key stays in RAM before it is written to the wrapped storage
+#ifndef ESP_CONP_KV_CACHE_FLUSH_MS
+#define ESP_CONP_KV_CACHE_FLUSH_MS 5000
+#endif
+
+namespace ESP_CONFIG_PAGE
+{
+    struct CacheStats
+    {
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t writes;
+        /**
+         * Writes that never reached the wrapped storage, because the key was written again before the flush or the value
+         * did not change.
+         */
+        uint32_t coalesced;
+        uint32_t flushes;
+        uint32_t flushedKeys;
+    };
+
+    /**
+     * Write-back cache for any KeyValueStorage. Values are served from RAM after the first recover, and saves only mark
+     * the key as changed, changed keys are written to the wrapped storage by loop() flushInterval milliseconds after the
+     * first change, on flush() or on ESP_CONFIG_PAGE::restart(). Good for values saved often, like attributes set from a
+     * sensor loop, every key read or written stays in RAM.
+     *
+     * Writes still in RAM are lost on a power loss or a reset that does not go through ESP_CONFIG_PAGE::restart().
+     * The wrapped storage is not deleted with the cache.
+     */
+    class CachingKeyValueStorage : public KeyValueStorage, public ConfigPageModule
+    {
+    public:
+        /**
+         * @param storage Storage to cache.
+         * @param flushInterval Milliseconds between the first unsaved change and the flush.
+         */
+        explicit CachingKeyValueStorage(KeyValueStorage *storage, unsigned long flushInterval = ESP_CONP_KV_CACHE_FLUSH_MS) :
+            storage(storage), flushInterval(flushInterval)
+        {
+            registerModule(this);
+        }
+
+        ~CachingKeyValueStorage() override
+        {
+            if (!batchOpen)
+            {
+                flush();
+            }
+            unregisterModule(this);
+
+            for (size_t i = 0; i < entryCount; i++)
+            {
+                free(entries[i].key);
+                free(entries[i].value);
+                free(entries[i].staged);
+            }
+            free(entries);
+        }
+
+        void save(const char *key, const char *value) override
+        {
+            cacheStats.writes++;
+
+            CacheEntry *entry = findEntry(key, false);
+            if (entry == nullptr)
+            {
+                saveUncached(key, value);
+                return;
+            }
+
+            if (batchOpen)
+            {
+                stage(*entry, value);
+                return;
+            }
+
+            if ((entry->flags & ENTRY_DIRTY) != 0 || (entry->value != nullptr && strcmp(entry->value, value) == 0))
+            {
+                cacheStats.coalesced++;
+            }
+
+            if (entry->value == nullptr || strcmp(entry->value, value) != 0)
+            {
+                char *newValue = (char*) realloc(entry->value, strlen(value) + 1);
+                if (newValue == nullptr)
+                {
+                    LOGF("Memory allocation failed for cached value of %s, saving directly.\n", key);
+                    flushEntry(*entry);
+                    storage->save(key, value);
+                    free(entry->value);
+                    entry->value = nullptr;
+                    entry->flags &= ~ENTRY_LOADED;
+                    return;
+                }
+
+                strcpy(newValue, value);
+                entry->value = newValue;
+                markDirty(*entry);
+            }
+        }
+
+        char* recover(const char *key) override
+        {
+            CacheEntry *entry = findEntry(key, true);
+            if (entry == nullptr)
+            {
+                return storage->recover(key);
+            }
+
+            if (entry->value == nullptr)
+            {
+                return nullptr;
+            }
+
+            char *ret = (char*) malloc(strlen(entry->value) + 1);
+            if (ret != nullptr)
+            {
+                strcpy(ret, entry->value);
+            }
+            return ret;
+        }
+
+        size_t recover(const char *key, char *out, size_t outSize) override
+        {
+            CacheEntry *entry = findEntry(key, true);
+            if (entry == nullptr)
+            {
+                return storage->recover(key, out, outSize);
+            }
+
+            memset(out, 0, outSize);
+            if (entry->value == nullptr || outSize == 0)
+            {
+                return 0;
+            }
+
+            strncpy(out, entry->value, outSize - 1);
+            return strlen(out);
+        }
+
+        /**
+         * Flushes the changed keys first and iterates the wrapped storage, keys changed in an open batch are visited with
+         * their value from before it.
+         */
+        void doForEachKey(std::function<bool(const char *key, const char *value)> fn, const size_t maxValueSize) override
+        {
+            if (!batchOpen)
+            {
+                flush();
+            }
+            storage->doForEachKey(fn, maxValueSize);
+        }
+
+        /**
+         * Flushes the changed keys when the iteration starts and walks the keys of the wrapped storage.
+         */
+        bool nextKey(size_t &cursor, char *key, size_t keySize) override
+        {
+            if (cursor == 0 && !batchOpen)
+            {
+                flush();
+            }
+            return storage->nextKey(cursor, key, keySize);
+        }
+
+        void endIteration() override
+        {
+            storage->endIteration();
+        }
+
+        /**
+         * Reads from RAM when the key is cached, without caching it otherwise.
+         */
+        size_t readValue(const char *key, size_t offset, char *out, size_t outSize, size_t *valueLength = nullptr) override
+        {
+            const CacheEntry *entry = findLoaded(key);
+            if (entry == nullptr)
+            {
+                return storage->readValue(key, offset, out, outSize, valueLength);
+            }
+
+            cacheStats.hits++;
+            return copyValueChunk(entry->value, entry->value != nullptr ? strlen(entry->value) : 0, offset, out, outSize, valueLength);
+        }
+
+        bool exists(const char *key) override
+        {
+            CacheEntry *entry = findEntry(key, true);
+            return entry == nullptr ? storage->exists(key) : entry->value != nullptr;
+        }
+
+        void remove(const char *key) override
+        {
+            cacheStats.writes++;
+
+            CacheEntry *entry = findEntry(key, false);
+            if (entry == nullptr)
+            {
+                saveUncached(key, nullptr);
+                return;
+            }
+
+            if (batchOpen)
+            {
+                stage(*entry, nullptr);
+                return;
+            }
+
+            if ((entry->flags & ENTRY_DIRTY) != 0 || ((entry->flags & ENTRY_LOADED) != 0 && entry->value == nullptr))
+            {
+                cacheStats.coalesced++;
+            }
+
+            free(entry->value);
+            entry->value = nullptr;
+            markDirty(*entry);
+        }
+
+        /**
+         * Flushes the changed keys first, the saves and removes of the batch are then kept aside in RAM, recover still
+         * returns the values from before it, until commit() writes them as one batch of the wrapped storage.
+         */
+        void beginBatch() override
+        {
+            if (!batchOpen)
+            {
+                flush();
+            }
+            batchOpen = true;
+            batchFailed = false;
+        }
+
+        /**
+         * @return false if a change of the batch could not be kept in RAM or written, nothing of it is applied then.
+         */
+        bool commit() override
+        {
+            if (batchFailed)
+            {
+                abort();
+                return false;
+            }
+
+            batchOpen = false;
+            for (size_t i = 0; i < entryCount; i++)
+            {
+                CacheEntry &entry = entries[i];
+                if ((entry.flags & ENTRY_STAGED) == 0)
+                {
+                    continue;
+                }
+
+                free(entry.value);
+                entry.value = entry.staged;
+                entry.staged = nullptr;
+                entry.flags &= ~ENTRY_STAGED;
+                markDirty(entry);
+            }
+            return flush();
+        }
+
+        void abort() override
+        {
+            batchOpen = false;
+            batchFailed = false;
+            for (size_t i = 0; i < entryCount; i++)
+            {
+                free(entries[i].staged);
+                entries[i].staged = nullptr;
+                entries[i].flags &= ~ENTRY_STAGED;
+            }
+        }
+
+        /**
+         * Writes every changed key to the wrapped storage now, in one batch.
+         * @return false if the wrapped storage could not commit the batch, the cached values are reloaded from it then.
+         */
+        bool flush()
+        {
+            if (dirtyCount == 0)
+            {
+                return true;
+            }
+
+            storage->beginBatch();
+            for (size_t i = 0; i < entryCount && dirtyCount > 0; i++)
+            {
+                flushEntry(entries[i]);
+            }
+
+            cacheStats.flushes++;
+            if (storage->commit())
+            {
+                return true;
+            }
+
+            LOGN("Failed to flush key value cache, dropping the cached values.");
+            for (size_t i = 0; i < entryCount; i++)
+            {
+                unload(entries[i]);
+            }
+            return false;
+        }
+
+        const CacheStats &getCacheStats() const
+        {
+            return cacheStats;
+        }
+
+        size_t dirtyKeys() const
+        {
+            return dirtyCount;
+        }
+
+        const char *name() const override
+        {
+            return "kv-cache";
+        }
+
+        void tick(unsigned long now) override
+        {
+            flush();
+        }
+
+        unsigned long nextDeadline(unsigned long now) override
+        {
+            return dirtyCount > 0 && !batchOpen ? firstDirtyAt + flushInterval : now + MODULE_IDLE_MS;
+        }
+
+        /**
+         * Flushes the changes, an open batch is dropped like the restart came before it.
+         */
+        void beforeRestart() override
+        {
+            if (batchOpen)
+            {
+                abort();
+            }
+            flush();
+        }
+
+    private:
+        // The value is in RAM, nullptr values are keys known to be missing or removed
+        static constexpr uint8_t ENTRY_LOADED = 1;
+        static constexpr uint8_t ENTRY_DIRTY = 2;
+        // Saved or removed in the open batch, staged is the new value or nullptr for a remove
+        static constexpr uint8_t ENTRY_STAGED = 4;
+
+        struct CacheEntry
+        {
+            uint32_t hash;
+            char *key;
+            char *value;
+            char *staged;
+            uint8_t flags;
+        };
+
+        KeyValueStorage *storage;
+        const unsigned long flushInterval;
+        CacheEntry *entries = nullptr;
+        size_t entryCount = 0;
+        size_t maxEntries = 0;
+        size_t dirtyCount = 0;
+        unsigned long firstDirtyAt = 0;
+        // A change of the open batch was lost to a failed allocation
+        bool batchFailed = false;
+        CacheStats cacheStats{};
+
+        /**
+         * Saves, or removes for nullptr, a key there is no memory to cache straight to the wrapped storage. In a batch it
+         * can't be written without breaking the batch, which fails instead.
+         */
+        void saveUncached(const char *key, const char *value)
+        {
+            if (batchOpen)
+            {
+                LOGF("Allocation failed for cache entry of %s, the batch will not be applied.\n", key);
+                batchFailed = true;
+                return;
+            }
+
+            LOGF("Allocation failed for cache entry of %s, writing it directly.\n", key);
+            if (value != nullptr)
+            {
+                storage->save(key, value);
+            }
+            else
+            {
+                storage->remove(key);
+            }
+        }
+
+        void stage(CacheEntry &entry, const char *value)
+        {
+            char *copy = nullptr;
+            if (value != nullptr)
+            {
+                copy = (char*) malloc(strlen(value) + 1);
+                if (copy == nullptr)
+                {
+                    LOGF("Allocation failed for batch value of %s, the batch will not be applied.\n", entry.key);
+                    batchFailed = true;
+                    return;
+                }
+                strcpy(copy, value);
+            }
+
+            free(entry.staged);
+            entry.staged = copy;
+            entry.flags |= ENTRY_STAGED;
+        }
+
+        /**
+         * Entry of the key, added if it is not cached yet and loaded from the wrapped storage when load is true.
+         * @return the entry or nullptr if there is no memory for it.
+         */
+        CacheEntry *findEntry(const char *key, bool load)
+        {
+            const uint32_t hash = fnv1aHash(key, strlen(key));
+            for (size_t i = 0; i < entryCount; i++)
+            {
+                CacheEntry &entry = entries[i];
+                if (entry.hash == hash && strcmp(entry.key, key) == 0)
+                {
+                    if (load && (entry.flags & ENTRY_LOADED) == 0)
+                    {
+                        cacheStats.misses++;
+                        loadEntry(entry);
+                    }
+                    else if (load)
+                    {
+                        cacheStats.hits++;
+                    }
+                    return &entry;
+                }
+            }
+
+            if (entryCount + 1 > maxEntries)
+            {
+                const size_t newMax = maxEntries == 0 ? 4 : ceil(maxEntries * 1.5);
+                auto *newEntries = (CacheEntry*) realloc(entries, newMax * sizeof(CacheEntry));
+                if (newEntries == nullptr)
+                {
+                    LOGN("Memory allocation failed for key value cache.");
+                    if (load)
+                    {
+                        cacheStats.misses++;
+                    }
+                    return nullptr;
+                }
+
+                entries = newEntries;
+                maxEntries = newMax;
+            }
+
+            char *keyCopy = (char*) malloc(strlen(key) + 1);
+            if (keyCopy == nullptr)
+            {
+                return nullptr;
+            }
+            strcpy(keyCopy, key);
+
+            CacheEntry &entry = entries[entryCount++];
+            entry.hash = hash;
+            entry.key = keyCopy;
+            entry.value = nullptr;
+            entry.staged = nullptr;
+            entry.flags = 0;
+
+            if (load)
+            {
+                cacheStats.misses++;
+                loadEntry(entry);
+            }
+            return &entry;
+        }
+
+        const CacheEntry *findLoaded(const char *key) const
+        {
+            const uint32_t hash = fnv1aHash(key, strlen(key));
+            for (size_t i = 0; i < entryCount; i++)
+            {
+                const CacheEntry &entry = entries[i];
+                if (entry.hash == hash && (entry.flags & ENTRY_LOADED) != 0 && strcmp(entry.key, key) == 0)
+                {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        void unload(CacheEntry &entry)
+        {
+            free(entry.value);
+            entry.value = nullptr;
+            entry.flags &= ENTRY_STAGED;
+        }
+
+        void loadEntry(CacheEntry &entry)
+        {
+            entry.value = storage->recover(entry.key);
+            entry.flags |= ENTRY_LOADED;
+        }
+
+        void markDirty(CacheEntry &entry)
+        {
+            entry.flags |= ENTRY_LOADED;
+            if ((entry.flags & ENTRY_DIRTY) != 0)
+            {
+                return;
+            }
+
+            entry.flags |= ENTRY_DIRTY;
+            if (dirtyCount++ == 0)
+            {
+                firstDirtyAt = millis();
+                wakeModules();
+            }
+        }
+
+        void flushEntry(CacheEntry &entry)
+        {
+            if ((entry.flags & ENTRY_DIRTY) == 0)
+            {
+                return;
+            }
+
+            if (entry.value != nullptr)
+            {
+                storage->save(entry.key, entry.value);
+            }
+            else
+            {
+                storage->remove(entry.key);
+            }
+
+            entry.flags &= ~ENTRY_DIRTY;
+            dirtyCount--;
+            cacheStats.flushedKeys++;
+        }
+    };
+}
+
+#endif //ESP_CONFIG_PAGE_CACHE_STORAGE_H
@@ -15,66 +15,353 @@ namespace ESP_CONFIG_PAGE
         /**
          * @param key - environment variable name and search key, should be unique between all environment variables.
          */
-        EnvVar(const char *key)
-        {
-            EnvVar(key, nullptr);
-        };
+        EnvVar(const char *key) : EnvVar(key, nullptr) {}
 
         /**
          * @param key - environment variable name and search key, should be unique between all environment variables.
          * @param value - initial value for the environment variable.
          */
         EnvVar(const char *key, char *value) : key(key), value(value){}
+
+        ~EnvVar()
+        {
+            stringPool.release(valueHandle);
+        }
+
+        // The string pool keeps the address of value, a copy would not be updated when it moves
+        EnvVar(const EnvVar &) = delete;
+        EnvVar &operator=(const EnvVar &) = delete;
+
+        /**
+         * Value of the variable, with RESTORE_LAZY it is read from the storage on the first call, use this instead of
+         * value then.
+         */
+        char *getValue();
+
+        /**
+         * Value as a number or boolean, parsed once per value so it can be read in a loop. Change the value with
+         * setValue(), changing the characters of value in place is not seen.
+         * @return defaultValue when there is no value or it is not a number.
+         */
+        long getInt(long defaultValue = 0);
+        float getFloat(float defaultValue = 0);
+
+        /**
+         * true for "true", "t", "yes", "on" and non-zero numbers, false for "false", "f", "no", "off" and 0.
+         */
+        bool getBool(bool defaultValue = false);
+
+        /**
+         * Copies newValue into the string pool as the value in RAM, without saving it. The pool may move the copy, value
+         * is updated when it does, so read value again instead of keeping the pointer.
+         * @return false if there is no memory for it, the value is not changed then.
+         */
+        bool setValue(const char *newValue);
+
+        /**
+         * Drops the value in RAM, without removing it from the storage.
+         */
+        void clear();
+
         const char *key;
         char *value;
+        // Not read from the storage yet
+        bool pending = false;
+
+        /**
+         * Called after a save from the page changed the value, the new value is already in value.
+         */
+        void (*onChange)(EnvVar *var) = nullptr;
+
+        /**
+         * Restart the board when a save from the page changes this variable, for values only read in setup().
+         */
+        bool requiresRestart = false;
+
+        // Saved in the open batch, applied to value once the batch is committed
+        char *stagedValue = nullptr;
+
+    private:
+        static constexpr uint8_t PARSED_INT = 1;
+        static constexpr uint8_t PARSED_FLOAT = 2;
+        static constexpr uint8_t PARSED_BOOL = 4;
+
+        // Value the numbers below were parsed from, nullptr after setValue() so a new value parses again even when the
+        // pool moves it where the old one was
+        const char *parsedValue = nullptr;
+        uint8_t parsedFlags = 0;
+        long intValue = 0;
+        float floatValue = 0;
+        bool boolValue = false;
+        // Handle of value in stringPool, STRING_POOL_NONE when value is not from the pool
+        uint16_t valueHandle = STRING_POOL_NONE;
+
+        void parse();
+    };
+
+    /**
+     * Key of an env var with its hash, declare it constexpr so the hash is computed at compile time:
+     * constexpr ESP_CONFIG_PAGE::EnvKey MQTT_PORT("MQTT_PORT");
+     */
+    struct EnvKey
+    {
+        constexpr EnvKey(const char *key) : key(key), hash(fnv1aHash(key)) {}
+
+        const char *key;
+        uint32_t hash;
     };
 
     EnvVar** envVars;
     uint8_t envVarCount = 0;
     uint8_t maxEnvVars = 0;
     KeyValueStorage* envVarStorage = nullptr;
+    // A value of the body being saved could not be kept, saveEnv answers with an error
+    bool envSaveFailed = false;
+
+    // Open addressing table of envVars positions + 1 by key hash, 0 is an empty slot, at most half full
+    uint8_t *envVarIndex = nullptr;
+    uint16_t envVarIndexCapacity = 0;
 
-    inline int envSize()
+    inline void restoreEnvVar(EnvVar *var)
     {
-        int infoSize = 0;
+        var->pending = false;
+        char *value = envVarStorage->recover(var->key);
+        if (value == nullptr)
+        {
+            LOGF("Variable %s not found in storage, skipping.\n", var->key);
+            return;
+        }
 
-        for (uint8_t i = 0; i < envVarCount; i++)
+        var->setValue(value);
+        free(value);
+    }
+
+    inline bool EnvVar::setValue(const char *newValue)
+    {
+        if (valueHandle != STRING_POOL_NONE && newValue == value)
         {
-            EnvVar* ev = envVars[i];
-            infoSize += 6 + strlen(ev->key) + (ev->value != nullptr ? strlen(ev->value) : 0);
+            return true;
+        }
+
+        const uint16_t handle = stringPool.add(newValue, &value);
+        if (handle == STRING_POOL_NONE)
+        {
+            return false;
+        }
+
+        stringPool.release(valueHandle);
+        valueHandle = handle;
+        parsedValue = nullptr;
+        return true;
+    }
+
+    inline void EnvVar::clear()
+    {
+        stringPool.release(valueHandle);
+        valueHandle = STRING_POOL_NONE;
+        value = nullptr;
+        parsedValue = nullptr;
+    }
+
+    inline char *EnvVar::getValue()
+    {
+        if (pending && envVarStorage != nullptr)
+        {
+            ESP_CONP_MEASURE(envRestoreLatency);
+            restoreEnvVar(this);
+        }
+        return value;
+    }
+
+    inline void EnvVar::parse()
+    {
+        const char *current = getValue();
+        if (current == parsedValue && current != nullptr)
+        {
+            return;
+        }
+
+        parsedValue = current;
+        parsedFlags = 0;
+        if (current == nullptr || current[0] == 0)
+        {
+            return;
+        }
+
+        char *end;
+        intValue = strtol(current, &end, 10);
+        if (*end == 0)
+        {
+            parsedFlags |= PARSED_INT;
+        }
+
+        floatValue = strtof(current, &end);
+        if (*end == 0)
+        {
+            parsedFlags |= PARSED_FLOAT;
+        }
+
+        if (strcasecmp(current, "true") == 0 || strcasecmp(current, "t") == 0 || strcasecmp(current, "yes") == 0 ||
+            strcasecmp(current, "on") == 0)
+        {
+            boolValue = true;
+            parsedFlags |= PARSED_BOOL;
+        }
+        else if (strcasecmp(current, "false") == 0 || strcasecmp(current, "f") == 0 || strcasecmp(current, "no") == 0 ||
+            strcasecmp(current, "off") == 0)
+        {
+            boolValue = false;
+            parsedFlags |= PARSED_BOOL;
+        }
+        else if ((parsedFlags & PARSED_FLOAT) != 0)
+        {
+            boolValue = floatValue != 0;
+            parsedFlags |= PARSED_BOOL;
+        }
+    }
+
+    inline long EnvVar::getInt(long defaultValue)
+    {
+        parse();
+        return (parsedFlags & PARSED_INT) != 0 ? intValue : defaultValue;
+    }
+
+    inline float EnvVar::getFloat(float defaultValue)
+    {
+        parse();
+        return (parsedFlags & PARSED_FLOAT) != 0 ? floatValue : defaultValue;
+    }
+
+    inline bool EnvVar::getBool(bool defaultValue)
+    {
+        parse();
+        return (parsedFlags & PARSED_BOOL) != 0 ? boolValue : defaultValue;
+    }
+
+    inline void indexEnvVar(uint8_t position)
+    {
+        if (envVars[position] == nullptr)
+        {
+            return;
+        }
+
+        const uint16_t mask = envVarIndexCapacity - 1;
+        for (uint16_t slot = fnv1aHash(envVars[position]->key) & mask;; slot = (slot + 1) & mask)
+        {
+            if (envVarIndex[slot] == 0)
+            {
+                envVarIndex[slot] = position + 1;
+                return;
+            }
+        }
+    }
+
+    /**
+     * Finds a variable added with addEnvVar, one hash probe instead of comparing every key.
+     * @return the variable or nullptr if there is none with the key.
+     */
+    inline EnvVar *findEnvVar(const EnvKey &key)
+    {
+        if (envVarIndexCapacity == 0)
+        {
+            return nullptr;
         }
 
-        return infoSize;
+        const uint16_t mask = envVarIndexCapacity - 1;
+        for (uint16_t slot = key.hash & mask; envVarIndex[slot] != 0; slot = (slot + 1) & mask)
+        {
+            EnvVar *var = envVars[envVarIndex[slot] - 1];
+            if (var->key == key.key || strcmp(var->key, key.key) == 0)
+            {
+                return var;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Value of the variable with the key, see EnvVar::getValue.
+     * @return the value or defaultValue if the variable does not exist or has no value.
+     */
+    inline const char *envString(const EnvKey &key, const char *defaultValue = nullptr)
+    {
+        EnvVar *var = findEnvVar(key);
+        const char *value = var != nullptr ? var->getValue() : nullptr;
+        return value != nullptr ? value : defaultValue;
+    }
+
+    inline long envInt(const EnvKey &key, long defaultValue = 0)
+    {
+        EnvVar *var = findEnvVar(key);
+        return var != nullptr ? var->getInt(defaultValue) : defaultValue;
+    }
+
+    inline float envFloat(const EnvKey &key, float defaultValue = 0)
+    {
+        EnvVar *var = findEnvVar(key);
+        return var != nullptr ? var->getFloat(defaultValue) : defaultValue;
+    }
+
+    inline bool envBool(const EnvKey &key, bool defaultValue = false)
+    {
+        EnvVar *var = findEnvVar(key);
+        return var != nullptr ? var->getBool(defaultValue) : defaultValue;
     }
 
     /**
      * Set the type persistent environment variables storage for the library, as well as use the instance to recover any saved variables (if there are any).
      *
      * @param storage - storage instance for environment variables. Default for this libraty is LittleFSEnvVarStorage, but can be any subclass of EnvVarStorage.
+     * @param mode - RESTORE_EACH recovers every variable now, RESTORE_SCAN reads the saved keys in one pass, which is
+     * faster when few of the variables were saved, and RESTORE_LAZY reads each variable on its first getValue().
      */
-    inline void setAndUpdateEnvVarStorage(KeyValueStorage* storage)
+    inline void setAndUpdateEnvVarStorage(KeyValueStorage* storage, RestoreMode mode = RESTORE_EACH)
     {
         envVarStorage = storage;
 
-        if (envVarStorage != nullptr)
+        if (envVarStorage == nullptr)
+        {
+            return;
+        }
+
+        ESP_CONP_MEASURE(envRestoreLatency);
+        LOGN("Recovering env vars from storage.");
+        for (uint8_t i = 0; i < envVarCount; i++)
+        {
+            EnvVar *var = envVars[i];
+            if (var == nullptr)
+            {
+                continue;
+            }
+
+            var->pending = mode != RESTORE_EACH;
+            if (mode == RESTORE_EACH)
+            {
+                restoreEnvVar(var);
+            }
+        }
+
+        if (mode != RESTORE_SCAN)
+        {
+            return;
+        }
+
+        envVarStorage->doForEachKeyOnly([](const char *key)
+        {
+            EnvVar *var = findEnvVar(key);
+            if (var != nullptr && var->pending)
+            {
+                restoreEnvVar(var);
+            }
+            return true;
+        });
+
+        for (uint8_t i = 0; i < envVarCount; i++)
         {
-            LOGN("Recovering env vars from storage.");
-            for (uint8_t i = 0; i < envVarCount; i++)
+            if (envVars[i] != nullptr)
             {
-                EnvVar *var = envVars[i];
-                if (var == nullptr)
-                {
-                    continue;
-                }
-
-                char *value = envVarStorage->recover(var->key);
-                if (value == nullptr)
-                {
-                    LOGF("Variable %s not found in storage, skipping.\n", var->key);
-                    continue;
-                }
-
-                var->value = value;
+                envVars[i]->pending = false;
             }
         }
     }
@@ -97,75 +384,180 @@ namespace ESP_CONFIG_PAGE
 
         envVars[envVarCount] = ev;
         envVarCount++;
+
+        if (envVarCount * 2 > envVarIndexCapacity)
+        {
+            const uint16_t newCapacity = envVarIndexCapacity == 0 ? 8 : envVarIndexCapacity * 2;
+            auto *newIndex = (uint8_t*) realloc(envVarIndex, newCapacity);
+            if (newIndex == nullptr)
+            {
+                LOGN("Memory allocation failed for env var index.");
+                return;
+            }
+
+            envVarIndex = newIndex;
+            envVarIndexCapacity = newCapacity;
+            memset(envVarIndex, 0, envVarIndexCapacity);
+            for (uint8_t i = 0; i < envVarCount - 1; i++)
+            {
+                indexEnvVar(i);
+            }
+        }
+
+        indexEnvVar(envVarCount - 1);
     }
 
-    inline void saveEnv()
+    inline bool saveEnvPair(char *key, size_t keyLength, char *value, size_t valueLength)
     {
-        if (envVarCount == 0)
+        // The whole body is saved as one batch, committed by saveEnv
+        if (bodyTokenizer.pairs() == 1)
         {
-            server->send(200);
-            return;
+            envSaveFailed = false;
+            if (envVarStorage != nullptr)
+            {
+                envVarStorage->beginBatch();
+            }
         }
 
-        String body = server->arg("plain");
+        EnvVar *var = findEnvVar(key);
+        if (var == nullptr)
+        {
+            return true;
+        }
 
-        unsigned int maxLineLength = getMaxLineLength(body.c_str()) + 1;
-        char buf[maxLineLength];
-        unsigned int currentChar = 0;
-        unsigned int bodyLen = body.length();
+        // Unchanged variables are not written again
+        const char *current = var->getValue();
+        if (current != nullptr && strcmp(current, value) == 0)
+        {
+            return true;
+        }
 
-        char currentKey[maxLineLength];
-        bool isKey = true;
+        char *staged = (char*) malloc(strlen(value) + 1);
+        if (staged == nullptr)
+        {
+            // Nothing of the body is saved then, saveEnv answers with an error
+            LOGF("Memory allocation failed for the new value of %s.\n", key);
+            envSaveFailed = true;
+            return false;
+        }
+        strcpy(staged, value);
 
-        for (unsigned int i = 0; i < bodyLen; i++)
+        free(var->stagedValue);
+        var->stagedValue = staged;
+        if (envVarStorage != nullptr)
         {
-            char c = body[i];
+            envVarStorage->save(key, value);
+        }
+
+        return true;
+    }
+
+    inline void discardStagedEnvValues()
+    {
+        for (uint8_t i = 0; i < envVarCount; i++)
+        {
+            if (envVars[i] != nullptr)
+            {
+                free(envVars[i]->stagedValue);
+                envVars[i]->stagedValue = nullptr;
+            }
+        }
+    }
+
+    /**
+     * Drops the batch of a body that is not saved, with the values staged for it.
+     */
+    inline void abortEnvBatch()
+    {
+        envSaveFailed = false;
+        if (envVarStorage != nullptr)
+        {
+            envVarStorage->abort();
+        }
+        discardStagedEnvValues();
+    }
 
-            if (c == '\n')
+    /**
+     * Moves the saved values into the variables and calls their onChange, variables whose value could not be copied
+     * keep the old one and are not notified.
+     * @return true if a changed variable requires a restart, or could only be applied by restarting.
+     */
+    inline bool applyStagedEnvValues()
+    {
+        bool restartNeeded = false;
+        for (uint8_t i = 0; i < envVarCount; i++)
+        {
+            EnvVar *var = envVars[i];
+            if (var == nullptr || var->stagedValue == nullptr)
             {
-                buf[currentChar] = 0;
-
-                if (isKey)
-                {
-                    strcpy(currentKey, buf);
-                }
-                else
-                {
-                    for (uint8_t j = 0; j < envVarCount; j++)
-                    {
-                        EnvVar *var = envVars[j];
-                        if (var != nullptr && strcmp(var->key, currentKey))
-                        {
-                            envVarStorage->save(currentKey, buf);
-                            break;
-                        }
-                    }
-                }
-
-                isKey = !isKey;
-                currentChar = 0;
+                continue;
             }
-            else
+
+            LOGF("Env var %s changed.\n", var->key);
+            const bool applied = var->setValue(var->stagedValue);
+            free(var->stagedValue);
+            var->stagedValue = nullptr;
+
+            if (!applied)
             {
-                buf[currentChar] = c;
-                currentChar++;
+                // The storage has the new value, a restart reads it back
+                LOGF("No memory for the new value of %s, it is applied after a restart.\n", var->key);
+                restartNeeded = restartNeeded || envVarStorage != nullptr;
+                continue;
             }
+
+            restartNeeded = restartNeeded || var->requiresRestart;
+
+            if (var->onChange != nullptr)
+            {
+                var->onChange(var);
+            }
+        }
+
+        return restartNeeded;
+    }
+
+    /**
+     * Answers once the values are saved, then updates the variables in place. The board only restarts when a changed
+     * variable has requiresRestart set.
+     */
+    inline void saveEnv()
+    {
+        if (bodyTokenizer.overflow())
+        {
+            abortEnvBatch();
+            server->send(413);
+            return;
+        }
+
+        if (envSaveFailed)
+        {
+            abortEnvBatch();
+            server->send(500, "text/plain", "Out of memory for the variables.");
+            return;
+        }
+
+        if (envVarStorage != nullptr && !envVarStorage->commit())
+        {
+            discardStagedEnvValues();
+            server->send(500, "text/plain", "Failed to save the variables.");
+            return;
         }
 
         server->send(200);
+        if (!applyStagedEnvValues())
+        {
+            return;
+        }
+
         delay(200);
 
-#ifdef ESP32
-        ESP.restart();
-#elif ESP8266
-        ESP.reset();
-#endif
+        restart();
     }
 
     inline void getEnv()
     {
-        char buf[envSize()+1];
-        buf[0] = 0;
+        ResponseWriter writer;
 
         for (uint8_t i = 0; i < envVarCount; i++)
         {
@@ -176,24 +568,22 @@ namespace ESP_CONFIG_PAGE
                 continue;
             }
 
-            strcat(buf, ev->key);
-            strcat(buf, "\n");
+            writer.print(ev->key);
+            writer.print('\n');
 
-            if (ev->value != nullptr)
+            const char *value = ev->getValue();
+            if (value != nullptr)
             {
-                strcat(buf, ev->value);
+                writer.print(value);
             }
 
-            strcat(buf, "\n");
+            writer.print('\n');
         }
-
-        server->send(200, "text/plain", buf);
     }
 
     inline void enableEnvModule()
     {
-        addServerHandler((char*) F("/config/save"), HTTP_POST, saveEnv);
-        addServerHandler((char*) F("/config/env"), HTTP_GET, getEnv);
+        enableRoutes(ENVIRONMENT);
     }
 }
 
@@ -15,31 +15,30 @@ namespace ESP_CONFIG_PAGE
             path = "/";
         }
 
-        String ret;
+        ResponseWriter writer;
 
 #ifdef ESP32
         File file = LittleFS.open(path);
         File nextFile;
         while (file.isDirectory() && (nextFile = file.openNextFile()))
         {
-            ret += String(nextFile.name()) + ":" + (nextFile.isDirectory() ? "true" : "false") + ":" + nextFile.
-                size() + ";";
-
-            if (nextFile)
-            {
-                nextFile.close();
-            }
+            writer.print(nextFile.name());
+            writer.print(nextFile.isDirectory() ? ":true:" : ":false:");
+            writer.print((unsigned long) nextFile.size());
+            writer.print(';');
+            nextFile.close();
         }
 
         file.close();
 #elif ESP8266
         Dir dir = LittleFS.openDir(path);
         while (dir.next()) {
-            ret += dir.fileName() + ":" + (dir.isDirectory() ? "true" : "false") + ":" + dir.fileSize() + ";";
+            writer.print(dir.fileName());
+            writer.print(dir.isDirectory() ? ":true:" : ":false:");
+            writer.print((unsigned long) dir.fileSize());
+            writer.print(';');
         }
 #endif
-
-        server->send(200, "text/plain", ret);
     }
 
     inline void downloadFile()
@@ -101,9 +100,7 @@ namespace ESP_CONFIG_PAGE
         LittleFS.begin();
 #endif
 
-        addServerHandler((char*) F("/config/files"), HTTP_POST, getFiles);
-        addServerHandler((char*) F("/config/files/download"), HTTP_POST, downloadFile);
-        addServerHandler((char*) F("/config/files/delete"), HTTP_POST, deleteFile);
+        enableRoutes(FILES);
     }
 }
 
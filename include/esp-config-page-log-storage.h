@@ -0,0 +1,941 @@
+#ifndef ESP_CONFIG_PAGE_LOG_STORAGE_H
+#define ESP_CONFIG_PAGE_LOG_STORAGE_H
+
+#include "esp-config-defines.h"
+
+// Log files smaller than this are never compacted
+#ifndef ESP_CONP_LOG_KV_COMPACT_MIN
+#define ESP_CONP_LOG_KV_COMPACT_MIN 4096
+#endif
+
+// Records copied by each background compaction tick
+#ifndef ESP_CONP_LOG_KV_COMPACT_STEP
+#define ESP_CONP_LOG_KV_COMPACT_STEP 8
+#endif
+
+namespace ESP_CONFIG_PAGE
+{
+    constexpr uint8_t LOG_KV_MAGIC = 0xA5;
+    constexpr uint8_t LOG_KV_PUT = 1;
+    constexpr uint8_t LOG_KV_DELETE = 2;
+    // Ends a batch, its records are only applied once this is in the log
+    constexpr uint8_t LOG_KV_COMMIT = 3;
+    constexpr uint8_t LOG_KV_ABORT = 4;
+    // Flag of the puts and deletes written inside a batch
+    constexpr uint8_t LOG_KV_BATCH = 0x80;
+    // magic, flags, key length, value length (2), sequence (4), crc (4)
+    constexpr uint8_t LOG_KV_HEADER_SIZE = 13;
+    constexpr uint8_t LOG_KV_CRC_OFFSET = 9;
+
+    inline uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len)
+    {
+        crc = ~crc;
+        while (len-- > 0)
+        {
+            crc ^= *data++;
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+            }
+        }
+        return ~crc;
+    }
+
+    /**
+     * CRC of a record header, the batch flag is left out so compaction can clear it without computing the CRC again.
+     */
+    inline uint32_t logRecordHeaderCrc(const uint8_t *header)
+    {
+        uint8_t covered[LOG_KV_CRC_OFFSET];
+        memcpy(covered, header, LOG_KV_CRC_OFFSET);
+        covered[1] &= ~LOG_KV_BATCH;
+        return crc32Update(0, covered, LOG_KV_CRC_OFFSET);
+    }
+
+    /**
+     * KeyValueStorage that appends every save and remove as a record (key, value, sequence and CRC) to a single LittleFS
+     * file and keeps a hash index of the latest record of each key in RAM, so a save is one append and a recover is one
+     * read, without the per key file opens of LittleFSKeyValueStorage.
+     *
+     * The log is compacted in the background by loop() once more than half of it is overwritten records, the live
+     * records are copied to "<path>.tmp" a few at a time and the copy replaces the log when done. On boot the log is
+     * scanned and stops at the first record with a bad CRC, so a save cut by a power loss is dropped and the log is
+     * rewritten without it.
+     *
+     * Batches are appended with a flag and applied when their commit record is read, a batch cut by a power loss is
+     * dropped like a torn record, and the whole batch is flushed to flash once.
+     *
+     * Keys are up to 255 characters and values up to 65535.
+     */
+    class LogKeyValueStorage : public KeyValueStorage, public ConfigPageModule
+    {
+    public:
+        /**
+         * Instantiate storage.
+         * @param filePath Path of the log file.
+         */
+        explicit LogKeyValueStorage(const char *filePath)
+        {
+            mountLittleFS();
+
+            path = (char*) malloc(strlen(filePath) + 1);
+            strcpy(path, filePath);
+            tmpPath = (char*) malloc(strlen(filePath) + 5);
+            sprintf(tmpPath, "%s.tmp", filePath);
+            LOGF("Key value log path: %s\n", path);
+
+            openLog();
+            registerModule(this);
+        }
+
+        ~LogKeyValueStorage() override
+        {
+            unregisterModule(this);
+            cancelCompaction();
+            file.close();
+            free(index);
+            free(path);
+            free(tmpPath);
+        }
+
+        void save(const char *key, const char *value) override
+        {
+            ESP_CONP_MEASURE(flashWriteLatency);
+            const size_t keyLen = strlen(key);
+            const size_t valueLen = strlen(value);
+            if (keyLen == 0 || keyLen > UINT8_MAX || valueLen > UINT16_MAX)
+            {
+                LOGF("Key %s or its value is too long for the key value log.\n", key);
+                return;
+            }
+
+            LOGF("Saving value for key %s in log %s.\n", key, path);
+            if (batchOpen)
+            {
+                appendBatchRecord(LOG_KV_PUT, key, keyLen, value, valueLen);
+                return;
+            }
+
+            const uint32_t offset = appendRecord(LOG_KV_PUT, key, keyLen, value, valueLen);
+            if (offset != UINT32_MAX)
+            {
+                indexRecord(key, keyLen, LOG_KV_PUT, offset, valueLen);
+            }
+        }
+
+        char* recover(const char *key) override
+        {
+            const IndexEntry *entry = findLive(key);
+            if (entry == nullptr)
+            {
+                return nullptr;
+            }
+
+            char *ret = (char*) malloc(entry->valueLen + 1);
+            if (ret == nullptr)
+            {
+                return nullptr;
+            }
+
+            ret[readValue(*entry, ret, entry->valueLen)] = 0;
+            return ret;
+        }
+
+        size_t recover(const char *key, char *out, size_t outSize) override
+        {
+            memset(out, 0, outSize);
+
+            const IndexEntry *entry = findLive(key);
+            if (entry == nullptr || outSize == 0)
+            {
+                return 0;
+            }
+
+            return readValue(*entry, out, entry->valueLen < outSize - 1 ? entry->valueLen : outSize - 1);
+        }
+
+        /**
+         * Keys saved from inside fn may or may not be visited.
+         */
+        void doForEachKey(std::function<bool(const char *key, const char *value)> fn, const size_t maxValueSize) override
+        {
+            char *value = (char*) malloc(maxValueSize + 1);
+            if (value == nullptr)
+            {
+                LOGN("Memory allocation failed for key value iteration.");
+                return;
+            }
+
+            char key[UINT8_MAX + 1];
+            for (size_t i = 0; i < capacity; i++)
+            {
+                const IndexEntry entry = index[i];
+                if ((entry.state & SLOT_STATE_MASK) != SLOT_LIVE || !readKey(entry, key))
+                {
+                    continue;
+                }
+
+                value[readValue(entry, value, entry.valueLen < maxValueSize ? entry.valueLen : maxValueSize)] = 0;
+                if (!fn(key, value))
+                {
+                    break;
+                }
+            }
+
+            free(value);
+        }
+
+        /**
+         * The cursor is a slot of the index, the index growing in between may skip or repeat keys.
+         */
+        bool nextKey(size_t &cursor, char *key, size_t keySize) override
+        {
+            for (; cursor < capacity; cursor++)
+            {
+                const IndexEntry &entry = index[cursor];
+                if ((entry.state & SLOT_STATE_MASK) == SLOT_LIVE && entry.keyLen < keySize && readKey(entry, key))
+                {
+                    cursor++;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        size_t readValue(const char *key, size_t offset, char *out, size_t outSize, size_t *valueLength = nullptr) override
+        {
+            const IndexEntry *entry = findLive(key);
+            if (valueLength != nullptr)
+            {
+                *valueLength = entry != nullptr ? entry->valueLen : 0;
+            }
+
+            if (entry == nullptr || offset >= entry->valueLen ||
+                !file.seek(entry->offset + LOG_KV_HEADER_SIZE + entry->keyLen + offset))
+            {
+                return 0;
+            }
+
+            return file.read((uint8_t*) out, entry->valueLen - offset < outSize ? entry->valueLen - offset : outSize);
+        }
+
+        bool exists(const char *key) override
+        {
+            return findLive(key) != nullptr;
+        }
+
+        void remove(const char *key) override
+        {
+            ESP_CONP_MEASURE(flashWriteLatency);
+            const size_t keyLen = strlen(key);
+            if (batchOpen && keyLen > 0 && keyLen <= UINT8_MAX)
+            {
+                // The key may have been saved earlier in the batch, so the delete is always written
+                appendBatchRecord(LOG_KV_DELETE, key, keyLen, "", 0);
+                return;
+            }
+
+            if (findLive(key) == nullptr)
+            {
+                return;
+            }
+
+            const uint32_t offset = appendRecord(LOG_KV_DELETE, key, keyLen, "", 0);
+            if (offset != UINT32_MAX)
+            {
+                indexRecord(key, keyLen, LOG_KV_DELETE, offset, 0);
+            }
+        }
+
+        bool commit() override
+        {
+            batchOpen = false;
+            const bool failed = batchFailed;
+            batchFailed = false;
+            if (batchStart == UINT32_MAX)
+            {
+                return !failed;
+            }
+
+            const uint32_t commitOffset = failed ? UINT32_MAX : appendRecord(LOG_KV_COMMIT, "", 0, "", 0);
+            if (commitOffset == UINT32_MAX)
+            {
+                LOGF("Failed to commit batch to key value log %s.\n", path);
+                appendRecord(LOG_KV_ABORT, "", 0, "", 0);
+                batchStart = UINT32_MAX;
+                return false;
+            }
+
+            indexBatch(batchStart, commitOffset);
+            batchStart = UINT32_MAX;
+            return true;
+        }
+
+        void abort() override
+        {
+            batchOpen = false;
+            batchFailed = false;
+            if (batchStart != UINT32_MAX)
+            {
+                appendRecord(LOG_KV_ABORT, "", 0, "", 0);
+                batchStart = UINT32_MAX;
+            }
+        }
+
+        /**
+         * Rewrites the log with only the live records now instead of waiting for the background compaction.
+         */
+        bool compact()
+        {
+            if (batchOpen)
+            {
+                return false;
+            }
+
+            compactionFailed = false;
+            if (!compactFile && !startCompaction())
+            {
+                return false;
+            }
+
+            while (compactStep(SIZE_MAX))
+            {
+            }
+            return !compactionFailed && file;
+        }
+
+        size_t fileSize() const
+        {
+            return fileEnd;
+        }
+
+        /**
+         * Bytes of the log taken by overwritten and removed records.
+         */
+        size_t deadBytes() const
+        {
+            return fileEnd - liveBytes;
+        }
+
+        size_t keyCount() const
+        {
+            return liveCount;
+        }
+
+        const char *name() const override
+        {
+            return "log-storage";
+        }
+
+        void tick(unsigned long now) override
+        {
+            // The records of an open batch are only in the old log, it must not be replaced until the commit
+            if (batchOpen)
+            {
+                return;
+            }
+
+            if (!compactFile && !startCompaction())
+            {
+                compactionFailed = true;
+                return;
+            }
+
+            compactStep(ESP_CONP_LOG_KV_COMPACT_STEP);
+        }
+
+        unsigned long nextDeadline(unsigned long now) override
+        {
+            return !batchOpen && (compactFile || needsCompaction()) ? now : now + MODULE_IDLE_MS;
+        }
+
+    private:
+        static constexpr uint8_t SLOT_EMPTY = 0;
+        static constexpr uint8_t SLOT_LIVE = 1;
+        static constexpr uint8_t SLOT_DELETED = 2;
+        static constexpr uint8_t SLOT_STATE_MASK = 0x7f;
+        // Changed after the compaction copied the slot, its record is copied again when the compaction ends
+        static constexpr uint8_t SLOT_DIRTY = 0x80;
+        static constexpr size_t INITIAL_CAPACITY = 16;
+
+        /**
+         * Latest record of a key. Deleted slots point to the delete record, which keeps the key.
+         */
+        struct IndexEntry
+        {
+            uint32_t hash;
+            uint32_t offset;
+            uint16_t valueLen;
+            uint8_t keyLen;
+            uint8_t state;
+        };
+
+        char *path = nullptr;
+        char *tmpPath = nullptr;
+        File file;
+        IndexEntry *index = nullptr;
+        size_t capacity = 0;
+        size_t usedSlots = 0;
+        size_t liveCount = 0;
+        size_t fileEnd = 0;
+        size_t liveBytes = 0;
+        uint32_t sequence = 0;
+        uint32_t batchStart = UINT32_MAX;
+        bool batchFailed = false;
+        // A short write left a torn record at the end of the file, it is rewritten without it before the next append
+        bool tornTail = false;
+
+        File compactFile;
+        uint32_t *compactOffsets = nullptr;
+        size_t compactSlot = 0;
+        size_t compactEnd = 0;
+        // Stops the background compaction until compact() is called, so a full flash is not rewritten every loop
+        bool compactionFailed = false;
+
+        static size_t recordSize(uint8_t keyLen, uint16_t valueLen)
+        {
+            return LOG_KV_HEADER_SIZE + keyLen + valueLen;
+        }
+
+        bool needsCompaction() const
+        {
+            return !compactionFailed && fileEnd >= ESP_CONP_LOG_KV_COMPACT_MIN && (fileEnd - liveBytes) * 2 > fileEnd;
+        }
+
+        void openLog()
+        {
+            if (LittleFS.exists(tmpPath))
+            {
+                if (LittleFS.exists(path))
+                {
+                    LOGN("Removing unfinished key value log compaction.");
+                    LittleFS.remove(tmpPath);
+                }
+                else
+                {
+                    LOGN("Finishing interrupted key value log compaction.");
+                    LittleFS.rename(tmpPath, path);
+                }
+            }
+
+            file = LittleFS.open(path, "a+");
+            if (!file)
+            {
+                LOGF("Failed to open key value log %s.\n", path);
+                return;
+            }
+
+            if (!resizeIndex(INITIAL_CAPACITY))
+            {
+                return;
+            }
+
+            const size_t size = file.size();
+            scanLog(size);
+
+            if (fileEnd < size)
+            {
+                LOGF("Key value log %s has %zu bytes of torn or corrupt records after %zu, dropping them.\n", path, size - fileEnd, fileEnd);
+                const size_t validEnd = fileEnd;
+                // Appends go to the physical end of the file, so the garbage has to go before the next save
+                fileEnd = size;
+                if (!compact())
+                {
+                    LOGN("Failed to rewrite the key value log, it is read only until the next boot.");
+                    fileEnd = validEnd;
+                    file.close();
+                    file = LittleFS.open(path, "r");
+                }
+            }
+        }
+
+        void scanLog(size_t size)
+        {
+            uint8_t header[LOG_KV_HEADER_SIZE];
+            char key[UINT8_MAX + 1];
+            uint8_t chunk[64];
+            size_t offset = 0;
+
+            // Indexing a key can read an older record, so every record seeks to its own offset
+            while (offset + LOG_KV_HEADER_SIZE <= size && file.seek(offset) && file.read(header, LOG_KV_HEADER_SIZE) == LOG_KV_HEADER_SIZE)
+            {
+                const uint8_t flags = header[1];
+                const uint8_t type = flags & ~LOG_KV_BATCH;
+                const bool marker = type == LOG_KV_COMMIT || type == LOG_KV_ABORT;
+                const uint8_t keyLen = header[2];
+                const uint16_t valueLen = header[3] | (header[4] << 8);
+                const uint32_t seq = readUint32(header + 5);
+                const uint32_t crc = readUint32(header + LOG_KV_CRC_OFFSET);
+
+                if (header[0] != LOG_KV_MAGIC || type < LOG_KV_PUT || type > LOG_KV_ABORT || (keyLen == 0) != marker ||
+                    (marker && flags != type) || offset + recordSize(keyLen, valueLen) > size ||
+                    file.read((uint8_t*) key, keyLen) != keyLen)
+                {
+                    break;
+                }
+
+                key[keyLen] = 0;
+                uint32_t actual = logRecordHeaderCrc(header);
+                actual = crc32Update(actual, (uint8_t*) key, keyLen);
+                size_t remaining = valueLen;
+                while (remaining > 0)
+                {
+                    const size_t n = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+                    if (file.read(chunk, n) != n)
+                    {
+                        break;
+                    }
+                    actual = crc32Update(actual, chunk, n);
+                    remaining -= n;
+                }
+
+                if (remaining > 0 || actual != crc)
+                {
+                    break;
+                }
+
+                fileEnd = offset + recordSize(keyLen, valueLen);
+                sequence = seq > sequence ? seq : sequence;
+
+                if ((flags & LOG_KV_BATCH) != 0)
+                {
+                    batchStart = batchStart == UINT32_MAX ? offset : batchStart;
+                }
+                else if (type == LOG_KV_COMMIT && batchStart != UINT32_MAX)
+                {
+                    indexBatch(batchStart, offset);
+                    batchStart = UINT32_MAX;
+                }
+                else
+                {
+                    // An abort record, or a record after a batch whose abort record could not be written
+                    batchStart = UINT32_MAX;
+                    if (!marker)
+                    {
+                        indexRecord(key, keyLen, type, offset, valueLen);
+                    }
+                }
+                offset = fileEnd;
+            }
+
+            // A batch without a commit record at the end was cut by a power loss
+            if (batchStart != UINT32_MAX)
+            {
+                fileEnd = batchStart;
+                batchStart = UINT32_MAX;
+            }
+        }
+
+        /**
+         * Indexes the batch records written between from and the commit record at to.
+         */
+        void indexBatch(uint32_t from, uint32_t to)
+        {
+            uint8_t header[LOG_KV_HEADER_SIZE];
+            char key[UINT8_MAX + 1];
+
+            while (from < to && file.seek(from) && file.read(header, LOG_KV_HEADER_SIZE) == LOG_KV_HEADER_SIZE)
+            {
+                const uint8_t keyLen = header[2];
+                const uint16_t valueLen = header[3] | (header[4] << 8);
+                if (file.read((uint8_t*) key, keyLen) != keyLen)
+                {
+                    break;
+                }
+
+                key[keyLen] = 0;
+                indexRecord(key, keyLen, header[1] & ~LOG_KV_BATCH, from, valueLen);
+                from += recordSize(keyLen, valueLen);
+            }
+        }
+
+        void appendBatchRecord(uint8_t type, const char *key, size_t keyLen, const char *value, size_t valueLen)
+        {
+            const uint32_t offset = appendRecord(type | LOG_KV_BATCH, key, keyLen, value, valueLen, false);
+            if (offset == UINT32_MAX)
+            {
+                batchFailed = true;
+            }
+            else if (batchStart == UINT32_MAX)
+            {
+                batchStart = offset;
+            }
+        }
+
+        static uint32_t readUint32(const uint8_t *data)
+        {
+            return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24);
+        }
+
+        static void writeUint32(uint8_t *data, uint32_t value)
+        {
+            data[0] = value;
+            data[1] = value >> 8;
+            data[2] = value >> 16;
+            data[3] = value >> 24;
+        }
+
+        /**
+         * @return offset of the record or UINT32_MAX if it could not be written.
+         */
+        uint32_t appendRecord(uint8_t flags, const char *key, size_t keyLen, const char *value, size_t valueLen, bool flush = true)
+        {
+            // Compacting copies only the indexed records, which leaves the torn one behind. Not possible while a batch is
+            // open, the batch fails instead
+            if (!file || (tornTail && !compact()))
+            {
+                return UINT32_MAX;
+            }
+
+            uint8_t header[LOG_KV_HEADER_SIZE];
+            header[0] = LOG_KV_MAGIC;
+            header[1] = flags;
+            header[2] = keyLen;
+            header[3] = valueLen;
+            header[4] = valueLen >> 8;
+            writeUint32(header + 5, ++sequence);
+
+            uint32_t crc = logRecordHeaderCrc(header);
+            crc = crc32Update(crc, (const uint8_t*) key, keyLen);
+            crc = crc32Update(crc, (const uint8_t*) value, valueLen);
+            writeUint32(header + LOG_KV_CRC_OFFSET, crc);
+
+            file.seek(0, SeekEnd);
+            size_t written = file.write(header, LOG_KV_HEADER_SIZE);
+            written += file.write((const uint8_t*) key, keyLen);
+            written += file.write((const uint8_t*) value, valueLen);
+            if (flush)
+            {
+                file.flush();
+            }
+
+            if (written != recordSize(keyLen, valueLen))
+            {
+                // Records appended after the torn one would be lost by the next scan
+                LOGF("Failed to append to key value log %s.\n", path);
+                tornTail = true;
+                return UINT32_MAX;
+            }
+
+            const uint32_t offset = fileEnd;
+            fileEnd += written;
+            return offset;
+        }
+
+        bool readKey(const IndexEntry &entry, char *out)
+        {
+            if (!file.seek(entry.offset + LOG_KV_HEADER_SIZE) || file.read((uint8_t*) out, entry.keyLen) != entry.keyLen)
+            {
+                return false;
+            }
+
+            out[entry.keyLen] = 0;
+            return true;
+        }
+
+        size_t readValue(const IndexEntry &entry, char *out, size_t len)
+        {
+            if (!file.seek(entry.offset + LOG_KV_HEADER_SIZE + entry.keyLen))
+            {
+                return 0;
+            }
+
+            return file.read((uint8_t*) out, len);
+        }
+
+        bool keyMatches(const IndexEntry &entry, const char *key)
+        {
+            char stored[entry.keyLen + 1];
+            return readKey(entry, stored) && strcmp(stored, key) == 0;
+        }
+
+        /**
+         * Slot of the key, or the slot it should go to when it is not in the index.
+         */
+        size_t findSlot(const char *key, size_t keyLen, uint32_t hash, bool &found)
+        {
+            const size_t mask = capacity - 1;
+            size_t freeSlot = SIZE_MAX;
+            found = false;
+
+            for (size_t i = hash & mask, probes = 0; probes < capacity; i = (i + 1) & mask, probes++)
+            {
+                const IndexEntry &entry = index[i];
+                const uint8_t state = entry.state & SLOT_STATE_MASK;
+
+                if (state == SLOT_EMPTY)
+                {
+                    return freeSlot != SIZE_MAX ? freeSlot : i;
+                }
+
+                if (entry.hash == hash && entry.keyLen == keyLen && keyMatches(entry, key))
+                {
+                    found = true;
+                    return i;
+                }
+
+                // A running compaction still needs the key of deleted slots, they are only reused after it
+                if (state == SLOT_DELETED && freeSlot == SIZE_MAX && !compactFile)
+                {
+                    freeSlot = i;
+                }
+            }
+
+            return freeSlot;
+        }
+
+        const IndexEntry *findLive(const char *key)
+        {
+            if (capacity == 0)
+            {
+                return nullptr;
+            }
+
+            bool found;
+            const size_t keyLen = strlen(key);
+            const size_t slot = findSlot(key, keyLen, fnv1aHash(key, keyLen), found);
+            return found && (index[slot].state & SLOT_STATE_MASK) == SLOT_LIVE ? &index[slot] : nullptr;
+        }
+
+        void indexRecord(const char *key, size_t keyLen, uint8_t flags, uint32_t offset, uint16_t valueLen)
+        {
+            if ((usedSlots + 1) * 10 > capacity * 7)
+            {
+                // Slot positions change, so a running compaction starts over later
+                cancelCompaction();
+                if (!resizeIndex(liveCount * 10 >= capacity * 4 ? capacity * 2 : capacity))
+                {
+                    return;
+                }
+            }
+
+            bool found;
+            const uint32_t hash = fnv1aHash(key, keyLen);
+            const size_t slot = findSlot(key, keyLen, hash, found);
+            if (slot == SIZE_MAX)
+            {
+                return;
+            }
+
+            IndexEntry &entry = index[slot];
+            const uint8_t oldState = entry.state & SLOT_STATE_MASK;
+            if (oldState == SLOT_LIVE)
+            {
+                liveBytes -= recordSize(entry.keyLen, entry.valueLen);
+                liveCount--;
+            }
+            else if (oldState == SLOT_EMPTY)
+            {
+                usedSlots++;
+            }
+
+            const bool live = flags == LOG_KV_PUT;
+            entry.hash = hash;
+            entry.offset = offset;
+            entry.valueLen = valueLen;
+            entry.keyLen = keyLen;
+            entry.state = (live ? SLOT_LIVE : SLOT_DELETED) | (compactFile && slot < compactSlot ? SLOT_DIRTY : 0);
+
+            if (live)
+            {
+                liveBytes += recordSize(keyLen, valueLen);
+                liveCount++;
+            }
+
+            if (needsCompaction())
+            {
+                wakeModules();
+            }
+        }
+
+        /**
+         * Rebuilds the index with newCapacity slots without the deleted ones, pointing to newOffsets when given.
+         */
+        bool resizeIndex(size_t newCapacity, const uint32_t *newOffsets = nullptr)
+        {
+            auto *newIndex = (IndexEntry*) calloc(newCapacity, sizeof(IndexEntry));
+            if (newIndex == nullptr)
+            {
+                LOGN("Memory allocation failed for key value log index.");
+                return false;
+            }
+
+            const size_t mask = newCapacity - 1;
+            for (size_t i = 0; i < capacity; i++)
+            {
+                if ((index[i].state & SLOT_STATE_MASK) != SLOT_LIVE)
+                {
+                    continue;
+                }
+
+                size_t slot = index[i].hash & mask;
+                while (newIndex[slot].state != SLOT_EMPTY)
+                {
+                    slot = (slot + 1) & mask;
+                }
+
+                newIndex[slot] = index[i];
+                newIndex[slot].state = SLOT_LIVE;
+                if (newOffsets != nullptr)
+                {
+                    newIndex[slot].offset = newOffsets[i];
+                }
+            }
+
+            free(index);
+            index = newIndex;
+            capacity = newCapacity;
+            usedSlots = liveCount;
+            return true;
+        }
+
+        bool startCompaction()
+        {
+            if (!file)
+            {
+                return false;
+            }
+
+            compactFile = LittleFS.open(tmpPath, "w");
+            compactOffsets = (uint32_t*) malloc(capacity * sizeof(uint32_t));
+            if (!compactFile || compactOffsets == nullptr)
+            {
+                LOGF("Failed to start compacting key value log %s.\n", path);
+                cancelCompaction();
+                return false;
+            }
+
+            LOGF("Compacting key value log %s, %zu of %zu bytes are live.\n", path, liveBytes, fileEnd);
+            compactSlot = 0;
+            compactEnd = 0;
+            return true;
+        }
+
+        void cancelCompaction()
+        {
+            if (compactFile)
+            {
+                compactFile.close();
+                LittleFS.remove(tmpPath);
+            }
+
+            free(compactOffsets);
+            compactOffsets = nullptr;
+        }
+
+        bool copyRecord(size_t slot)
+        {
+            const IndexEntry &entry = index[slot];
+            uint8_t chunk[64];
+            size_t remaining = recordSize(entry.keyLen, entry.valueLen);
+
+            if (!file.seek(entry.offset))
+            {
+                return false;
+            }
+
+            compactOffsets[slot] = compactEnd;
+            while (remaining > 0)
+            {
+                const size_t n = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+                if (file.read(chunk, n) != n)
+                {
+                    return false;
+                }
+
+                // The copy is not part of a batch anymore, the commit record is not copied
+                if (remaining == recordSize(entry.keyLen, entry.valueLen))
+                {
+                    chunk[1] &= ~LOG_KV_BATCH;
+                }
+
+                if (compactFile.write(chunk, n) != n)
+                {
+                    return false;
+                }
+                compactEnd += n;
+                remaining -= n;
+            }
+
+            return true;
+        }
+
+        /**
+         * Copies up to maxRecords live records to the compacted log.
+         * @return true while there are records left to copy.
+         */
+        bool compactStep(size_t maxRecords)
+        {
+            for (; compactSlot < capacity && maxRecords > 0; compactSlot++)
+            {
+                if ((index[compactSlot].state & SLOT_STATE_MASK) != SLOT_LIVE)
+                {
+                    continue;
+                }
+
+                if (!copyRecord(compactSlot))
+                {
+                    LOGF("Failed to copy record to %s, cancelling compaction.\n", tmpPath);
+                    cancelCompaction();
+                    compactionFailed = true;
+                    return false;
+                }
+                maxRecords--;
+            }
+
+            if (compactSlot < capacity)
+            {
+                return true;
+            }
+
+            finishCompaction();
+            return false;
+        }
+
+        void finishCompaction()
+        {
+            // Slots changed after they were copied, the delete records are copied too so the stale copy stays deleted
+            for (size_t i = 0; i < capacity; i++)
+            {
+                if ((index[i].state & SLOT_DIRTY) != 0 && !copyRecord(i))
+                {
+                    LOGF("Failed to copy record to %s, cancelling compaction.\n", tmpPath);
+                    cancelCompaction();
+                    compactionFailed = true;
+                    return;
+                }
+            }
+
+            compactFile.flush();
+            compactFile.close();
+            file.close();
+
+            if (!LittleFS.rename(tmpPath, path))
+            {
+                LittleFS.remove(path);
+                LittleFS.rename(tmpPath, path);
+            }
+
+            file = LittleFS.open(path, "a+");
+            const size_t newEnd = file.size();
+            if (newEnd != compactEnd)
+            {
+                LOGF("Compacted key value log %s has %zu bytes, expected %zu.\n", path, newEnd, compactEnd);
+            }
+
+            if (!resizeIndex(capacity, compactOffsets))
+            {
+                // The old offsets are wrong now, only the next boot can index the compacted log
+                file.close();
+            }
+            free(compactOffsets);
+            compactOffsets = nullptr;
+            fileEnd = compactEnd;
+            tornTail = false;
+            LOGF("Compacted key value log %s to %zu bytes.\n", path, fileEnd);
+        }
+    };
+}
+
+#endif //ESP_CONFIG_PAGE_LOG_STORAGE_H
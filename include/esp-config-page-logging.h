@@ -4,13 +4,86 @@
 #define ENABLE_LOGGING_MODULE
 
 #include <esp-config-defines.h>
+#include <esp-config-page-ws-client.h>
 
 #include "Arduino.h"
 #include "WebSocketsServer.h"
 #include "LittleFS.h"
 
+#include <atomic>
+#include <type_traits>
+
 #define MAX_CLIENTS 8
 
+// Bytes of the buffer ConfigPageSerial writes the log lines to, must be a power of two
+#ifndef ESP_CONP_LOG_BUFFER_SIZE
+#define ESP_CONP_LOG_BUFFER_SIZE 4096
+#endif
+
+// Largest websocket frame sent to the logging clients, longer lines are cut to fit in one
+#ifndef ESP_CONP_LOG_FRAME_SIZE
+#define ESP_CONP_LOG_FRAME_SIZE 1024
+#endif
+
+// Maximum time the lines written to the retention file stay unflushed
+#ifndef ESP_CONP_LOG_FLUSH_MS
+#define ESP_CONP_LOG_FLUSH_MS 2000
+#endif
+
+// Files the retention is split in, when the newest one is full the oldest one is cleared and written next
+#ifndef ESP_CONP_LOG_SEGMENTS
+#define ESP_CONP_LOG_SEGMENTS 4
+#endif
+
+// Largest binary log record, built on the stack of the caller, longer string arguments are cut to fit
+#ifndef ESP_CONP_LOG_RECORD_SIZE
+#define ESP_CONP_LOG_RECORD_SIZE 128
+#endif
+
+// Define as 1 to also print binary log records formatted on Serial, on the caller's thread and at the UART's pace
+#ifndef ESP_CONP_LOG_RECORD_ECHO
+#define ESP_CONP_LOG_RECORD_ECHO 0
+#endif
+
+// Tags a logging client can subscribe to at once
+#ifndef ESP_CONP_LOG_MAX_TAGS
+#define ESP_CONP_LOG_MAX_TAGS 4
+#endif
+
+// Bytes of the frames waiting for each logging client, allocated when it logs in
+#ifndef ESP_CONP_LOG_CLIENT_QUEUE_SIZE
+#define ESP_CONP_LOG_CLIENT_QUEUE_SIZE 4096
+#endif
+
+// Bytes sent to a logging client before it acknowledges them, under the TCP send buffer so sending never waits on it.
+// The page acknowledges once half of it was received, so it must hold two frames for a full frame to always fit
+#ifndef ESP_CONP_LOG_CLIENT_WINDOW
+#define ESP_CONP_LOG_CLIENT_WINDOW 2048
+#endif
+
+static_assert(ESP_CONP_LOG_CLIENT_WINDOW >= 2 * ESP_CONP_LOG_FRAME_SIZE, "ESP_CONP_LOG_CLIENT_WINDOW must fit two frames");
+
+/**
+ * Logs a binary record: the format string and the tag are only sent and saved once, as an id computed from them and
+ * the argument types, each record carries that id, millis(), the level and the arguments as they are in memory.
+ * Supports integers, floats, doubles, pointers, C strings and Strings. Formats should not end with a newline, the tag is
+ * read on the first call only.
+ */
+#define ESP_CONP_LOG(level, tag, format, args...) \
+    do \
+    { \
+        using EspConpLogSignature = decltype(ESP_CONFIG_PAGE_LOGGING::logSignature(args)); \
+        constexpr uint32_t espConpLogId = ESP_CONFIG_PAGE::fnv1aHash(format) ^ EspConpLogSignature::hash; \
+        static ESP_CONFIG_PAGE_LOGGING::LogFormat espConpLogFormat(espConpLogId, tag, format, EspConpLogSignature::value); \
+        ESP_CONFIG_PAGE_LOGGING::logRecord(espConpLogFormat, level, ##args); \
+    } \
+    while (0)
+
+#define ESP_CONP_LOGD(tag, format, args...) ESP_CONP_LOG(ESP_CONFIG_PAGE_LOGGING::LEVEL_DEBUG, tag, format, ##args)
+#define ESP_CONP_LOGI(tag, format, args...) ESP_CONP_LOG(ESP_CONFIG_PAGE_LOGGING::LEVEL_INFO, tag, format, ##args)
+#define ESP_CONP_LOGW(tag, format, args...) ESP_CONP_LOG(ESP_CONFIG_PAGE_LOGGING::LEVEL_WARN, tag, format, ##args)
+#define ESP_CONP_LOGE(tag, format, args...) ESP_CONP_LOG(ESP_CONFIG_PAGE_LOGGING::LEVEL_ERROR, tag, format, ##args)
+
 namespace ESP_CONFIG_PAGE_LOGGING
 {
 #ifdef ESP32
@@ -24,112 +97,1551 @@ namespace ESP_CONFIG_PAGE_LOGGING
 #endif
 
     WebSocketsServer server(ESP_CONP_LOGGING_PORT);
-    char messageBuffer[1024]{};
+    char messageBuffer[ESP_CONP_LOG_FRAME_SIZE]{};
     unsigned long lastClean;
+    unsigned long lastFlush;
+    bool unflushedLogs = false;
     uint8_t pingMessage[] = {0xDE};
 
     Stream* logSerial = &Serial;
     String username;
     String password;
 
-    bool retentionEnabled = false;
-    String logFilePath;
-    File logFile;
-    unsigned long maximumSizeBytes;
-    bool isLoggingEnabled = false;
+    bool retentionEnabled = false;
+    String logFilePath;
+    File logFile;
+    unsigned long maximumSizeBytes;
+    bool isLoggingEnabled = false;
+
+    enum LogLevel : uint8_t
+    {
+        LEVEL_DEBUG,
+        LEVEL_INFO,
+        LEVEL_WARN,
+        LEVEL_ERROR
+    };
+
+    // Entries in the buffer, in the frames and in the retention start with a 2 byte header, their length and flags
+    constexpr size_t LOG_ENTRY_HEADER = sizeof(uint16_t);
+    constexpr uint16_t LOG_ENTRY_LENGTH = 0x3FFF;
+    // Binary record instead of a text line
+    constexpr uint16_t LOG_ENTRY_BINARY = 0x8000;
+    // Frames only, the count as 4 bytes of the lines before it the client filtered out
+    constexpr uint16_t LOG_ENTRY_SKIP = 0x4000;
+    constexpr size_t LOG_SKIP_ENTRY_SIZE = LOG_ENTRY_HEADER + sizeof(uint32_t);
+
+    // Record id, millis() and level, the arguments follow
+    constexpr size_t LOG_RECORD_HEADER = 2 * sizeof(uint32_t) + 1;
+    // Level and tag of the text lines written with ConfigPageSerial
+    constexpr LogLevel TEXT_LINE_LEVEL = LEVEL_INFO;
+    constexpr uint32_t TEXT_LINE_TAG_HASH = ESP_CONFIG_PAGE::fnv1aHash("");
+
+    struct LogSegment
+    {
+        bool exists;
+        // Lines are numbered across segments and restarts, the first one is saved in the segment header
+        uint32_t firstSeq;
+        uint32_t lines;
+        // File size, header included
+        uint32_t bytes;
+    };
+
+    LogSegment logSegments[ESP_CONP_LOG_SEGMENTS]{};
+    uint8_t activeSegment = 0;
+    unsigned long segmentSizeBytes;
+    // Sequence number of the next line drained from the buffer
+    uint32_t nextSeq = 0;
+
+    struct LogStats
+    {
+        uint32_t lines;
+        // Lines that did not fit in the buffer, it was not drained by loop() in time
+        uint32_t dropped;
+        // Lines cut to fit in one frame
+        uint32_t truncated;
+        uint32_t frames;
+        uint32_t fileWrites;
+        uint32_t fileFlushes;
+        // Lines and frames dropped from the queue of a client that did not keep up, and clients disconnected for it
+        uint32_t clientDroppedLines;
+        uint32_t clientDroppedFrames;
+        uint32_t clientDisconnects;
+    };
+
+    LogStats logStats{};
+
+    /**
+     * What happens to a frame for a client whose queue is full.
+     */
+    enum LogQueuePolicy : uint8_t
+    {
+        // The oldest queued frames are dropped to make room
+        QUEUE_DROP_OLDEST,
+        // The new frame is dropped
+        QUEUE_DROP_NEWEST,
+        // The client is disconnected, it replays the missed lines when it reconnects
+        QUEUE_DISCONNECT
+    };
+
+    LogQueuePolicy queuePolicy = QUEUE_DROP_OLDEST;
+
+    /**
+     * Byte ring of the lines waiting for loop(), each one stored as its 2 byte header followed by the text or the binary
+     * record. Writers copy the line in and move head, loop() reads the lines and then moves tail without waiting for them.
+     * On ESP32 the writers share a critical section held for the copy only, which also keeps a higher priority task from
+     * preempting a writer halfway through. Lines must not be written from interrupts.
+     */
+    class LogRingBuffer
+    {
+    public:
+        static_assert((ESP_CONP_LOG_BUFFER_SIZE & (ESP_CONP_LOG_BUFFER_SIZE - 1)) == 0,
+                      "ESP_CONP_LOG_BUFFER_SIZE must be a power of two");
+
+        // A line always fits in a frame after the event type, the sequence number and two skip entries
+        static constexpr size_t MAX_LINE = ESP_CONP_LOG_FRAME_SIZE - 32;
+
+        bool push(const uint8_t *data, size_t size, bool binary = false)
+        {
+            lock();
+            logStats.lines++;
+            if (size > MAX_LINE)
+            {
+                size = MAX_LINE;
+                logStats.truncated++;
+            }
+
+            const uint32_t h = head.load(std::memory_order_relaxed);
+            const bool fits = ESP_CONP_LOG_BUFFER_SIZE - (h - tail.load(std::memory_order_acquire)) >= LOG_ENTRY_HEADER + size;
+            if (fits)
+            {
+                const uint16_t header = size | (binary ? LOG_ENTRY_BINARY : 0);
+                copyIn(h, (const uint8_t*) &header, LOG_ENTRY_HEADER);
+                copyIn(h + LOG_ENTRY_HEADER, data, size);
+                head.store(h + LOG_ENTRY_HEADER + size, std::memory_order_release);
+            }
+            else
+            {
+                logStats.dropped++;
+            }
+
+            unlock();
+            return fits;
+        }
+
+        /**
+         * @return position of the oldest line.
+         */
+        uint32_t begin() const
+        {
+            return tail.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @return position after the last line written until now, the lines from begin() to it can be read until release().
+         */
+        uint32_t end() const
+        {
+            return head.load(std::memory_order_acquire);
+        }
+
+        uint16_t header(uint32_t position) const
+        {
+            uint16_t header;
+            copyOut(position, (uint8_t*) &header, LOG_ENTRY_HEADER);
+            return header;
+        }
+
+        /**
+         * Copies the first size bytes of the line at position to out.
+         */
+        void read(uint32_t position, uint8_t *out, size_t size) const
+        {
+            copyOut(position + LOG_ENTRY_HEADER, out, size);
+        }
+
+        static uint32_t next(uint32_t position, uint16_t header)
+        {
+            return position + LOG_ENTRY_HEADER + (header & LOG_ENTRY_LENGTH);
+        }
+
+        /**
+         * Frees the lines before position for the writers.
+         */
+        void release(uint32_t position)
+        {
+            tail.store(position, std::memory_order_release);
+        }
+
+        void clear()
+        {
+            tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+        }
+
+        void lock()
+        {
+#ifdef ESP32
+            portENTER_CRITICAL(&writeMux);
+#endif
+        }
+
+        void unlock()
+        {
+#ifdef ESP32
+            portEXIT_CRITICAL(&writeMux);
+#endif
+        }
+
+    private:
+        uint8_t buffer[ESP_CONP_LOG_BUFFER_SIZE]{};
+        // Free running byte counters, the position in buffer is the counter modulo its size
+        std::atomic<uint32_t> head{0};
+        std::atomic<uint32_t> tail{0};
+#ifdef ESP32
+        portMUX_TYPE writeMux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+        void copyIn(uint32_t position, const uint8_t *data, size_t size)
+        {
+            const size_t offset = position & (ESP_CONP_LOG_BUFFER_SIZE - 1);
+            const size_t first = min(size, (size_t) ESP_CONP_LOG_BUFFER_SIZE - offset);
+            memcpy(buffer + offset, data, first);
+            memcpy(buffer, data + first, size - first);
+        }
+
+        void copyOut(uint32_t position, uint8_t *out, size_t size) const
+        {
+            const size_t offset = position & (ESP_CONP_LOG_BUFFER_SIZE - 1);
+            const size_t first = min(size, (size_t) ESP_CONP_LOG_BUFFER_SIZE - offset);
+            memcpy(out, buffer + offset, first);
+            memcpy(out + first, buffer, size - first);
+        }
+    };
+
+    LogRingBuffer logBuffer;
+
+    /**
+     * Format string of an ESP_CONP_LOG call site, registered the first time it runs. Signature has one character per
+     * argument: i/u for 32 bit integers, q/Q for 64 bit ones, f for floats, d for doubles and s for strings.
+     */
+    struct LogFormat
+    {
+        LogFormat(uint32_t formatId, const char *tag, const char *format, const char *signature);
+
+        const uint32_t tagHash;
+        // Hash of the format and signature given by ESP_CONP_LOG mixed with the tag hash
+        const uint32_t id;
+        const char *const tag;
+        const char *const format;
+        const char *const signature;
+        LogFormat *next;
+    };
+
+    // Newest registered format first
+    std::atomic<LogFormat*> registeredFormats{nullptr};
+    // Formats up to this one were sent to the clients and saved
+    LogFormat *announcedFormats = nullptr;
+
+    /**
+     * Tag of each announced or saved format, to filter the records by it.
+     */
+    struct KnownFormat
+    {
+        uint32_t id;
+        uint32_t tagHash;
+        // In the format file of the retention
+        bool saved;
+    };
+
+    KnownFormat *knownFormats = nullptr;
+    size_t knownFormatCount = 0;
+    size_t knownFormatCapacity = 0;
+    // Records of the same call site tend to come in a row
+    size_t lastKnownFormat = 0;
+
+    inline LogFormat::LogFormat(uint32_t formatId, const char *tag, const char *format, const char *signature) :
+        tagHash(ESP_CONFIG_PAGE::fnv1aHash(tag)), id(formatId ^ tagHash * 16777619u), tag(tag), format(format),
+        signature(signature), next(nullptr)
+    {
+        logBuffer.lock();
+        next = registeredFormats.load(std::memory_order_relaxed);
+        registeredFormats.store(this, std::memory_order_release);
+        logBuffer.unlock();
+    }
+
+    template <typename T, typename = void>
+    struct LogArg;
+
+    template <typename T>
+    struct LogArg<T, typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type>
+    {
+        static constexpr bool SIGNED = std::is_signed<T>::value;
+        static constexpr char TAG = sizeof(T) > 4 ? (SIGNED ? 'q' : 'Q') : (SIGNED ? 'i' : 'u');
+        using Stored = typename std::conditional<(sizeof(T) > 4), typename std::conditional<SIGNED, int64_t, uint64_t>::type,
+                                                 typename std::conditional<SIGNED, int32_t, uint32_t>::type>::type;
+        static constexpr size_t MIN_SIZE = sizeof(Stored);
+
+        static const void *data(const T &value, Stored &stored)
+        {
+            stored = (Stored) value;
+            return &stored;
+        }
+
+        static size_t size(const T &)
+        {
+            return sizeof(Stored);
+        }
+    };
+
+    template <typename T>
+    struct LogArg<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+    {
+        static constexpr char TAG = sizeof(T) > 4 ? 'd' : 'f';
+        using Stored = T;
+        static constexpr size_t MIN_SIZE = sizeof(T);
+
+        static const void *data(const T &value, Stored &)
+        {
+            return &value;
+        }
+
+        static size_t size(const T &)
+        {
+            return sizeof(T);
+        }
+    };
+
+    template <typename T>
+    struct LogArg<T*, typename std::enable_if<!std::is_same<typename std::remove_cv<T>::type, char>::value>::type>
+    {
+        static constexpr char TAG = sizeof(void*) > 4 ? 'Q' : 'u';
+        using Stored = uintptr_t;
+        static constexpr size_t MIN_SIZE = sizeof(uintptr_t);
+
+        static const void *data(T *value, Stored &stored)
+        {
+            stored = (uintptr_t) value;
+            return &stored;
+        }
+
+        static size_t size(T *)
+        {
+            return sizeof(uintptr_t);
+        }
+    };
+
+    template <typename T>
+    struct LogArg<T*, typename std::enable_if<std::is_same<typename std::remove_cv<T>::type, char>::value>::type>
+    {
+        static constexpr char TAG = 's';
+        using Stored = char;
+        // Strings can be cut down to their terminator
+        static constexpr size_t MIN_SIZE = 1;
+
+        static const void *data(const char *value, Stored &)
+        {
+            return value != nullptr ? value : "(null)";
+        }
+
+        static size_t size(const char *value)
+        {
+            return (value != nullptr ? strlen(value) : 6) + 1;
+        }
+    };
+
+    template <>
+    struct LogArg<String>
+    {
+        static constexpr char TAG = 's';
+        using Stored = char;
+        static constexpr size_t MIN_SIZE = 1;
+
+        static const void *data(const String &value, Stored &)
+        {
+            return value.c_str();
+        }
+
+        static size_t size(const String &value)
+        {
+            return value.length() + 1;
+        }
+    };
+
+    template <typename... Args>
+    struct LogSignature
+    {
+        static constexpr char value[] = {LogArg<typename std::decay<Args>::type>::TAG..., 0};
+        static constexpr uint32_t hash = ESP_CONFIG_PAGE::fnv1aHash(value, sizeof...(Args));
+    };
+
+    /**
+     * Only used in decltype by ESP_CONP_LOG, for the signature of its arguments.
+     */
+    template <typename... Args>
+    LogSignature<Args...> logSignature(const Args &...);
+
+    /**
+     * Bytes the arguments take at least in a record, with their strings cut down to the terminator.
+     */
+    template <typename... Args>
+    struct LogArgsMinSize;
+
+    template <>
+    struct LogArgsMinSize<>
+    {
+        static constexpr size_t value = 0;
+    };
+
+    template <typename T, typename... Rest>
+    struct LogArgsMinSize<T, Rest...>
+    {
+        static constexpr size_t value = LogArg<T>::MIN_SIZE + LogArgsMinSize<Rest...>::value;
+    };
+
+    /**
+     * Appends the argument as stored in binary records, strings are cut to fit and keep their terminator.
+     * @param reserved Bytes kept free for the arguments after this one, so a long string does not push them out.
+     */
+    template <typename T>
+    inline void putLogArg(uint8_t *record, size_t &len, const T &value, size_t reserved)
+    {
+        using Arg = LogArg<typename std::decay<T>::type>;
+        typename Arg::Stored stored{};
+        const void *data = Arg::data(value, stored);
+        size_t size = Arg::size(value);
+        const size_t limit = reserved < ESP_CONP_LOG_RECORD_SIZE ? ESP_CONP_LOG_RECORD_SIZE - reserved : 0;
+
+        if (Arg::TAG == 's' && len + size > limit && len < limit)
+        {
+            size = limit - len;
+            memcpy(record + len, data, size - 1);
+            record[len + size - 1] = 0;
+            len += size;
+            return;
+        }
+
+        if (len + size <= ESP_CONP_LOG_RECORD_SIZE)
+        {
+            memcpy(record + len, data, size);
+            len += size;
+        }
+    }
+
+    inline void putLogArgs(uint8_t *, size_t &)
+    {
+    }
+
+    template <typename T, typename... Rest>
+    inline void putLogArgs(uint8_t *record, size_t &len, const T &value, const Rest &... rest)
+    {
+        putLogArg(record, len, value, LogArgsMinSize<typename std::decay<Rest>::type...>::value);
+        putLogArgs(record, len, rest...);
+    }
+
+    template <typename T>
+    inline const T &printfArg(const T &value)
+    {
+        return value;
+    }
+
+    inline const char *printfArg(const String &value)
+    {
+        return value.c_str();
+    }
+
+    /**
+     * Copies a binary record to the log buffer, use it through ESP_CONP_LOG.
+     */
+    template <typename... Args>
+    inline void logRecord(const LogFormat &format, LogLevel level, const Args &... args)
+    {
+#if ESP_CONP_LOG_RECORD_ECHO
+        if constexpr (sizeof...(Args) == 0)
+        {
+            Serial.println(format.format);
+        }
+        else
+        {
+            Serial.printf(format.format, printfArg(args)...);
+            Serial.println();
+        }
+#endif
+        if (!isLoggingEnabled)
+        {
+            return;
+        }
+
+        // Id, millis() and level, then the arguments
+        uint8_t record[ESP_CONP_LOG_RECORD_SIZE];
+        const uint32_t now = millis();
+        memcpy(record, &format.id, sizeof(uint32_t));
+        memcpy(record + sizeof(uint32_t), &now, sizeof(uint32_t));
+        record[LOG_RECORD_HEADER - 1] = level;
+        size_t len = LOG_RECORD_HEADER;
+
+        putLogArgs(record, len, args...);
+        logBuffer.push(record, len, true);
+    }
+
+    /**
+     * Frames waiting to be sent to a logging client, each one stored after its length, its lines and the lines dropped
+     * right before it. Only loop() uses it, the buffer is allocated while the client is logged in.
+     */
+    class ClientQueue
+    {
+    public:
+        struct Entry
+        {
+            uint16_t len;
+            uint16_t lines;
+            uint32_t gapBefore;
+        };
+
+        static_assert((ESP_CONP_LOG_CLIENT_QUEUE_SIZE & (ESP_CONP_LOG_CLIENT_QUEUE_SIZE - 1)) == 0,
+                      "ESP_CONP_LOG_CLIENT_QUEUE_SIZE must be a power of two");
+        static_assert(ESP_CONP_LOG_CLIENT_QUEUE_SIZE >= 2 * (ESP_CONP_LOG_FRAME_SIZE + sizeof(Entry)),
+                      "ESP_CONP_LOG_CLIENT_QUEUE_SIZE must fit two frames");
+
+        bool allocate()
+        {
+            if (buffer == nullptr)
+            {
+                buffer = (uint8_t*) malloc(ESP_CONP_LOG_CLIENT_QUEUE_SIZE);
+            }
+
+            head = tail = 0;
+            gap = 0;
+            return buffer != nullptr;
+        }
+
+        void release()
+        {
+            free(buffer);
+            buffer = nullptr;
+            head = tail = 0;
+            gap = 0;
+        }
+
+        size_t freeBytes() const
+        {
+            return buffer != nullptr ? ESP_CONP_LOG_CLIENT_QUEUE_SIZE - (head - tail) : 0;
+        }
+
+        bool empty() const
+        {
+            return head == tail;
+        }
+
+        /**
+         * @return false if the frame does not fit.
+         */
+        bool push(const uint8_t *frame, size_t len, uint32_t lines)
+        {
+            if (freeBytes() < sizeof(Entry) + len)
+            {
+                return false;
+            }
+
+            const Entry entry{(uint16_t) len, (uint16_t) min(lines, (uint32_t) UINT16_MAX), gap};
+            copyIn(head, (const uint8_t*) &entry, sizeof(entry));
+            copyIn(head + sizeof(entry), frame, len);
+            head += sizeof(entry) + len;
+            gap = 0;
+            return true;
+        }
+
+        bool peek(Entry &entry) const
+        {
+            if (empty())
+            {
+                return false;
+            }
+
+            copyOut(tail, (uint8_t*) &entry, sizeof(entry));
+            return true;
+        }
+
+        /**
+         * Moves the oldest frame to out, which must fit it.
+         */
+        void pop(uint8_t *out)
+        {
+            Entry entry;
+            copyOut(tail, (uint8_t*) &entry, sizeof(entry));
+            copyOut(tail + sizeof(entry), out, entry.len);
+            tail += sizeof(entry) + entry.len;
+        }
+
+        /**
+         * Drops the oldest frame, its lines are reported before the next one.
+         * @return lines of the frame.
+         */
+        uint16_t dropOldest()
+        {
+            Entry entry;
+            copyOut(tail, (uint8_t*) &entry, sizeof(entry));
+            tail += sizeof(entry) + entry.len;
+
+            Entry next;
+            if (peek(next))
+            {
+                next.gapBefore += entry.gapBefore + entry.lines;
+                copyIn(tail, (const uint8_t*) &next, sizeof(next));
+            }
+            else
+            {
+                gap += entry.gapBefore + entry.lines;
+            }
+            return entry.lines;
+        }
+
+        /**
+         * Counts lines dropped after the last queued frame.
+         */
+        void addGap(uint32_t lines)
+        {
+            gap += lines;
+        }
+
+        /**
+         * @return lines dropped after the last frame when the queue is empty, which are then considered reported.
+         */
+        uint32_t takeGap()
+        {
+            const uint32_t lines = empty() ? gap : 0;
+            gap -= lines;
+            return lines;
+        }
+
+    private:
+        uint8_t *buffer = nullptr;
+        uint32_t head = 0;
+        uint32_t tail = 0;
+        // Lines dropped since the last queued frame
+        uint32_t gap = 0;
+
+        void copyIn(uint32_t position, const uint8_t *data, size_t size)
+        {
+            const size_t offset = position % ESP_CONP_LOG_CLIENT_QUEUE_SIZE;
+            const size_t first = min(size, (size_t) ESP_CONP_LOG_CLIENT_QUEUE_SIZE - offset);
+            memcpy(buffer + offset, data, first);
+            memcpy(buffer, data + first, size - first);
+        }
+
+        void copyOut(uint32_t position, uint8_t *out, size_t size) const
+        {
+            const size_t offset = position % ESP_CONP_LOG_CLIENT_QUEUE_SIZE;
+            const size_t first = min(size, (size_t) ESP_CONP_LOG_CLIENT_QUEUE_SIZE - offset);
+            memcpy(out, buffer + offset, first);
+            memcpy(out + first, buffer, size - first);
+        }
+    };
+
+    enum EventType
+    {
+        AUTH = 'A',
+        LOG = 'l',
+        ALL_LOGS = 'L',
+        FORMATS = 'F',
+        SUBSCRIBE = 'S',
+        // Bytes of binary frames the client received, in decimal
+        ACK = 'K',
+        // Lines dropped from the queue of the client, 4 bytes
+        GAP = 'G',
+        ERROR = 'E',
+        PING = 'P',
+        PONG = 'p'
+    };
+
+    /**
+     * Lines a client gets: from minLevel up and, if it has tags, only the ones with one of them. Text lines are
+     * TEXT_LINE_LEVEL without a tag, an empty tag matches them.
+     */
+    struct LogSubscription
+    {
+        uint8_t minLevel = LEVEL_DEBUG;
+        uint8_t tagCount = 0;
+        uint32_t tagHashes[ESP_CONP_LOG_MAX_TAGS]{};
+    };
+
+    struct ConnectedClient : ESP_CONFIG_PAGE::WsClient
+    {
+        // Sending the retained lines from replaySeq, live lines are held back until it catches up
+        bool replaying = false;
+        uint32_t replaySeq = 0;
+        // Where replaySeq is, valid while the segment still starts at replaySegmentSeq
+        int8_t replaySegment = -1;
+        uint32_t replaySegmentSeq = 0;
+        uint32_t replayOffset = 0;
+        LogSubscription subscription{};
+        ClientQueue queue{};
+        // Bytes of binary frames sent and acknowledged, at most ESP_CONP_LOG_CLIENT_WINDOW apart
+        uint32_t sentBytes = 0;
+        uint32_t ackedBytes = 0;
+    };
+
+    ConnectedClient connectedClients[MAX_CLIENTS];
+
+    inline bool clientIsConnected(int i)
+    {
+        return connectedClients[i].id >= 0;
+    }
+
+    inline bool removeClient(uint8_t id)
+    {
+        for (size_t i = 0; i < MAX_CLIENTS; i++)
+        {
+            if (connectedClients[i].id == id)
+            {
+                connectedClients[i].id = -1;
+                connectedClients[i].queue.release();
+
+                if (server.clientIsConnected(id))
+                {
+                    server.disconnect(id);
+                }
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline int registerClient(uint8_t id)
+    {
+        for (size_t i = 0; i < MAX_CLIENTS; i++)
+        {
+            if (connectedClients[i].id < 0)
+            {
+                connectedClients[i].id = id;
+                connectedClients[i].authed = false;
+                connectedClients[i].replaying = false;
+                connectedClients[i].subscription = {};
+                connectedClients[i].sentBytes = 0;
+                connectedClients[i].ackedBytes = 0;
+                connectedClients[i].connectedTime = millis();
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    inline void sendMessage(uint8_t clientId, const char *message, const size_t len, bool isText, EventType eventType)
+    {
+        ESP_CONP_MEASURE(ESP_CONFIG_PAGE::wsSendLatency);
+        const size_t sent = min(len, sizeof(messageBuffer) - 1);
+        messageBuffer[0] = eventType;
+        memcpy(messageBuffer+1, message, sent);
+
+        if (isText)
+        {
+            server.sendTXT(clientId, messageBuffer, sent+1);
+        }
+        else
+        {
+            server.sendBIN(clientId, (uint8_t*) messageBuffer, sent+1);
+        }
+    }
+
+    inline void sendMessage(uint8_t clientId, const char *message, EventType eventType)
+    {
+        sendMessage(clientId, message, strlen(message), true, eventType);
+    }
+
+    inline void broadcastMessage(const char *message, const size_t len, bool isText, EventType eventType)
+    {
+        for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+        {
+            if (clientIsConnected(i) && connectedClients[i].authed)
+            {
+                sendMessage(connectedClients[i].id, message, len, isText, eventType);
+            }
+        }
+    }
+
+    inline String segmentPath(uint8_t segment)
+    {
+        return logFilePath + '.' + segment;
+    }
+
+    inline String formatFilePath()
+    {
+        return logFilePath + ".fmt";
+    }
+
+    // Segments start with '@' and the sequence number of their first line, text only segments started with '#' and
+    // are cleared when written next
+    inline size_t segmentHeaderSize(uint32_t firstSeq)
+    {
+        char header[16];
+        return snprintf(header, sizeof(header), "@%lu\n", (unsigned long) firstSeq);
+    }
+
+    /**
+     * Clears the oldest segment and continues writing on it, its lines start at firstSeq.
+     */
+    inline void rotateSegment(uint32_t firstSeq)
+    {
+        logFile.close();
+        activeSegment = (activeSegment + 1) % ESP_CONP_LOG_SEGMENTS;
+        logFile = LittleFS.open(segmentPath(activeSegment), "w");
+
+        LogSegment &segment = logSegments[activeSegment];
+        segment.exists = (bool) logFile;
+        segment.firstSeq = firstSeq;
+        segment.lines = 0;
+        segment.bytes = logFile ? logFile.printf("@%lu\n", (unsigned long) firstSeq) : 0;
+    }
+
+    inline KnownFormat *findKnownFormat(uint32_t id)
+    {
+        if (lastKnownFormat < knownFormatCount && knownFormats[lastKnownFormat].id == id)
+        {
+            return &knownFormats[lastKnownFormat];
+        }
+
+        for (size_t i = 0; i < knownFormatCount; i++)
+        {
+            if (knownFormats[i].id == id)
+            {
+                lastKnownFormat = i;
+                return &knownFormats[i];
+            }
+        }
+        return nullptr;
+    }
+
+    inline KnownFormat *addKnownFormat(uint32_t id, uint32_t tagHash)
+    {
+        KnownFormat *known = findKnownFormat(id);
+        if (known != nullptr)
+        {
+            return known;
+        }
+
+        if (knownFormatCount == knownFormatCapacity)
+        {
+            const size_t newCapacity = knownFormatCapacity == 0 ? 16 : knownFormatCapacity * 2;
+            auto *newFormats = (KnownFormat*) realloc(knownFormats, newCapacity * sizeof(KnownFormat));
+            if (newFormats == nullptr)
+            {
+                return nullptr;
+            }
+
+            knownFormats = newFormats;
+            knownFormatCapacity = newCapacity;
+        }
+
+        knownFormats[knownFormatCount] = {id, tagHash, false};
+        return &knownFormats[knownFormatCount++];
+    }
+
+    inline bool isFiltering(const LogSubscription &subscription)
+    {
+        return subscription.minLevel > LEVEL_DEBUG || subscription.tagCount > 0;
+    }
+
+    inline bool sameSubscription(const LogSubscription &a, const LogSubscription &b)
+    {
+        return a.minLevel == b.minLevel && a.tagCount == b.tagCount &&
+            memcmp(a.tagHashes, b.tagHashes, a.tagCount * sizeof(uint32_t)) == 0;
+    }
+
+    /**
+     * @param record First bytes of the line, the record header for records
+     * @return if the line passes the filters of the subscription.
+     */
+    inline bool acceptsEntry(const LogSubscription &subscription, uint16_t header, const uint8_t *record)
+    {
+        const bool isRecord = (header & LOG_ENTRY_BINARY) != 0 && (header & LOG_ENTRY_LENGTH) >= LOG_RECORD_HEADER;
+        if ((isRecord ? record[LOG_RECORD_HEADER - 1] : (uint8_t) TEXT_LINE_LEVEL) < subscription.minLevel)
+        {
+            return false;
+        }
+
+        if (subscription.tagCount == 0)
+        {
+            return true;
+        }
+
+        uint32_t tagHash = TEXT_LINE_TAG_HASH;
+        if (isRecord)
+        {
+            uint32_t id;
+            memcpy(&id, record, sizeof(id));
+            const KnownFormat *known = findKnownFormat(id);
+            tagHash = known != nullptr ? known->tagHash : 0;
+        }
+
+        for (uint8_t i = 0; i < subscription.tagCount; i++)
+        {
+            if (subscription.tagHashes[i] == tagHash)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Reads the subscription sent by a client, the minimum level and optionally a colon and the tags separated by commas.
+     */
+    inline void parseSubscription(const char *payload, size_t length, LogSubscription &subscription)
+    {
+        char text[128]{};
+        memcpy(text, payload, min(length, sizeof(text) - 1));
+
+        char *tags;
+        subscription = {};
+        subscription.minLevel = min(strtoul(text, &tags, 10), (unsigned long) LEVEL_ERROR);
+        if (*tags != ':')
+        {
+            return;
+        }
+
+        for (char *tag = tags + 1; subscription.tagCount < ESP_CONP_LOG_MAX_TAGS;)
+        {
+            char *comma = strchr(tag, ',');
+            const size_t tagLength = comma != nullptr ? comma - tag : strlen(tag);
+            subscription.tagHashes[subscription.tagCount++] = ESP_CONFIG_PAGE::fnv1aHash(tag, tagLength);
+
+            if (comma == nullptr)
+            {
+                break;
+            }
+            tag = comma + 1;
+        }
+    }
+
+    /**
+     * Frame being built in messageBuffer: the event type, the sequence number of the first line as 4 bytes and the
+     * lines, each one after its 2 byte header like in the retention. Lines filtered out between them are sent as one
+     * skip entry per run.
+     */
+    struct LogFrame
+    {
+        size_t len;
+        uint32_t firstSeq;
+        uint32_t entries;
+        // Lines filtered out since the last entry
+        uint32_t skipped;
+    };
+
+    constexpr size_t LOG_FRAME_HEADER = 1 + sizeof(uint32_t);
+
+    inline LogFrame beginFrame(EventType eventType, uint32_t firstSeq)
+    {
+        messageBuffer[0] = eventType;
+        memcpy(messageBuffer + 1, &firstSeq, sizeof(firstSeq));
+        return {LOG_FRAME_HEADER, firstSeq, 0, 0};
+    }
+
+    inline void addSkipEntry(LogFrame &frame)
+    {
+        const uint16_t header = LOG_ENTRY_SKIP | sizeof(uint32_t);
+        memcpy(messageBuffer + frame.len, &header, LOG_ENTRY_HEADER);
+        memcpy(messageBuffer + frame.len + LOG_ENTRY_HEADER, &frame.skipped, sizeof(uint32_t));
+        frame.len += LOG_SKIP_ENTRY_SIZE;
+        frame.skipped = 0;
+    }
+
+    /**
+     * @return if a line of size bytes fits in the frame, along with the skip entries before and after it.
+     */
+    inline bool entryFits(const LogFrame &frame, size_t size)
+    {
+        return frame.len + LOG_ENTRY_HEADER + size + 2 * LOG_SKIP_ENTRY_SIZE <= sizeof(messageBuffer);
+    }
+
+    /**
+     * Adds the header of a line, the skipped lines before it start the frame later or go in a skip entry.
+     * @return where the bytes of the line go.
+     */
+    inline uint8_t *addEntry(LogFrame &frame, uint16_t header)
+    {
+        if (frame.skipped > 0 && frame.entries == 0)
+        {
+            frame.firstSeq += frame.skipped;
+            frame.skipped = 0;
+            memcpy(messageBuffer + 1, &frame.firstSeq, sizeof(frame.firstSeq));
+        }
+        else if (frame.skipped > 0)
+        {
+            addSkipEntry(frame);
+        }
+
+        memcpy(messageBuffer + frame.len, &header, LOG_ENTRY_HEADER);
+        uint8_t *line = (uint8_t*) messageBuffer + frame.len + LOG_ENTRY_HEADER;
+        frame.len += LOG_ENTRY_HEADER + (header & LOG_ENTRY_LENGTH);
+        frame.entries++;
+        return line;
+    }
+
+    /**
+     * Ends the frame with the lines skipped after its last entry, so the client knows where the next one starts.
+     */
+    inline void finishFrame(LogFrame &frame)
+    {
+        if (frame.skipped > 0 && frame.entries > 0)
+        {
+            addSkipEntry(frame);
+        }
+    }
+
+    inline void sendFrame(uint8_t clientId, const LogFrame &frame)
+    {
+        ESP_CONP_MEASURE(ESP_CONFIG_PAGE::wsSendLatency);
+        server.sendBIN(clientId, (uint8_t*) messageBuffer, frame.len);
+    }
+
+    /**
+     * Appends the lines of the frame to the retention, they are stored as they are sent.
+     */
+    inline void writeLogEntries(const LogFrame &frame)
+    {
+        const size_t dataLen = frame.len - LOG_FRAME_HEADER;
+        if (logFile && logSegments[activeSegment].lines > 0 && logSegments[activeSegment].bytes + dataLen > segmentSizeBytes)
+        {
+            rotateSegment(frame.firstSeq);
+        }
+
+        if (!logFile)
+        {
+            return;
+        }
+
+        logFile.write((const uint8_t*) messageBuffer + LOG_FRAME_HEADER, dataLen);
+        logSegments[activeSegment].lines += frame.entries;
+        logSegments[activeSegment].bytes += dataLen;
+        logStats.fileWrites++;
+        unflushedLogs = true;
+    }
+
+    inline bool isLiveClient(uint8_t i)
+    {
+        return clientIsConnected(i) && connectedClients[i].authed && !connectedClients[i].replaying;
+    }
+
+    /**
+     * Queues the frame for the client, a full queue is handled by the queue policy.
+     */
+    inline void queueFrame(ConnectedClient &client, const LogFrame &frame)
+    {
+        if (client.queue.push((const uint8_t*) messageBuffer, frame.len, frame.entries))
+        {
+            return;
+        }
+
+        if (queuePolicy == QUEUE_DISCONNECT)
+        {
+            logStats.clientDisconnects++;
+            removeClient(client.id);
+            return;
+        }
+
+        if (queuePolicy == QUEUE_DROP_OLDEST)
+        {
+            while (!client.queue.empty())
+            {
+                logStats.clientDroppedLines += client.queue.dropOldest();
+                logStats.clientDroppedFrames++;
+
+                if (client.queue.push((const uint8_t*) messageBuffer, frame.len, frame.entries))
+                {
+                    return;
+                }
+            }
+        }
+
+        client.queue.addGap(frame.entries);
+        logStats.clientDroppedLines += frame.entries;
+        logStats.clientDroppedFrames++;
+    }
+
+    inline void sendGap(ConnectedClient &client, uint32_t lines)
+    {
+        uint8_t gap[1 + sizeof(lines)]{GAP};
+        memcpy(gap + 1, &lines, sizeof(lines));
+        server.sendBIN(client.id, gap, sizeof(gap));
+        client.sentBytes += sizeof(gap);
+    }
+
+    /**
+     * Sends the queued frames of the client that fit in its window, and the gap markers before them.
+     */
+    inline void flushClient(ConnectedClient &client)
+    {
+        ClientQueue::Entry entry;
+        while (client.queue.peek(entry)
+            && client.sentBytes - client.ackedBytes + entry.len + (entry.gapBefore > 0 ? 1 + sizeof(uint32_t) : 0)
+               <= ESP_CONP_LOG_CLIENT_WINDOW)
+        {
+            if (entry.gapBefore > 0)
+            {
+                sendGap(client, entry.gapBefore);
+            }
+
+            ESP_CONP_MEASURE(ESP_CONFIG_PAGE::wsSendLatency);
+            client.queue.pop((uint8_t*) messageBuffer);
+            server.sendBIN(client.id, (uint8_t*) messageBuffer, entry.len);
+            client.sentBytes += entry.len;
+        }
+
+        if (client.queue.empty() && client.sentBytes - client.ackedBytes + 1 + sizeof(uint32_t) <= ESP_CONP_LOG_CLIENT_WINDOW)
+        {
+            const uint32_t lines = client.queue.takeGap();
+            if (lines > 0)
+            {
+                sendGap(client, lines);
+            }
+        }
+    }
+
+    /**
+     * Queues the LOG frame for the live clients with the subscription, or without filters for nullptr, and appends the
+     * unfiltered frames to the retention.
+     */
+    inline void sendLogFrame(LogFrame &frame, const LogSubscription *subscription)
+    {
+        finishFrame(frame);
+        logStats.frames++;
+
+        for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+        {
+            if (isLiveClient(i) && (subscription == nullptr
+                                        ? !isFiltering(connectedClients[i].subscription)
+                                        : sameSubscription(connectedClients[i].subscription, *subscription)))
+            {
+                queueFrame(connectedClients[i], frame);
+            }
+        }
+
+        if (subscription == nullptr && retentionEnabled)
+        {
+            writeLogEntries(frame);
+        }
+    }
+
+    /**
+     * Appends the format to a FORMATS frame, its id as 4 bytes, the signature, the tag and the format, each ended by a 0.
+     * @return false if it does not fit.
+     */
+    inline bool appendFormat(LogFrame &frame, uint32_t id, const char *signature, const char *tag, const char *format)
+    {
+        const size_t signatureLen = strlen(signature) + 1;
+        const size_t tagLen = strlen(tag) + 1;
+        const size_t formatLen = strlen(format) + 1;
+        if (frame.len + sizeof(id) + signatureLen + tagLen + formatLen > sizeof(messageBuffer))
+        {
+            return false;
+        }
+
+        memcpy(messageBuffer + frame.len, &id, sizeof(id));
+        frame.len += sizeof(id);
+        memcpy(messageBuffer + frame.len, signature, signatureLen);
+        frame.len += signatureLen;
+        memcpy(messageBuffer + frame.len, tag, tagLen);
+        frame.len += tagLen;
+        memcpy(messageBuffer + frame.len, format, formatLen);
+        frame.len += formatLen;
+        frame.entries++;
+        return true;
+    }
+
+    /**
+     * Sends a FORMATS frame to the client, or to every authed one when clientId is negative.
+     */
+    inline void sendFormatFrame(int clientId, const LogFrame &frame)
+    {
+        for (uint8_t i = 0; i < MAX_CLIENTS && clientId < 0; i++)
+        {
+            if (clientIsConnected(i) && connectedClients[i].authed)
+            {
+                sendFrame(connectedClients[i].id, frame);
+            }
+        }
+
+        if (clientId >= 0)
+        {
+            sendFrame(clientId, frame);
+        }
+    }
+
+    /**
+     * Sends the formats registered since the last call to the clients and saves them with the retention, so records
+     * always reach a client after their format.
+     */
+    inline void announceFormats()
+    {
+        LogFormat *newest = registeredFormats.load(std::memory_order_acquire);
+        if (newest == announcedFormats)
+        {
+            return;
+        }
+
+        File formatFile;
+        LogFrame frame = beginFrame(FORMATS, 0);
+        frame.len = 1;
+
+        for (LogFormat *format = newest; format != announcedFormats; format = format->next)
+        {
+            bool fits = appendFormat(frame, format->id, format->signature, format->tag, format->format);
+            if (!fits && frame.len > 1)
+            {
+                sendFormatFrame(-1, frame);
+                frame.len = 1;
+                fits = appendFormat(frame, format->id, format->signature, format->tag, format->format);
+            }
+
+            // Formats longer than a frame are left out of the frames and the file, their records show as unknown
+            KnownFormat *known = addKnownFormat(format->id, format->tagHash);
+            if (retentionEnabled && fits && known != nullptr && !known->saved)
+            {
+                if (!formatFile)
+                {
+                    formatFile = LittleFS.open(formatFilePath(), "a");
+                }
+
+                size_t written = 0;
+                const size_t entryLen = strlen(format->signature) + strlen(format->tag) + strlen(format->format) + 3;
+                if (formatFile && formatFile.write((const uint8_t*) &format->id, sizeof(uint32_t)) == sizeof(uint32_t))
+                {
+                    written += formatFile.write((const uint8_t*) format->signature, strlen(format->signature) + 1);
+                    written += formatFile.write((const uint8_t*) format->tag, strlen(format->tag) + 1);
+                    written += formatFile.write((const uint8_t*) format->format, strlen(format->format) + 1);
+                }
+                known->saved = written == entryLen;
+            }
+        }
+
+        if (frame.len > 1)
+        {
+            sendFormatFrame(-1, frame);
+        }
+        announcedFormats = newest;
+    }
+
+    /**
+     * Sends every known format to the client, the saved ones when the retention is enabled, which include the formats
+     * of records from before the last restart.
+     */
+    inline void sendFormats(uint8_t clientId)
+    {
+        LogFrame frame = beginFrame(FORMATS, 0);
+        frame.len = 1;
+
+        if (!retentionEnabled)
+        {
+            for (LogFormat *format = announcedFormats; format != nullptr; format = format->next)
+            {
+                if (!appendFormat(frame, format->id, format->signature, format->tag, format->format) && frame.len > 1)
+                {
+                    sendFormatFrame(clientId, frame);
+                    frame.len = 1;
+                    appendFormat(frame, format->id, format->signature, format->tag, format->format);
+                }
+            }
+        }
+        else
+        {
+            File file = LittleFS.open(formatFilePath(), "r");
+            size_t offset = 0;
+            while (file && file.seek(offset))
+            {
+                const size_t read = file.read((uint8_t*) messageBuffer + 1, sizeof(messageBuffer) - 1);
+
+                // Whole entries only, an entry is the id and three strings
+                size_t end = 1;
+                for (size_t i = 1 + sizeof(uint32_t), strings = 0; i < 1 + read; i++)
+                {
+                    if (messageBuffer[i] == 0 && ++strings == 3)
+                    {
+                        end = i + 1;
+                        strings = 0;
+                        i += sizeof(uint32_t);
+                    }
+                }
 
-    enum EventType
-    {
-        AUTH = 'A',
-        LOG = 'l',
-        ALL_LOGS = 'L',
-        ERROR = 'E',
-        PING = 'P',
-        PONG = 'p'
-    };
+                if (end == 1)
+                {
+                    break;
+                }
 
-    struct ConnectedClient
-    {
-        int id = -1;
-        unsigned long connectedTime = 0;
-        bool authed = false;
-    };
+                frame.len = end;
+                sendFormatFrame(clientId, frame);
+                offset += end - 1;
+            }
 
-    ConnectedClient connectedClients[MAX_CLIENTS];
+            frame.len = 1;
+        }
 
-    inline bool clientIsConnected(int i)
-    {
-        return connectedClients[i].id >= 0;
+        if (frame.len > 1)
+        {
+            sendFormatFrame(clientId, frame);
+        }
     }
 
-    inline bool removeClient(uint8_t id)
+    /**
+     * Builds the LOG frames of the lines from begin to end for the clients with the subscription, or for the clients
+     * without filters and the retention for nullptr. The lines of each frame are filtered before it is built.
+     * @return number of lines from begin to end.
+     */
+    inline uint32_t drainLines(uint32_t begin, uint32_t end, const LogSubscription *subscription)
     {
-        for (size_t i = 0; i < MAX_CLIENTS; i++)
+        bool needed = subscription != nullptr || retentionEnabled;
+        for (uint8_t i = 0; i < MAX_CLIENTS && !needed; i++)
         {
-            if (connectedClients[i].id == id)
+            needed = isLiveClient(i) && !isFiltering(connectedClients[i].subscription);
+        }
+
+        uint32_t count = 0;
+        LogFrame frame = beginFrame(LOG, nextSeq);
+        for (uint32_t position = begin; position != end; count++)
+        {
+            const uint16_t header = logBuffer.header(position);
+            const size_t size = header & LOG_ENTRY_LENGTH;
+            const uint32_t next = LogRingBuffer::next(position, header);
+            if (!needed)
             {
-                connectedClients[i].id = -1;
+                position = next;
+                continue;
+            }
 
-                if (server.clientIsConnected(id))
+            uint8_t record[LOG_RECORD_HEADER]{};
+            if (subscription != nullptr)
+            {
+                logBuffer.read(position, record, min(size, sizeof(record)));
+                if (!acceptsEntry(*subscription, header, record))
                 {
-                    server.disconnect(id);
+                    frame.skipped++;
+                    position = next;
+                    continue;
                 }
-                return true;
             }
+
+            if (!entryFits(frame, size))
+            {
+                sendLogFrame(frame, subscription);
+                frame = beginFrame(LOG, nextSeq + count);
+            }
+
+            logBuffer.read(position, addEntry(frame, header), size);
+            position = next;
         }
 
-        return false;
+        if (frame.entries > 0)
+        {
+            sendLogFrame(frame, subscription);
+        }
+        return count;
     }
 
-    inline int registerClient(uint8_t id)
+    /**
+     * Moves the lines written until now from the buffer to the clients and the retention, as many lines per frame
+     * as fit in it. Each different subscription of the live clients gets its own frames.
+     */
+    inline void drainLogs()
     {
-        for (size_t i = 0; i < MAX_CLIENTS; i++)
+        // Formats are registered before their first record is written, so every record up to end has its format
+        const uint32_t end = logBuffer.end();
+        announceFormats();
+
+        const uint32_t begin = logBuffer.begin();
+        if (begin == end)
         {
-            if (connectedClients[i].id < 0)
+            return;
+        }
+
+        const uint32_t count = drainLines(begin, end, nullptr);
+        for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+        {
+            const LogSubscription &subscription = connectedClients[i].subscription;
+            bool first = isLiveClient(i) && isFiltering(subscription);
+            for (uint8_t j = 0; j < i && first; j++)
             {
-                connectedClients[i].id = id;
-                connectedClients[i].authed = false;
-                connectedClients[i].connectedTime = millis();
-                return i;
+                first = !isLiveClient(j) || !sameSubscription(connectedClients[j].subscription, subscription);
+            }
+
+            if (first)
+            {
+                drainLines(begin, end, &subscription);
             }
         }
 
-        return -1;
+        nextSeq += count;
+        logBuffer.release(end);
     }
 
-    inline void sendMessage(uint8_t clientId, const char *message, const size_t len, bool isText, EventType eventType)
+    /**
+     * Reads the header of the retention entry at offset.
+     * @return false at the end of the segment or if the entry is cut.
+     */
+    inline bool readEntryHeader(File &file, size_t offset, uint16_t &header)
     {
-        messageBuffer[0] = eventType;
-        memcpy(messageBuffer+1, message, len);
+        return file.seek(offset) && file.read((uint8_t*) &header, LOG_ENTRY_HEADER) == LOG_ENTRY_HEADER &&
+            offset + LOG_ENTRY_HEADER + (header & LOG_ENTRY_LENGTH) <= file.size();
+    }
 
-        if (isText)
+    /**
+     * Finds the retained line seq, or the oldest one if it is not retained anymore.
+     * @return false if there are no retained lines from seq on.
+     */
+    inline bool findReplayStart(ConnectedClient &client)
+    {
+        // From the oldest segment to the newest one
+        int8_t found = -1;
+        for (uint8_t i = 1; i <= ESP_CONP_LOG_SEGMENTS && found < 0; i++)
         {
-            server.sendTXT(clientId, messageBuffer, len+1);
+            const uint8_t s = (activeSegment + i) % ESP_CONP_LOG_SEGMENTS;
+            const LogSegment &segment = logSegments[s];
+            if (!segment.exists || segment.lines == 0)
+            {
+                continue;
+            }
+
+            // Lines before the segment were cleared already, the replay goes on from the oldest retained one
+            if (client.replaySeq < segment.firstSeq)
+            {
+                client.replaySeq = segment.firstSeq;
+            }
+
+            if (client.replaySeq < segment.firstSeq + segment.lines)
+            {
+                found = s;
+            }
         }
-        else
+
+        if (found < 0)
         {
-            server.sendBIN(clientId, (uint8_t*) messageBuffer, len+1);
+            return false;
         }
-    }
 
-    inline void sendMessage(uint8_t clientId, const char *message, EventType eventType)
-    {
-        sendMessage(clientId, message, strlen(message), true, eventType);
+        const LogSegment &segment = logSegments[found];
+        client.replaySegment = found;
+        client.replaySegmentSeq = segment.firstSeq;
+        client.replayOffset = segmentHeaderSize(segment.firstSeq);
+
+        uint32_t skip = client.replaySeq - segment.firstSeq;
+        if (skip == 0)
+        {
+            return true;
+        }
+
+        File file = LittleFS.open(segmentPath(found), "r");
+        for (uint16_t header; skip > 0; skip--)
+        {
+            if (!file || !readEntryHeader(file, client.replayOffset, header))
+            {
+                return false;
+            }
+            client.replayOffset += LOG_ENTRY_HEADER + (header & LOG_ENTRY_LENGTH);
+        }
+
+        return true;
     }
 
-    inline void broadcastMessage(const char *message, const size_t len, bool isText, EventType eventType)
+    /**
+     * Queues the next replay chunk for the client, at most a frame of retained lines from its replaySeq that pass its
+     * filters, in an ALL_LOGS frame. The ALL_LOGS frame without lines ends the replay, the client gets the live frames
+     * from its sequence number on.
+     */
+    inline void replayLogs(ConnectedClient &client)
     {
-        for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+        bool found = retentionEnabled && client.replaySeq < nextSeq;
+        if (found && (client.replaySegment < 0 || logSegments[client.replaySegment].firstSeq != client.replaySegmentSeq))
         {
-            if (clientIsConnected(i) && connectedClients[i].authed)
+            found = findReplayStart(client);
+        }
+
+        const LogSegment *segment = found ? &logSegments[client.replaySegment] : nullptr;
+        if (found && client.replaySeq >= segment->firstSeq + segment->lines)
+        {
+            // The segment was sent, the next one starts where it ended
+            client.replaySegment = -1;
+            found = findReplayStart(client);
+            segment = found ? &logSegments[client.replaySegment] : nullptr;
+        }
+
+        if (!found)
+        {
+            client.replaying = false;
+            client.replaySeq = nextSeq;
+            queueFrame(client, beginFrame(ALL_LOGS, nextSeq));
+            return;
+        }
+
+        if (client.replaySegment == activeSegment && unflushedLogs && logFile)
+        {
+            logFile.flush();
+            logStats.fileFlushes++;
+            unflushedLogs = false;
+            lastFlush = millis();
+        }
+
+        // Filtered out lines are read but not sent, the bytes read are bounded too
+        File file = LittleFS.open(segmentPath(client.replaySegment), "r");
+        const uint32_t segmentEnd = segment->firstSeq + segment->lines;
+        size_t read = 0;
+        LogFrame frame = beginFrame(ALL_LOGS, client.replaySeq);
+        uint16_t header;
+        while (read < 4 * sizeof(messageBuffer) && client.replaySeq < segmentEnd)
+        {
+            if (!file || !readEntryHeader(file, client.replayOffset, header))
             {
-                sendMessage(connectedClients[i].id, message, len, isText, eventType);
+                // Unreadable or cut segment, its remaining lines are skipped
+                frame.skipped += segmentEnd - client.replaySeq;
+                client.replaySeq = segmentEnd;
+                break;
+            }
+
+            const size_t size = header & LOG_ENTRY_LENGTH;
+            uint8_t record[LOG_RECORD_HEADER]{};
+            const size_t recordSize = min(size, sizeof(record));
+            file.read(record, recordSize);
+
+            if (!acceptsEntry(client.subscription, header, record))
+            {
+                frame.skipped++;
+            }
+            else
+            {
+                if (!entryFits(frame, size))
+                {
+                    // The line starts the next chunk
+                    break;
+                }
+
+                uint8_t *line = addEntry(frame, header);
+                memcpy(line, record, recordSize);
+                file.read(line + recordSize, size - recordSize);
             }
+
+            read += LOG_ENTRY_HEADER + size;
+            client.replayOffset += LOG_ENTRY_HEADER + size;
+            client.replaySeq++;
+        }
+
+        if (frame.entries > 0)
+        {
+            finishFrame(frame);
+            queueFrame(client, frame);
         }
+
+        // Ends the replay right away once it caught up, before more lines are drained
+        if (client.replaySeq >= nextSeq)
+        {
+            replayLogs(client);
+        }
+    }
+
+    inline const LogStats &getLogStats()
+    {
+        return logStats;
     }
 
     /**
-     * Custom serial class, will send all printed text to the connected logging websockets client.
+     * Custom serial class, will send all printed text to the connected logging websockets client. Writes only copy the
+     * text to a buffer, ESP_CONFIG_PAGE_LOGGING::loop() sends it and saves it to the retention file.
      */
     class ConfigPageSerial : public SERIAL_T
     {
@@ -140,26 +1652,31 @@ namespace ESP_CONFIG_PAGE_LOGGING
 
         size_t write(const uint8_t* buffer, size_t size) override
         {
-            if (!isLoggingEnabled || (size == 2 && buffer[0] == '\r' && buffer[1] == '\n') || (size == 1 && buffer[0] ==
-                '\n'))
+            if (!isLoggingEnabled)
             {
                 return SERIAL_T::write(buffer, size);
             }
 
-            broadcastMessage((char*) buffer, size, true, LOG);
-
-            if (retentionEnabled && logFile && logFile.size() >= maximumSizeBytes)
+            // One buffer entry per line, without the line endings and the empty lines
+            size_t lineStart = 0;
+            for (size_t i = 0; i <= size; i++)
             {
-                logFile.close();
-                LittleFS.remove(logFilePath);
-                logFile = LittleFS.open(logFilePath, "a");
-            }
+                if (i < size && buffer[i] != '\n')
+                {
+                    continue;
+                }
 
-            if (retentionEnabled && logFile)
-            {
-                logFile.write(buffer, size);
-                logFile.print('\n');
-                logFile.flush();
+                size_t lineEnd = i;
+                while (lineEnd > lineStart && buffer[lineEnd - 1] == '\r')
+                {
+                    lineEnd--;
+                }
+
+                if (lineEnd > lineStart)
+                {
+                    logBuffer.push(buffer + lineStart, lineEnd - lineStart);
+                }
+                lineStart = i + 1;
             }
 
             return SERIAL_T::write(buffer, size);
@@ -199,7 +1716,7 @@ namespace ESP_CONFIG_PAGE_LOGGING
             else if (type == WStype_TEXT || type == WStype_BIN)
             {
                 char eventType = payload[0];
-                const char *payloadWithoutEvent = (const char*) (length == 0 ? payload : payload+1);
+                char *payloadWithoutEvent = (char*) (length == 0 ? payload : payload+1);
                 const size_t lengthWithoutEvent = length == 0 ? 0 : length-1;
 
                 switch (eventType)
@@ -208,16 +1725,8 @@ namespace ESP_CONFIG_PAGE_LOGGING
                     {
                         LOGF("Client auth request: %d\n", client);
 
-                        char *separator = strchr(payloadWithoutEvent, ':');
-                        if (separator == nullptr)
-                        {
-                            sendMessage(client, "Invalid auth", ERROR);
-                            return;
-                        }
-
-                        separator[0] = 0;
-                        char *sentPass = separator+1;
-                        if (strcmp(payloadWithoutEvent, username.c_str()) != 0 || strcmp(sentPass, password.c_str()))
+                        if (!ESP_CONFIG_PAGE::validateWsCredentials(payloadWithoutEvent, lengthWithoutEvent, username, password,
+                                                               (uint32_t) server.remoteIP(client)))
                         {
                             sendMessage(client, "Invalid auth", ERROR);
                             return;
@@ -227,8 +1736,21 @@ namespace ESP_CONFIG_PAGE_LOGGING
                         {
                             if (connectedClients[i].id == client)
                             {
+                                if (!connectedClients[i].queue.allocate())
+                                {
+                                    sendMessage(client, "out of memory", ERROR);
+                                    removeClient(client);
+                                    return;
+                                }
+
+                                // The reply tells the window the client acknowledges its frames in
+                                char window[12];
+                                snprintf(window, sizeof(window), "%u", (unsigned) ESP_CONP_LOG_CLIENT_WINDOW);
                                 connectedClients[i].authed = true;
-                                sendMessage(client, "", AUTH);
+                                connectedClients[i].sentBytes = 0;
+                                connectedClients[i].ackedBytes = 0;
+                                sendMessage(client, window, AUTH);
+                                sendFormats(client);
                                 return;
                             }
                         }
@@ -238,24 +1760,62 @@ namespace ESP_CONFIG_PAGE_LOGGING
                     }
                 case ALL_LOGS:
                     {
-                        // if (retentionEnabled)
-                        // {
-                        //     retentionEnabled = false;
-                        //     logFile.close();
-                        //
-                        //     File file = LittleFS.open(logFilePath, "r");
-                        //     char buf[file.size()+1]{};
-                        //     file.readBytes(buf, sizeof(buf)-1);
-                        //     file.close();
-                        //
-                        //     sendMessage(client, buf, ALL_LOGS);
-                        //     logFile = LittleFS.open(logFilePath, "a");
-                        //     retentionEnabled = true;
-                        // }
-                        // else
-                        // {
-                        sendMessage(client, "", ALL_LOGS);
-                        // }
+                        // Payload is the sequence number of the first line wanted, empty for every retained line
+                        for (size_t i = 0; i < MAX_CLIENTS; i++)
+                        {
+                            if (connectedClients[i].id == client && connectedClients[i].authed)
+                            {
+                                char seq[12]{};
+                                memcpy(seq, payloadWithoutEvent, min(lengthWithoutEvent, sizeof(seq) - 1));
+                                const uint32_t from = strtoul(seq, nullptr, 10);
+
+                                // Numbers ahead of the device are from before a restart without retention
+                                connectedClients[i].replaySeq = from <= nextSeq ? from : 0;
+                                connectedClients[i].replaySegment = -1;
+                                connectedClients[i].replaying = true;
+                                return;
+                            }
+                        }
+
+                        sendMessage(client, "unknown client", ERROR);
+                        break;
+                    }
+                case SUBSCRIBE:
+                    {
+                        // Applies to the lines drained and replayed from now on
+                        for (size_t i = 0; i < MAX_CLIENTS; i++)
+                        {
+                            if (connectedClients[i].id == client && connectedClients[i].authed)
+                            {
+                                parseSubscription(payloadWithoutEvent, lengthWithoutEvent, connectedClients[i].subscription);
+                                return;
+                            }
+                        }
+
+                        sendMessage(client, "unknown client", ERROR);
+                        break;
+                    }
+                case ACK:
+                    {
+                        for (size_t i = 0; i < MAX_CLIENTS; i++)
+                        {
+                            if (connectedClients[i].id == client && connectedClients[i].authed)
+                            {
+                                char bytes[12]{};
+                                memcpy(bytes, payloadWithoutEvent, min(lengthWithoutEvent, sizeof(bytes) - 1));
+                                const uint32_t acked = strtoul(bytes, nullptr, 10);
+
+                                // Counts wrap around, bytes that were never sent are ignored
+                                ConnectedClient &connectedClient = connectedClients[i];
+                                if (acked - connectedClient.ackedBytes <= connectedClient.sentBytes - connectedClient.ackedBytes)
+                                {
+                                    connectedClient.ackedBytes = acked;
+                                }
+                                return;
+                            }
+                        }
+
+                        sendMessage(client, "unknown client", ERROR);
                         break;
                     }
                 case PING:
@@ -282,21 +1842,45 @@ namespace ESP_CONFIG_PAGE_LOGGING
         {
             server.close();
             isLoggingEnabled = false;
+            logBuffer.clear();
         }
     }
 
     inline void loop()
     {
+        ESP_CONP_MEASURE(ESP_CONFIG_PAGE::loggingLoopLatency);
         server.loop();
+        drainLogs();
 
-        if (millis() - lastClean > 2000)
+        for (uint8_t i = 0; i < MAX_CLIENTS; i++)
         {
-            // broadcastMessage("P", 1, true, PING);
+            // A replay chunk is only read once the queue can take it, so replays never drop lines
+            if (clientIsConnected(i) && connectedClients[i].replaying
+                && connectedClients[i].queue.freeBytes() >= 2 * (ESP_CONP_LOG_FRAME_SIZE + sizeof(ClientQueue::Entry)))
+            {
+                replayLogs(connectedClients[i]);
+            }
+
+            if (clientIsConnected(i) && connectedClients[i].authed)
+            {
+                flushClient(connectedClients[i]);
+            }
+        }
 
+        if (unflushedLogs && millis() - lastFlush >= ESP_CONP_LOG_FLUSH_MS)
+        {
             if (retentionEnabled && logFile)
             {
                 logFile.flush();
+                logStats.fileFlushes++;
             }
+            unflushedLogs = false;
+            lastFlush = millis();
+        }
+
+        if (millis() - lastClean > 2000)
+        {
+            // broadcastMessage("P", 1, true, PING);
 
             for (uint8_t i = 0; i < MAX_CLIENTS; i++)
             {
@@ -311,18 +1895,129 @@ namespace ESP_CONFIG_PAGE_LOGGING
     }
 
     /**
-     * Enables log retention policy in a LittleFS file. If the maximum size is exceeded the file will be cleared and recreated.
+     * Sets what happens to the frames for a client whose queue is full, the oldest ones are dropped by default.
+     */
+    inline void setLogQueuePolicy(LogQueuePolicy policy)
+    {
+        queuePolicy = policy;
+    }
+
+    /**
+     * Enables log retention in LittleFS files. The logs are split in ESP_CONP_LOG_SEGMENTS files named filePath.0,
+     * filePath.1 and so on, when the newest one is full the oldest one is cleared and written next, so at least
+     * (segments - 1) / segments of the maximum size is always kept. Lines are numbered across restarts, clients replay
+     * them from the number they last got with the ALL_LOGS event. The formats of binary records are kept in
+     * filePath.fmt.
      *
-     * @param filePath File to save logs
-     * @param logFileMaxSizeBytes Maximum log file size in bytes
+     * @param filePath Path the segment files are named after
+     * @param logFileMaxSizeBytes Maximum size of all the segments in bytes
      */
     inline void setLogRetention(String filePath, unsigned int logFileMaxSizeBytes)
     {
         logFilePath = filePath;
-        logFile = LittleFS.open(filePath, "a");
         maximumSizeBytes = logFileMaxSizeBytes;
+        segmentSizeBytes = max(logFileMaxSizeBytes / ESP_CONP_LOG_SEGMENTS, (unsigned int) ESP_CONP_LOG_FRAME_SIZE);
+
+        // Single file of the retention before segments
+        if (LittleFS.exists(filePath))
+        {
+            LittleFS.remove(filePath);
+        }
+
+        bool anyExists = false;
+        for (uint8_t i = 0; i < ESP_CONP_LOG_SEGMENTS; i++)
+        {
+            LogSegment &segment = logSegments[i];
+            segment = {};
+
+            File file = LittleFS.open(segmentPath(i), "r");
+            char header[16]{};
+            if (!file || file.readBytesUntil('\n', header, sizeof(header) - 1) == 0 || header[0] != '@')
+            {
+                continue;
+            }
+
+            segment.exists = true;
+            segment.firstSeq = strtoul(header + 1, nullptr, 10);
+            segment.bytes = file.size();
+            if (!anyExists || segment.firstSeq >= logSegments[activeSegment].firstSeq)
+            {
+                activeSegment = i;
+            }
+            anyExists = true;
+        }
+
+        // Only the newest segment is counted, the others end where the segment after them starts
+        bool cut = false;
+        for (uint8_t i = 0; i < ESP_CONP_LOG_SEGMENTS; i++)
+        {
+            LogSegment &segment = logSegments[i];
+            const LogSegment &next = logSegments[(i + 1) % ESP_CONP_LOG_SEGMENTS];
+            if (!segment.exists)
+            {
+                continue;
+            }
+
+            if (i != activeSegment && next.exists && next.firstSeq >= segment.firstSeq)
+            {
+                segment.lines = next.firstSeq - segment.firstSeq;
+                continue;
+            }
+
+            File file = LittleFS.open(segmentPath(i), "r");
+            size_t offset = segmentHeaderSize(segment.firstSeq);
+            for (uint16_t header; readEntryHeader(file, offset, header);)
+            {
+                offset += LOG_ENTRY_HEADER + (header & LOG_ENTRY_LENGTH);
+                segment.lines++;
+            }
+            cut = cut || (i == activeSegment && offset != segment.bytes);
+        }
+
+        File formatFile = LittleFS.open(formatFilePath(), "r");
+        for (uint32_t id; formatFile && formatFile.read((uint8_t*) &id, sizeof(id)) == sizeof(id);)
+        {
+            // Signature, tag and format
+            formatFile.readBytesUntil(0, messageBuffer, sizeof(messageBuffer));
+            const size_t tagLength = formatFile.readBytesUntil(0, messageBuffer, sizeof(messageBuffer));
+            KnownFormat *known = addKnownFormat(id, ESP_CONFIG_PAGE::fnv1aHash(messageBuffer, tagLength));
+            formatFile.readBytesUntil(0, messageBuffer, sizeof(messageBuffer));
+
+            if (known != nullptr)
+            {
+                known->saved = true;
+            }
+        }
+        formatFile.close();
+        // Formats announced before are saved with the next drain
+        announcedFormats = nullptr;
+
+        if (anyExists)
+        {
+            nextSeq = logSegments[activeSegment].firstSeq + logSegments[activeSegment].lines;
+            logFile = LittleFS.open(segmentPath(activeSegment), "a");
+        }
+
+        // The last entry of a cut segment would be read as the start of the next appended one
+        if (!anyExists || cut)
+        {
+            if (!anyExists)
+            {
+                activeSegment = ESP_CONP_LOG_SEGMENTS - 1;
+            }
+            rotateSegment(nextSeq);
+        }
+
         retentionEnabled = true;
     }
+
+    /**
+     * @return the segment files of the log retention, first sequence number and line count of each one.
+     */
+    inline const LogSegment *getLogSegments()
+    {
+        return logSegments;
+    }
 }
 
 #endif //DX_ESP_CONFIG_PAGE_LOGGING_H
@@ -0,0 +1,122 @@
+#ifndef ESP_CONFIG_PAGE_METRICS_H
+#define ESP_CONFIG_PAGE_METRICS_H
+
+#include "Arduino.h"
+
+// Latency histograms served at /config/metrics, define ESP_CONP_METRICS as 0 to compile all of it out
+#ifndef ESP_CONP_METRICS
+#define ESP_CONP_METRICS 1
+#endif
+
+#if ESP_CONP_METRICS
+#define ESP_CONP_MEASURE_CONCAT(a, b) a##b
+#define ESP_CONP_MEASURE_NAME(line) ESP_CONP_MEASURE_CONCAT(espConpLatencyTimer, line)
+/**
+ * Records the time until the end of the enclosing scope in the histogram.
+ */
+#define ESP_CONP_MEASURE(histogram) ESP_CONFIG_PAGE::LatencyTimer ESP_CONP_MEASURE_NAME(__LINE__)(histogram)
+#else
+#define ESP_CONP_MEASURE(histogram)
+#endif
+
+#if ESP_CONP_METRICS
+namespace ESP_CONFIG_PAGE
+{
+    // Upper bounds of the latency buckets, in microseconds and as Prometheus "le" labels, the last bucket is +Inf
+    constexpr uint32_t latencyBuckets[] = {100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000};
+    constexpr const char *latencyBucketLabels[] = {"0.0001", "0.0005", "0.001", "0.005", "0.01", "0.05", "0.1", "0.5", "1", "+Inf"};
+    constexpr uint8_t LATENCY_BUCKET_COUNT = sizeof(latencyBuckets) / sizeof(latencyBuckets[0]) + 1;
+
+    struct LatencyHistogram
+    {
+        uint32_t buckets[LATENCY_BUCKET_COUNT];
+        uint32_t count;
+        uint64_t sumMicros;
+
+        void record(uint32_t elapsed)
+        {
+            uint8_t i = 0;
+            while (i < LATENCY_BUCKET_COUNT - 1 && elapsed > latencyBuckets[i])
+            {
+                i++;
+            }
+
+            buckets[i]++;
+            count++;
+            sumMicros += elapsed;
+        }
+    };
+
+    class LatencyTimer
+    {
+    public:
+        explicit LatencyTimer(LatencyHistogram &histogram) : histogram(histogram), start(micros())
+        {
+        }
+
+        ~LatencyTimer()
+        {
+            histogram.record((uint32_t) micros() - start);
+        }
+
+    private:
+        LatencyHistogram &histogram;
+        const uint32_t start;
+    };
+
+    LatencyHistogram flashWriteLatency{};
+    LatencyHistogram otaWriteLatency{};
+    LatencyHistogram wsSendLatency{};
+    LatencyHistogram loggingLoopLatency{};
+    LatencyHistogram envRestoreLatency{};
+    LatencyHistogram attributeRestoreLatency{};
+
+    /**
+     * Writes the histogram in the Prometheus text format, labels are the ones inside the braces, e.g. route="/config".
+     */
+    inline void printHistogram(Print &out, const char *name, const char *labels, const LatencyHistogram &histogram)
+    {
+        uint32_t cumulative = 0;
+        for (uint8_t i = 0; i < LATENCY_BUCKET_COUNT; i++)
+        {
+            cumulative += histogram.buckets[i];
+            out.print(name);
+            out.print("_bucket{");
+            out.print(labels);
+            out.print(labels[0] != 0 ? ",le=\"" : "le=\"");
+            out.print(latencyBucketLabels[i]);
+            out.print("\"} ");
+            out.print(cumulative);
+            out.print('\n');
+        }
+
+        char sum[24];
+        snprintf(sum, sizeof(sum), "%lu.%06lu", (unsigned long) (histogram.sumMicros / 1000000), (unsigned long) (histogram.sumMicros % 1000000));
+
+        out.print(name);
+        out.print("_sum{");
+        out.print(labels);
+        out.print("} ");
+        out.print(sum);
+        out.print('\n');
+
+        out.print(name);
+        out.print("_count{");
+        out.print(labels);
+        out.print("} ");
+        out.print(histogram.count);
+        out.print('\n');
+    }
+
+    inline void printMetricType(Print &out, const char *name, const char *type)
+    {
+        out.print("# TYPE ");
+        out.print(name);
+        out.print(' ');
+        out.print(type);
+        out.print('\n');
+    }
+}
+#endif
+
+#endif //ESP_CONFIG_PAGE_METRICS_H
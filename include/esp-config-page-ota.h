@@ -11,6 +11,11 @@
 #include <md5.h>
 #endif
 
+#ifdef ESP32_CONP_OTA_USE_WEBSOCKETS
+#include <WebSocketsServer.h>
+#include "esp-config-page-ws-client.h"
+#endif
+
 #ifdef ESP32_CONFIG_PAGE_USE_ESP_IDF_OTA
 #include <esp_ota_ops.h>
 #include <esp_partition.h>
@@ -64,8 +69,13 @@ namespace ESP_CONFIG_PAGE
 
 
 #ifdef ESP32_CONP_OTA_USE_WEBSOCKETS
+// How often the OTA socket is checked for new clients while no client is connected
+#ifndef ESP_CONP_OTA_WS_IDLE_POLL_MS
+#define ESP_CONP_OTA_WS_IDLE_POLL_MS 50
+#endif
+
     WebSocketsServer otaWsServer(ESP32_CONP_OTA_WS_PORT);
-    ESP_CONFIG_PAGE_LOGGING::ConnectedClient *otaClient = nullptr;
+    WsClient *otaClient = nullptr;
     unsigned long lastWsServerUpdate = 0;
 #endif
 
@@ -148,7 +158,7 @@ namespace ESP_CONFIG_PAGE
             otaClient = nullptr;
         }
 
-        otaClient = new ESP_CONFIG_PAGE_LOGGING::ConnectedClient(id, millis(), false);
+        otaClient = new WsClient{id, millis(), false};
     }
 
     inline void releaseOtaClient()
@@ -173,6 +183,20 @@ namespace ESP_CONFIG_PAGE
     }
 #endif
 
+    /**
+     * A filesystem update already wrote over LittleFS, so pending storage writes are dropped instead of saved on top of it.
+     */
+    inline void otaRestart()
+    {
+        if (isOtaFilesystem)
+        {
+            ESP.restart();
+            return;
+        }
+
+        restart();
+    }
+
     inline void otaAbort()
     {
         if (!otaStarted)
@@ -189,7 +213,7 @@ namespace ESP_CONFIG_PAGE
 #endif
 
         delay(1000);
-        ESP.restart();
+        otaRestart();
     }
 
     inline void sendResponse(const char *status, OtaEventType eventType = SUCCESS)
@@ -197,6 +221,7 @@ namespace ESP_CONFIG_PAGE
 #ifdef ESP32_CONP_OTA_USE_WEBSOCKETS
         char toSend[strlen(status) + 3]{};
         snprintf(toSend, sizeof(toSend), "%c%s", eventType, status);
+        ESP_CONP_MEASURE(wsSendLatency);
         otaWsServer.sendTXT(otaClient->id, toSend);
 #else
         server->send(200, "text/plain", status);
@@ -220,7 +245,9 @@ namespace ESP_CONFIG_PAGE
 
     inline void otaStart(const char *hash)
     {
+#if ESP_CONP_HAS_MODULE(LOGGING)
         ESP_CONFIG_PAGE_LOGGING::disableLogging();
+#endif
         LOGN("OTA upload start.");
 
         if (otaStartCallback)
@@ -320,6 +347,7 @@ namespace ESP_CONFIG_PAGE
 
     inline void otaWrite(uint8_t *buf, size_t bufSize)
     {
+        ESP_CONP_MEASURE(otaWriteLatency);
         otaChecksumWrite(buf, bufSize);
 
 #ifdef ESP32_CONFIG_PAGE_USE_ESP_IDF_OTA
@@ -427,14 +455,12 @@ namespace ESP_CONFIG_PAGE
         sendResponse("Update successful");
         LOGN("OTA update finished, restarting.");
         delay(1000);
-        ESP.restart();
+        otaRestart();
     }
 
 #ifndef ESP32_CONP_OTA_USE_WEBSOCKETS
     inline void handleUpdate(bool filesystem)
     {
-        VALIDATE_AUTH();
-
         HTTPUpload upload = server->upload();
         String md5 = server->arg("md5");
         isOtaFilesystem = filesystem;
@@ -453,6 +479,22 @@ namespace ESP_CONFIG_PAGE
             otaAbort();
         }
     }
+
+    inline void handleFirmwareUpload()
+    {
+        handleUpdate(false);
+    }
+
+    inline void handleFilesystemUpload()
+    {
+        handleUpdate(true);
+    }
+
+    inline void handleUpdateFinished()
+    {
+        otaFinish();
+        LOGN("OTA finished");
+    }
 #endif
 
     inline void enableOtaModule()
@@ -506,20 +548,9 @@ namespace ESP_CONFIG_PAGE
                             otaAbort();
                         }
 
-                        char usernameAndPassword[lengthWithoutEvent+1]{};
-                        memcpy(usernameAndPassword, payloadWithoutEvent, lengthWithoutEvent);
-
-                        char *separator = strchr(usernameAndPassword, ':');
-                        if (separator == nullptr)
-                        {
-                            return;
-                        }
-
-                        separator[0] = 0;
-                        char *password = separator+1;
-
-                        if (strcmp(usernameAndPassword, ESP_CONFIG_PAGE::username.c_str()) != 0 ||
-                            strcmp(password, ESP_CONFIG_PAGE::password.c_str()) != 0)
+                        if (!ESP_CONFIG_PAGE::validateWsCredentials((char*) payloadWithoutEvent, lengthWithoutEvent,
+                                                                ESP_CONFIG_PAGE::username, ESP_CONFIG_PAGE::password,
+                                                                (uint32_t) otaWsServer.remoteIP(clientId)))
                         {
                             sendErrorResponse("", "Invalid auth.");
                             return;
@@ -582,25 +613,7 @@ namespace ESP_CONFIG_PAGE
 
         otaWsServer.begin();
 #else
-        server->on(F("/config/update/firmware"), HTTP_POST, []()
-                   {
-                       VALIDATE_AUTH();
-                       otaFinish();
-                       LOGN("OTA finished");
-                   }, []()
-                   {
-                       handleUpdate(false);
-                   });
-
-        server->on(F("/config/update/filesystem"), HTTP_POST, []()
-                   {
-                       VALIDATE_AUTH();
-                       otaFinish();
-                       LOGN("OTA finished");
-                   }, []()
-                   {
-                       handleUpdate(true);
-                   });
+        enableRoutes(OTA);
 #endif
     }
 
@@ -637,6 +650,36 @@ namespace ESP_CONFIG_PAGE
         }
 #endif
     }
+
+#ifdef ESP32_CONP_OTA_USE_WEBSOCKETS
+    /**
+     * Ticks every loop while a client is connected, the socket needs to be read as fast as the upload comes in.
+     */
+    class OtaModule : public ConfigPageModule
+    {
+    public:
+        const char *name() const override
+        {
+            return "ota";
+        }
+
+        void tick(unsigned long now) override
+        {
+            lastTick = now;
+            otaLoop();
+        }
+
+        unsigned long nextDeadline(unsigned long now) override
+        {
+            return otaClient != nullptr || otaStarted ? now : lastTick + ESP_CONP_OTA_WS_IDLE_POLL_MS;
+        }
+
+    private:
+        unsigned long lastTick = 0;
+    };
+
+    inline OtaModule otaModule;
+#endif
 }
 
 #endif //ESP_CONFIG_PAGE_OTA_H
@@ -1,20 +1,891 @@
 #ifndef ESP_CONFIG_PAGE_SCHEDULING_H
 #define ESP_CONFIG_PAGE_SCHEDULING_H
 
+#include <time.h>
+#include "esp-config-defines.h"
+
+// Levels of the schedule timer wheel, each one covers 64 times the one below: 64 s, ~68 min, ~3 days, ~194 days.
+// Jobs further away wait in the last level and are placed again when it comes around.
+#ifndef ESP_CONP_SCHEDULE_WHEEL_LEVELS
+#define ESP_CONP_SCHEDULE_WHEEL_LEVELS 4
+#endif
+
+#ifndef ESP_CONP_SCHEDULE_MAX_LINE
+#define ESP_CONP_SCHEDULE_MAX_LINE 128
+#endif
+
+// Wall clock times before this (2020-01-01) mean the clock wasn't set yet (no NTP), clock jobs wait for it
+#ifndef ESP_CONP_SCHEDULE_MIN_VALID_TIME
+#define ESP_CONP_SCHEDULE_MIN_VALID_TIME 1577836800
+#endif
+
+#if ESP_CONP_SCHEDULE_WHEEL_LEVELS < 1 || ESP_CONP_SCHEDULE_WHEEL_LEVELS > 5
+#error "ESP_CONP_SCHEDULE_WHEEL_LEVELS must be between 1 and 5."
+#endif
+
 namespace ESP_CONFIG_PAGE
 {
+    KeyValueStorage *schedulingStorage = nullptr;
 
-    KeyValueStorage *schedulingStorage;
+    /**
+     * Entry of a TimerWheel, expiry is in wheel ticks.
+     */
+    struct TimerNode
+    {
+        uint32_t expiry = 0;
+        TimerNode *prev = nullptr;
+        TimerNode *next = nullptr;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+        bool queued = false;
+    };
 
-    inline void enableSchedulingModule()
+    /**
+     * Hierarchical timer wheel with 64 slots per level, each level turning 64 times slower than the one below.
+     * Inserting and removing are O(1) and advance only stops at the ticks where a timer expires or a level cascades.
+     */
+    class TimerWheel
+    {
+    public:
+        static constexpr uint8_t SLOT_BITS = 6;
+        static constexpr uint8_t SLOTS = 1 << SLOT_BITS;
+        static constexpr uint8_t LEVELS = ESP_CONP_SCHEDULE_WHEEL_LEVELS;
+        static constexpr uint32_t HORIZON = (uint32_t) 1 << (SLOT_BITS * LEVELS);
+        static constexpr uint32_t NO_EXPIRY = UINT32_MAX;
+
+        void insert(TimerNode *node)
+        {
+            place(node, node->expiry > current ? node->expiry : current + 1);
+        }
+
+        void remove(TimerNode *node)
+        {
+            if (!node->queued)
+            {
+                return;
+            }
+
+            if (node->prev != nullptr)
+            {
+                node->prev->next = node->next;
+            }
+            else
+            {
+                slots[node->level][node->slot] = node->next;
+            }
+
+            if (node->next != nullptr)
+            {
+                node->next->prev = node->prev;
+            }
+
+            if (slots[node->level][node->slot] == nullptr)
+            {
+                occupied[node->level] &= ~((uint64_t) 1 << node->slot);
+            }
+
+            node->prev = nullptr;
+            node->next = nullptr;
+            node->queued = false;
+        }
+
+        /**
+         * Earliest tick advance has to stop at, a timer expiring or a level cascading. NO_EXPIRY if the wheel is empty.
+         */
+        uint32_t nextExpiry() const
+        {
+            uint32_t best = NO_EXPIRY;
+            if (occupied[0] != 0)
+            {
+                const uint8_t from = (current + 1) & (SLOTS - 1);
+                const uint64_t rotated = from == 0 ? occupied[0] : (occupied[0] >> from) | (occupied[0] << (SLOTS - from));
+                best = current + 1 + __builtin_ctzll(rotated);
+            }
+
+            for (uint8_t level = 1; level < LEVELS; level++)
+            {
+                if (occupied[level] != 0)
+                {
+                    const uint32_t boundary = (current | (SLOTS - 1)) + 1;
+                    return boundary < best ? boundary : best;
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * Moves the wheel to now, fn is called with every expired timer, already removed so it can insert it again.
+         */
+        template <typename Fn>
+        void advance(uint32_t now, Fn fn)
+        {
+            while (current < now)
+            {
+                const uint32_t next = nextExpiry();
+                if (next == NO_EXPIRY || next > now)
+                {
+                    current = now;
+                    return;
+                }
+
+                current = next - 1;
+                step(fn);
+            }
+        }
+
+        uint32_t now() const
+        {
+            return current;
+        }
+
+    private:
+        /**
+         * Links the node in the slot of expiry, which can be the current tick only while cascading, before it is expired.
+         */
+        void place(TimerNode *node, uint32_t expiry)
+        {
+            uint32_t delta = expiry - current;
+            if (delta >= HORIZON)
+            {
+                expiry = current + HORIZON - 1;
+                delta = HORIZON - 1;
+            }
+
+            uint8_t level = 0;
+            while (level < LEVELS - 1 && delta >= (uint32_t) 1 << (SLOT_BITS * (level + 1)))
+            {
+                level++;
+            }
+
+            node->level = level;
+            node->slot = (expiry >> (SLOT_BITS * level)) & (SLOTS - 1);
+            node->prev = nullptr;
+            node->next = slots[level][node->slot];
+            if (node->next != nullptr)
+            {
+                node->next->prev = node;
+            }
+
+            slots[level][node->slot] = node;
+            occupied[level] |= (uint64_t) 1 << node->slot;
+            node->queued = true;
+        }
+
+        TimerNode *detach(uint8_t level, uint8_t slot)
+        {
+            TimerNode *list = slots[level][slot];
+            slots[level][slot] = nullptr;
+            occupied[level] &= ~((uint64_t) 1 << slot);
+            return list;
+        }
+
+        template <typename Fn>
+        void step(Fn fn)
+        {
+            current++;
+
+            for (uint8_t level = 1; level < LEVELS; level++)
+            {
+                if ((current >> (SLOT_BITS * (level - 1))) & (SLOTS - 1))
+                {
+                    break;
+                }
+
+                TimerNode *node = detach(level, (current >> (SLOT_BITS * level)) & (SLOTS - 1));
+                while (node != nullptr)
+                {
+                    TimerNode *next = node->next;
+                    place(node, node->expiry > current ? node->expiry : current);
+                    node = next;
+                }
+            }
+
+            TimerNode *node = detach(0, current & (SLOTS - 1));
+            while (node != nullptr)
+            {
+                TimerNode *next = node->next;
+                node->prev = nullptr;
+                node->next = nullptr;
+                node->queued = false;
+
+                if (node->expiry > current)
+                {
+                    place(node, node->expiry);
+                }
+                else
+                {
+                    fn(node);
+                }
+
+                node = next;
+            }
+        }
+
+        TimerNode *slots[LEVELS][SLOTS]{};
+        uint64_t occupied[LEVELS]{};
+        uint32_t current = 0;
+    };
+
+    enum ScheduleKind
+    {
+        SCHEDULE_INTERVAL,
+        SCHEDULE_CRON,
+    };
+
+    /**
+     * Allowed minutes, hours, days of the month, months (1-12) and weekdays (0 is sunday) of a cron rule, one bit each.
+     */
+    struct CronRule
+    {
+        uint64_t minutes;
+        uint32_t hours;
+        uint32_t days;
+        uint16_t months;
+        uint8_t weekdays;
+        bool anyDay;
+        bool anyWeekday;
+    };
+
+    /**
+     * Job line: "<when>|<what>". When is "every <n>[s|m|h|d]", "at HH:MM" or "cron <min> <hour> <day> <month> <weekday>",
+     * what is "action <custom action>" or "attr <attribute> <value>".
+     */
+    struct ScheduledJob : TimerNode
+    {
+        uint16_t id;
+        ScheduleKind kind;
+        uint32_t interval;
+        CronRule cron;
+        time_t lastTarget;
+        char *line;
+        const char *what;
+    };
+
+    TimerWheel scheduleWheel;
+    ScheduledJob **scheduledJobs = nullptr;
+    uint8_t scheduledJobsCount = 0;
+    uint8_t maxScheduledJobs = 0;
+    uint16_t nextScheduleId = 1;
+
+    uint32_t scheduleSecondsBase = 0;
+    unsigned long scheduleMillisBase = 0;
+    unsigned long scheduleDeadline = 0;
+
+    /**
+     * Seconds since the scheduler started, the tick of the schedule wheel.
+     */
+    inline uint32_t scheduleSeconds()
+    {
+        const uint32_t elapsed = (uint32_t) (millis() - scheduleMillisBase) / 1000;
+        scheduleSecondsBase += elapsed;
+        scheduleMillisBase += elapsed * 1000UL;
+        return scheduleSecondsBase;
+    }
+
+    inline void updateScheduleDeadline()
+    {
+        const uint32_t next = scheduleWheel.nextExpiry();
+        if (next == TimerWheel::NO_EXPIRY)
+        {
+            scheduleDeadline = millis() + MODULE_IDLE_MS;
+            return;
+        }
+
+        scheduleDeadline = next <= scheduleSecondsBase ? millis() : scheduleMillisBase + (unsigned long) (next - scheduleSecondsBase) * 1000UL;
+    }
+
+    /**
+     * Parses one cron field ("*", "5", "1-5", "*\/15", "0-30/10", or a comma separated list of those) into bits.
+     */
+    inline bool parseCronField(const char *&p, uint8_t min, uint8_t max, uint64_t &out, bool &any)
+    {
+        out = 0;
+        any = *p == '*' && (p[1] == ' ' || p[1] == 0);
+
+        while (true)
+        {
+            long from, to;
+            if (*p == '*')
+            {
+                from = min;
+                to = max;
+                p++;
+            }
+            else
+            {
+                char *end;
+                from = strtol(p, &end, 10);
+                if (end == p)
+                {
+                    return false;
+                }
+                p = end;
+                to = from;
+
+                if (*p == '-')
+                {
+                    p++;
+                    to = strtol(p, &end, 10);
+                    if (end == p)
+                    {
+                        return false;
+                    }
+                    p = end;
+                }
+            }
+
+            long stepSize = 1;
+            if (*p == '/')
+            {
+                char *end;
+                p++;
+                stepSize = strtol(p, &end, 10);
+                if (end == p || stepSize < 1)
+                {
+                    return false;
+                }
+                p = end;
+            }
+
+            if (from < min || to > max || from > to)
+            {
+                return false;
+            }
+
+            for (long i = from; i <= to; i += stepSize)
+            {
+                out |= (uint64_t) 1 << i;
+            }
+
+            if (*p != ',')
+            {
+                break;
+            }
+            p++;
+        }
+
+        if (*p != ' ' && *p != 0)
+        {
+            return false;
+        }
+
+        while (*p == ' ')
+        {
+            p++;
+        }
+        return true;
+    }
+
+    inline bool parseCronRule(const char *p, CronRule &rule)
+    {
+        uint64_t minutes, hours, days, months, weekdays;
+        bool any;
+
+        if (!parseCronField(p, 0, 59, minutes, any) || !parseCronField(p, 0, 23, hours, any) ||
+            !parseCronField(p, 1, 31, days, rule.anyDay) || !parseCronField(p, 1, 12, months, any) ||
+            !parseCronField(p, 0, 7, weekdays, rule.anyWeekday) || *p != 0)
+        {
+            return false;
+        }
+
+        rule.minutes = minutes;
+        rule.hours = hours;
+        rule.days = days;
+        rule.months = months;
+        // 7 is sunday too
+        rule.weekdays = (weekdays | weekdays >> 7) & 0x7f;
+        return true;
+    }
+
+    inline bool cronDayMatches(const CronRule &rule, const struct tm &t)
+    {
+        if (!(rule.months & (1 << (t.tm_mon + 1))))
+        {
+            return false;
+        }
+
+        const bool day = rule.days & ((uint32_t) 1 << t.tm_mday);
+        const bool weekday = rule.weekdays & (1 << t.tm_wday);
+        // Like cron, when both the day and the weekday are restricted either one matching is enough
+        return rule.anyDay || rule.anyWeekday ? day && weekday : day || weekday;
+    }
+
+    /**
+     * First wall clock time matching the rule after the minute of the given time, 0 if none in the next four years.
+     */
+    inline time_t nextCronTime(const CronRule &rule, time_t after)
+    {
+        struct tm t;
+        localtime_r(&after, &t);
+        t.tm_sec = 0;
+        t.tm_min++;
+        t.tm_isdst = -1;
+        time_t candidate = mktime(&t);
+
+        for (uint16_t day = 0; day < 366 * 4 + 1; day++)
+        {
+            localtime_r(&candidate, &t);
+            if (cronDayMatches(rule, t))
+            {
+                for (int hour = t.tm_hour; hour < 24; hour++)
+                {
+                    if (!(rule.hours & ((uint32_t) 1 << hour)))
+                    {
+                        continue;
+                    }
+
+                    for (int minute = hour == t.tm_hour ? t.tm_min : 0; minute < 60; minute++)
+                    {
+                        if (rule.minutes & ((uint64_t) 1 << minute))
+                        {
+                            t.tm_hour = hour;
+                            t.tm_min = minute;
+                            t.tm_sec = 0;
+                            t.tm_isdst = -1;
+                            return mktime(&t);
+                        }
+                    }
+                }
+            }
+
+            t.tm_mday++;
+            t.tm_hour = 0;
+            t.tm_min = 0;
+            t.tm_sec = 0;
+            t.tm_isdst = -1;
+            candidate = mktime(&t);
+        }
+
+        return 0;
+    }
+
+    inline bool parseScheduleWhen(const char *when, ScheduledJob &job)
+    {
+        if (strncmp(when, "every ", 6) == 0)
+        {
+            char *end;
+            const unsigned long value = strtoul(when + 6, &end, 10);
+            unsigned long multiplier = 1;
+            switch (*end)
+            {
+            case 0:
+            case 's': break;
+            case 'm': multiplier = 60; break;
+            case 'h': multiplier = 3600; break;
+            case 'd': multiplier = 86400; break;
+            default: return false;
+            }
+
+            if (end == when + 6 || value == 0 || (*end != 0 && end[1] != 0) || value > UINT32_MAX / multiplier)
+            {
+                return false;
+            }
+
+            job.kind = SCHEDULE_INTERVAL;
+            job.interval = value * multiplier;
+            return true;
+        }
+
+        if (strncmp(when, "at ", 3) == 0)
+        {
+            unsigned int hour, minute;
+            int read = 0;
+            if (sscanf(when + 3, "%u:%u%n", &hour, &minute, &read) != 2 || when[3 + read] != 0 || hour > 23 || minute > 59)
+            {
+                return false;
+            }
+
+            job.kind = SCHEDULE_CRON;
+            job.cron = CronRule{(uint64_t) 1 << minute, (uint32_t) 1 << hour, 0xfffffffe, 0x1ffe, 0x7f, true, true};
+            return true;
+        }
+
+        if (strncmp(when, "cron ", 5) == 0)
+        {
+            job.kind = SCHEDULE_CRON;
+            return parseCronRule(when + 5, job.cron);
+        }
+
+        return false;
+    }
+
+    inline bool parseScheduleWhat(const char *what)
+    {
+        if (strncmp(what, "action ", 7) == 0)
+        {
+            return what[7] != 0;
+        }
+
+        if (strncmp(what, "attr ", 5) == 0)
+        {
+            const char *space = strchr(what + 5, ' ');
+            return space != nullptr && space != what + 5;
+        }
+
+        return false;
+    }
+
+    /**
+     * If the custom action or attribute the job runs is registered.
+     */
+    inline bool scheduleTargetExists(const char *what)
+    {
+#if ESP_CONP_HAS_MODULE(ACTIONS)
+        if (strncmp(what, "action ", 7) == 0)
+        {
+            for (uint8_t i = 0; i < customActionsCount; i++)
+            {
+                if (strcmp(customActions[i]->key, what + 7) == 0)
+                {
+                    return true;
+                }
+            }
+        }
+#endif
+
+#if ESP_CONP_HAS_MODULE(ATTRIBUTES)
+        if (strncmp(what, "attr ", 5) == 0)
+        {
+            const char *key = what + 5;
+            const char *keyEnd = strchr(key, ' ');
+            if (keyEnd == nullptr)
+            {
+                return false;
+            }
+
+            const size_t keyLength = keyEnd - key;
+            for (uint8_t i = 0; i < attributeCount; i++)
+            {
+                if (attributes[i] != nullptr && strlen(attributes[i]->key) == keyLength && strncmp(attributes[i]->key, key, keyLength) == 0)
+                {
+                    return true;
+                }
+            }
+        }
+#endif
+
+        return false;
+    }
+
+    /**
+     * Runs the action or sets the attribute of the job. It runs from loop(), outside of any request, so an action gets
+     * the server without a request to read arguments from or to answer.
+     */
+    inline void runScheduledJob(ScheduledJob *job)
+    {
+        LOGF("Running scheduled job %d: %s\n", job->id, job->line);
+        const char *what = job->what;
+        (void) what;
+
+#if ESP_CONP_HAS_MODULE(ACTIONS)
+        if (strncmp(what, "action ", 7) == 0)
+        {
+            for (uint8_t i = 0; i < customActionsCount; i++)
+            {
+                if (strcmp(customActions[i]->key, what + 7) == 0)
+                {
+                    customActions[i]->handler(*server);
+                    return;
+                }
+            }
+        }
+#endif
+
+#if ESP_CONP_HAS_MODULE(ATTRIBUTES)
+        if (strncmp(what, "attr ", 5) == 0)
+        {
+            const char *value = strchr(what + 5, ' ');
+            char key[value - what - 4];
+            memcpy(key, what + 5, value - what - 5);
+            key[value - what - 5] = 0;
+            findAndSet(key, value + 1);
+            return;
+        }
+#endif
+
+        LOGF("Target of scheduled job %d not found.\n", job->id);
+    }
+
+    /**
+     * Puts the job in the wheel for its next run. Intervals count from the previous run, not from when it
+     * finished, so they don't drift, and clock jobs are computed again from the wall clock every time.
+     */
+    inline void queueScheduledJob(ScheduledJob *job, bool ran)
+    {
+        const uint32_t now = scheduleSeconds();
+        if (!ran && scheduleWheel.nextExpiry() == TimerWheel::NO_EXPIRY)
+        {
+            // Nothing to run in an empty wheel, catching it up keeps it from stepping through the idle time later
+            scheduleWheel.advance(now, [](TimerNode *) {});
+        }
+
+        if (job->kind == SCHEDULE_INTERVAL)
+        {
+            job->expiry = ran ? job->expiry + job->interval : now + job->interval;
+            if (job->expiry <= now)
+            {
+                job->expiry += ((now - job->expiry) / job->interval + 1) * job->interval;
+            }
+        }
+        else
+        {
+            const time_t wall = time(nullptr);
+            if (wall < ESP_CONP_SCHEDULE_MIN_VALID_TIME)
+            {
+                job->expiry = now + 60;
+            }
+            else
+            {
+                const time_t target = nextCronTime(job->cron, wall > job->lastTarget ? wall : job->lastTarget);
+                if (target == 0)
+                {
+                    LOGF("Scheduled job %d never runs.\n", job->id);
+                    return;
+                }
+
+                job->lastTarget = target;
+                job->expiry = now + (uint32_t) (target - wall);
+            }
+        }
+
+        scheduleWheel.insert(job);
+    }
+
+    inline void saveScheduledJob(ScheduledJob *job)
+    {
+        if (schedulingStorage == nullptr)
+        {
+            return;
+        }
+
+        char key[6];
+        sprintf(key, "%u", job->id);
+        schedulingStorage->save(key, job->line);
+    }
+
+    inline ScheduledJob *createScheduledJob(uint16_t id, const char *line)
+    {
+        const size_t length = strlen(line);
+        const char *separator = strchr(line, '|');
+        if (separator == nullptr || length >= ESP_CONP_SCHEDULE_MAX_LINE || strpbrk(line, "\r\n") != nullptr ||
+            !parseScheduleWhat(separator + 1))
+        {
+            return nullptr;
+        }
+
+        char when[separator - line + 1];
+        memcpy(when, line, separator - line);
+        when[separator - line] = 0;
+
+        ScheduledJob parsed{};
+        if (!parseScheduleWhen(when, parsed))
+        {
+            return nullptr;
+        }
+
+        if (scheduledJobsCount + 1 > maxScheduledJobs)
+        {
+            const uint8_t newMax = maxScheduledJobs == 0 ? 1 : ceil(maxScheduledJobs * 1.5);
+            auto **newJobs = (ScheduledJob**) realloc(scheduledJobs, sizeof(ScheduledJob*) * newMax);
+            if (newJobs == nullptr)
+            {
+                LOGN("Memory allocation failed for scheduled jobs array.");
+                return nullptr;
+            }
+            scheduledJobs = newJobs;
+            maxScheduledJobs = newMax;
+        }
+
+        auto *job = new ScheduledJob(parsed);
+        job->id = id;
+        job->line = (char*) malloc(length + 1);
+        strcpy(job->line, line);
+        job->what = job->line + (separator - line) + 1;
+
+        scheduledJobs[scheduledJobsCount++] = job;
+        nextScheduleId = id >= nextScheduleId ? id + 1 : nextScheduleId;
+        queueScheduledJob(job, false);
+        return job;
+    }
+
+    /**
+     * Adds a scheduled job and saves it, see ScheduledJob for the line format.
+     * @return id of the job, 0 if the line is invalid.
+     */
+    inline uint16_t addSchedule(const char *line)
+    {
+        ScheduledJob *job = createScheduledJob(nextScheduleId, line);
+        if (job == nullptr)
+        {
+            LOGF("Invalid schedule: %s\n", line);
+            return 0;
+        }
+
+        saveScheduledJob(job);
+        updateScheduleDeadline();
+        wakeModules();
+        return job->id;
+    }
+
+    inline bool removeSchedule(uint16_t id)
+    {
+        for (uint8_t i = 0; i < scheduledJobsCount; i++)
+        {
+            ScheduledJob *job = scheduledJobs[i];
+            if (job->id != id)
+            {
+                continue;
+            }
+
+            scheduleWheel.remove(job);
+            scheduledJobs[i] = scheduledJobs[--scheduledJobsCount];
+
+            if (schedulingStorage != nullptr)
+            {
+                char key[6];
+                sprintf(key, "%u", id);
+                schedulingStorage->remove(key);
+            }
+
+            free(job->line);
+            delete job;
+            updateScheduleDeadline();
+            wakeModules();
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Sets the storage for scheduled jobs and recovers the jobs saved in it.
+     * @param storage Storage to be used in the scheduling module.
+     */
+    inline void setAndUpdateScheduleStorage(KeyValueStorage *storage)
+    {
+        LOGN("Setting up schedule storage.");
+        schedulingStorage = storage;
+        if (schedulingStorage == nullptr)
+        {
+            return;
+        }
+
+        schedulingStorage->doForEachKey([](const char *key, const char *value)
+        {
+            const unsigned long id = strtoul(key, nullptr, 10);
+            if (id == 0 || id > UINT16_MAX || value[0] == 0)
+            {
+                return true;
+            }
+
+            if (createScheduledJob(id, value) == nullptr)
+            {
+                LOGF("Ignoring invalid saved schedule %s: %s\n", key, value);
+            }
+            return true;
+        }, ESP_CONP_SCHEDULE_MAX_LINE);
+
+        updateScheduleDeadline();
+    }
+
+    inline void getSchedule()
     {
+        ResponseWriter writer;
+        const uint32_t now = scheduleSeconds();
 
+        for (uint8_t i = 0; i < scheduledJobsCount; i++)
+        {
+            ScheduledJob *job = scheduledJobs[i];
+            writer.print(job->id);
+            writer.print('|');
+            writer.print(job->line);
+            writer.print('|');
+            writer.print(job->queued ? (long) (job->expiry - now) : -1L);
+            writer.print('\n');
+        }
     }
 
+    inline void addScheduleRoute()
+    {
+        String body = server->arg(F("plain"));
+        body.trim();
+
+        const int separator = body.indexOf('|');
+        if (separator < 0 || !scheduleTargetExists(body.c_str() + separator + 1))
+        {
+            server->send(400, "text/plain", "Unknown action or attribute.");
+            return;
+        }
+
+        const uint16_t id = addSchedule(body.c_str());
+        if (id == 0)
+        {
+            server->send(400, "text/plain", "Invalid schedule.");
+            return;
+        }
+
+        server->send(200, "text/plain", String(id));
+    }
+
+    inline void deleteScheduleRoute()
+    {
+        const unsigned long id = strtoul(server->arg(F("plain")).c_str(), nullptr, 10);
+        server->send(id > 0 && id <= UINT16_MAX && removeSchedule(id) ? 200 : 404);
+    }
+
+    /**
+     * Runs the jobs that are due, a single comparison when none is.
+     */
     inline void schedulingLoop()
     {
+        if (!deadlinePassed(scheduleDeadline, millis()))
+        {
+            return;
+        }
 
+        scheduleWheel.advance(scheduleSeconds(), [](TimerNode *node)
+        {
+            auto *job = static_cast<ScheduledJob*>(node);
+            runScheduledJob(job);
+            queueScheduledJob(job, true);
+        });
+
+        updateScheduleDeadline();
     }
+
+    inline void enableSchedulingModule()
+    {
+        enableRoutes(SCHEDULING);
+        scheduleSeconds();
+
+        if (schedulingStorage == nullptr)
+        {
+            setAndUpdateScheduleStorage(new LittleFSKeyValueStorage("/esp-conp-schedule"));
+        }
+        updateScheduleDeadline();
+    }
+
+    class SchedulingModule : public ConfigPageModule
+    {
+    public:
+        const char *name() const override
+        {
+            return "scheduling";
+        }
+
+        void tick(unsigned long now) override
+        {
+            schedulingLoop();
+        }
+
+        unsigned long nextDeadline(unsigned long now) override
+        {
+            return scheduleDeadline;
+        }
+    };
+
+    inline SchedulingModule schedulingModule;
 }
 
 #endif //ESP_CONFIG_PAGE_SCHEDULING_H
@@ -0,0 +1,273 @@
+#ifndef ESP_CONFIG_PAGE_STRING_POOL_H
+#define ESP_CONFIG_PAGE_STRING_POOL_H
+
+#include "esp-config-defines.h"
+
+// Bytes allocated for the pool on the first string, it doubles when full
+#ifndef ESP_CONP_STRING_POOL_SIZE
+#define ESP_CONP_STRING_POOL_SIZE 256
+#endif
+
+namespace ESP_CONFIG_PAGE
+{
+    constexpr uint16_t STRING_POOL_NONE = UINT16_MAX;
+
+    struct StringPoolStats
+    {
+        size_t capacity;
+        // Bytes up to the last string, live and released
+        size_t used;
+        // Bytes of the strings still in use, headers included
+        size_t live;
+        size_t strings;
+        uint32_t compactions;
+        uint32_t grows;
+    };
+
+    /**
+     * One buffer for the env var and text attribute values, instead of a small heap block per value that stays for the
+     * whole uptime and fragments the heap.
+     *
+     * Strings are stored as a 2 byte handle followed by the characters and the terminator. Released strings are left as
+     * holes until an add does not fit, then the live strings are moved down over them, the buffer only grows when the
+     * holes are not enough. Handles stay the same when strings move, and the owner pointer given to add is updated to
+     * the new address, as long as it still points to the string.
+     */
+    class StringPool
+    {
+    public:
+        ~StringPool()
+        {
+            free(buffer);
+            free(slots);
+        }
+
+        /**
+         * Copies str into the pool and points *owner to the copy.
+         * @return handle of the copy, STRING_POOL_NONE if there is no memory for it, *owner is not changed then.
+         */
+        uint16_t add(const char *str, char **owner)
+        {
+            // A string from the pool itself could move while making room, it is copied out first
+            if (buffer != nullptr && str >= buffer && str < buffer + used)
+            {
+                char *copy = (char*) malloc(strlen(str) + 1);
+                if (copy == nullptr)
+                {
+                    return STRING_POOL_NONE;
+                }
+
+                strcpy(copy, str);
+                const uint16_t handle = add(copy, owner);
+                free(copy);
+                return handle;
+            }
+
+            const size_t size = RECORD_HEADER + strlen(str) + 1;
+            const uint16_t handle = freeSlot();
+            if (handle == STRING_POOL_NONE || !reserve(size))
+            {
+                LOGN("Memory allocation failed for string pool.");
+                return STRING_POOL_NONE;
+            }
+
+            const size_t offset = used;
+            memcpy(buffer + offset, &handle, RECORD_HEADER);
+            strcpy(buffer + offset + RECORD_HEADER, str);
+            used += size;
+            live += size;
+            strings++;
+
+            slots[handle].offset = offset;
+            slots[handle].owner = owner;
+            *owner = buffer + offset + RECORD_HEADER;
+            return handle;
+        }
+
+        /**
+         * Frees the string, its bytes are reused on the next compaction.
+         */
+        void release(uint16_t handle)
+        {
+            if (handle >= slotCount || slots[handle].owner == nullptr)
+            {
+                return;
+            }
+
+            const uint16_t none = STRING_POOL_NONE;
+            char *record = buffer + slots[handle].offset;
+            live -= RECORD_HEADER + strlen(record + RECORD_HEADER) + 1;
+            memcpy(record, &none, RECORD_HEADER);
+            slots[handle].owner = nullptr;
+            strings--;
+
+            if (strings == 0)
+            {
+                used = 0;
+            }
+        }
+
+        /**
+         * @return the string or nullptr if the handle was released.
+         */
+        const char *get(uint16_t handle) const
+        {
+            if (handle >= slotCount || slots[handle].owner == nullptr)
+            {
+                return nullptr;
+            }
+
+            return buffer + slots[handle].offset + RECORD_HEADER;
+        }
+
+        /**
+         * Moves the live strings down over the released ones.
+         */
+        void compact()
+        {
+            size_t to = 0;
+            for (size_t from = 0; from < used;)
+            {
+                uint16_t handle;
+                memcpy(&handle, buffer + from, RECORD_HEADER);
+                const size_t size = RECORD_HEADER + strlen(buffer + from + RECORD_HEADER) + 1;
+
+                if (handle != STRING_POOL_NONE)
+                {
+                    char **owner = slots[handle].owner;
+                    if (*owner == buffer + from + RECORD_HEADER)
+                    {
+                        *owner = buffer + to + RECORD_HEADER;
+                    }
+
+                    memmove(buffer + to, buffer + from, size);
+                    slots[handle].offset = to;
+                    to += size;
+                }
+
+                from += size;
+            }
+
+            used = to;
+            poolStats.compactions++;
+        }
+
+        StringPoolStats getStats() const
+        {
+            StringPoolStats stats = poolStats;
+            stats.capacity = capacity;
+            stats.used = used;
+            stats.live = live;
+            stats.strings = strings;
+            return stats;
+        }
+
+    private:
+        static constexpr size_t RECORD_HEADER = sizeof(uint16_t);
+
+        struct Slot
+        {
+            size_t offset;
+            // nullptr for free slots
+            char **owner;
+        };
+
+        char *buffer = nullptr;
+        size_t capacity = 0;
+        size_t used = 0;
+        size_t live = 0;
+        size_t strings = 0;
+        Slot *slots = nullptr;
+        uint16_t slotCount = 0;
+        StringPoolStats poolStats{};
+
+        uint16_t freeSlot()
+        {
+            for (uint16_t i = 0; i < slotCount; i++)
+            {
+                if (slots[i].owner == nullptr)
+                {
+                    return i;
+                }
+            }
+
+            if (slotCount == STRING_POOL_NONE)
+            {
+                return STRING_POOL_NONE;
+            }
+
+            const uint16_t newCount = slotCount == 0 ? 8 : (slotCount * 2 < STRING_POOL_NONE ? slotCount * 2 : STRING_POOL_NONE);
+            auto *newSlots = (Slot*) realloc(slots, newCount * sizeof(Slot));
+            if (newSlots == nullptr)
+            {
+                return STRING_POOL_NONE;
+            }
+
+            for (uint16_t i = slotCount; i < newCount; i++)
+            {
+                newSlots[i].owner = nullptr;
+            }
+
+            slots = newSlots;
+            const uint16_t handle = slotCount;
+            slotCount = newCount;
+            return handle;
+        }
+
+        /**
+         * Makes room for size bytes after used, compacting first and growing the buffer if that is not enough.
+         */
+        bool reserve(size_t size)
+        {
+            if (used + size <= capacity)
+            {
+                return true;
+            }
+
+            if (live + size <= capacity)
+            {
+                compact();
+                return true;
+            }
+
+            size_t newCapacity = capacity == 0 ? ESP_CONP_STRING_POOL_SIZE : capacity * 2;
+            while (newCapacity < live + size)
+            {
+                newCapacity *= 2;
+            }
+
+            // Compacting first leaves nothing but live strings to copy when the buffer moves
+            if (used > live)
+            {
+                compact();
+            }
+
+            const uintptr_t oldBuffer = (uintptr_t) buffer;
+            char *newBuffer = (char*) realloc(buffer, newCapacity);
+            if (newBuffer == nullptr)
+            {
+                return false;
+            }
+
+            for (uint16_t i = 0; i < slotCount && (uintptr_t) newBuffer != oldBuffer; i++)
+            {
+                if (slots[i].owner != nullptr && (uintptr_t) *slots[i].owner == oldBuffer + slots[i].offset + RECORD_HEADER)
+                {
+                    *slots[i].owner = newBuffer + slots[i].offset + RECORD_HEADER;
+                }
+            }
+
+            buffer = newBuffer;
+            capacity = newCapacity;
+            poolStats.grows++;
+            return true;
+        }
+    };
+
+    /**
+     * Pool of the env var and text attribute values.
+     */
+    StringPool stringPool;
+}
+
+#endif //ESP_CONFIG_PAGE_STRING_POOL_H
@@ -6,6 +6,11 @@
 #define ESP_CONP_SSID_LEN 33
 #define ESP_CONP_PASS_LEN 64
 
+// How often the connection state is checked, the wifi timeouts are all in seconds
+#ifndef ESP_CONP_WIRELESS_POLL_MS
+#define ESP_CONP_WIRELESS_POLL_MS 250
+#endif
+
 namespace ESP_CONFIG_PAGE
 {
     String apSsid = "ESP";
@@ -19,6 +24,8 @@ namespace ESP_CONFIG_PAGE
     unsigned long currentReconnectRetry = 1;
     unsigned long reconnectTimeMax = 120000;
     KeyValueStorage *wifiStorage = nullptr;
+    // The network of the request being parsed did not fit
+    bool wifiPairRejected = false;
 
     inline void addWifiNetwork(const char *ssid, const char *pass)
     {
@@ -40,9 +47,9 @@ namespace ESP_CONFIG_PAGE
 
     inline void setWifiStorage(KeyValueStorage *storage)
     {
-        if (wifiStorage != nullptr)
+        if (wifiStorage != nullptr && wifiStorage != storage)
         {
-            free(wifiStorage);
+            delete wifiStorage;
         }
 
         wifiStorage = storage;
@@ -90,13 +97,17 @@ namespace ESP_CONFIG_PAGE
         }
 
         size_t index = 0;
-        wifiStorage->doForEachKey([&index, timeoutMs](const char *ssidHex, const char *pass)
+        // Only the keys are listed, the password is read for the networks actually tried
+        wifiStorage->doForEachKeyOnly([&index, timeoutMs](const char *ssidHex)
         {
             index++;
 
-            if (strlen(ssidHex) == 0 || strlen(pass) == 0)
+            char pass[ESP_CONP_PASS_LEN]{};
+            size_t passLength = 0;
+            wifiStorage->readValue(ssidHex, 0, pass, sizeof(pass) - 1, &passLength);
+            if (strlen(ssidHex) == 0 || passLength == 0 || passLength >= sizeof(pass))
             {
-                LOGF("Network or password at position %zu is empty, ignoring\n", index-1);
+                LOGF("Network or password at position %zu is empty or too long, ignoring\n", index-1);
                 return true;
             }
 
@@ -128,7 +139,7 @@ namespace ESP_CONFIG_PAGE
             }
 
             delay(15);
-        }, ESP_CONP_PASS_LEN);
+        });
     }
 
     inline void setAPConfig(const char ssid[], const char pass[])
@@ -154,104 +165,91 @@ namespace ESP_CONFIG_PAGE
             return;
         }
 
-        String ssid = WiFi.SSID();
-        int bufSize = ssid.length() + 8;
         int wifiStatus = WiFi.status();
 
-        char ssids[count][33];
-        if (wifiStatus != WL_IDLE_STATUS || lastConnectionError != -1)
+        ResponseWriter writer;
+        writer.print(WiFi.SSID());
+        writer.print('\n');
+        writer.print(lastConnectionError != -1 ? lastConnectionError : wifiStatus);
+        writer.print('\n');
+
+        if (wifiStatus == WL_IDLE_STATUS && lastConnectionError == -1)
+        {
+            return;
+        }
+
+        for (int i = 0; i < count; i++)
         {
-            for (int i = 0; i < count; i++)
-            {
 #ifdef ESP32
-                const wifi_ap_record_t* it = reinterpret_cast<wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
+            const wifi_ap_record_t* it = reinterpret_cast<wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
 #elif ESP8266
-                const bss_info *it = WiFi.getScanInfoByIndex(i);
+            const bss_info *it = WiFi.getScanInfoByIndex(i);
 #endif
 
-                 if (!it)
-                 {
-                     ssids[i][0] = '\0';
-                     continue;
-                 }
-
-                memcpy(ssids[i], it->ssid, sizeof(it->ssid));
-                ssids[count][32] = '\0';
-                bufSize += strlen(ssids[count]) + 10;
+            if (it != nullptr)
+            {
+                writer.write((const char*) it->ssid, strnlen((const char*) it->ssid, sizeof(it->ssid)));
             }
+
+            writer.print('\n');
+            writer.print((int) WiFi.RSSI(i));
+            writer.print('\n');
         }
+    }
 
-        char buf[bufSize];
-        buf[0] = '\0';
+    inline bool wifiSetPair(char *ssid, size_t ssidLength, char *pass, size_t passLength)
+    {
+        ssidLength = PairTokenizer::unescape(ssid, ssidLength);
+        passLength = PairTokenizer::unescape(pass, passLength);
 
-        strcat(buf, ssid.c_str());
-        strcat(buf, "\n");
-        strcat(buf, String(lastConnectionError != -1 ? lastConnectionError : wifiStatus).c_str());
-        strcat(buf, "\n");
+        wifiPairRejected = ssidLength >= ESP_CONP_SSID_LEN || passLength >= ESP_CONP_PASS_LEN;
+        if (wifiPairRejected)
+        {
+            LOGF("Network rejected, the ssid must be shorter than %d and the password than %d characters.\n", ESP_CONP_SSID_LEN, ESP_CONP_PASS_LEN);
+            return false;
+        }
 
-        if (wifiStatus != WL_IDLE_STATUS || lastConnectionError != -1)
+        if (wifiStorage != nullptr && bodyTokenizer.pairs() == 1)
         {
-            for (int i = 0; i < count; i++)
-            {
-                uint32_t rssi = WiFi.RSSI(i);
-                int rssiLength = snprintf(nullptr, 0, "%d", rssi);
-                char rssibuf[rssiLength + 1];
-                sprintf(rssibuf, "%d", rssi);
-
-                strcat(buf, ssids[i]);
-                strcat(buf, "\n");
-                strcat(buf, rssibuf);
-                strcat(buf, "\n");
-            }
+            wifiStorage->beginBatch();
         }
 
-        server->send(200, "text/plain", buf);
+        addWifiNetwork(ssid, pass);
+        return false;
     }
 
-    inline void wifiSet()
+    inline void abortWifiBatch()
     {
-        String body = server->arg("plain");
+        wifiPairRejected = false;
+        if (wifiStorage != nullptr)
+        {
+            wifiStorage->abort();
+        }
+    }
 
-        if (countChar(body.c_str(), '\n') < 2)
+    inline void wifiSet()
+    {
+        if (bodyTokenizer.pairs() == 0)
         {
             server->send(400);
             return;
         }
 
-        char buf[ESP_CONP_PASS_LEN]{};
-        char ssid[ESP_CONP_SSID_LEN]{};
-        unsigned int currentChar = 0;
-        bool isSsid = true;
-
-        for (unsigned int i = 0; i < body.length(); i++)
+        if (wifiPairRejected)
         {
-            char c = body[i];
+            wifiPairRejected = false;
+            server->send(400, "text/plain", "SSID or password too long.");
+            return;
+        }
 
-            if (c == '\n')
-            {
-                buf[currentChar] = 0;
-
-                if (isSsid)
-                {
-                    strcpy(ssid, buf);
-                    isSsid = false;
-                }
-                else
-                {
-                    server->send(200);
-                    addWifiNetwork(ssid, buf);
-                    tryConnectWifi(true);
-                    break;
-                }
-
-                currentChar = 0;
-            }
-            else
-            {
-                buf[currentChar] = c;
-                currentChar++;
-            }
+        if (wifiStorage != nullptr && !wifiStorage->commit())
+        {
+            server->send(500, "text/plain", "Failed to save the network.");
+            return;
         }
+
+        server->send(200);
+        tryConnectWifi(true);
     }
 
     inline void enableWirelessModule()
@@ -261,10 +259,12 @@ namespace ESP_CONFIG_PAGE
             return;
         }
 
-        addServerHandler((char*) F("/config/wifi"), HTTP_GET, wifiGet);
-        addServerHandler((char*) F("/config/wifi"), HTTP_POST, wifiSet);
+        enableRoutes(WIRELESS);
         connectionTimeoutCounter = millis() - connectionTimeoutMs;
-        setWifiStorage(new ESP_CONFIG_PAGE::LittleFSKeyValueStorage("/esp-conp-saved-networks"));
+        if (wifiStorage == nullptr)
+        {
+            setWifiStorage(new ESP_CONFIG_PAGE::LittleFSKeyValueStorage("/esp-conp-saved-networks"));
+        }
         WiFi.persistent(false);
         WiFi.setAutoReconnect(true);
         WiFi.mode(WIFI_STA);
@@ -307,5 +307,30 @@ namespace ESP_CONFIG_PAGE
             currentReconnectRetry++;
         }
     }
+
+    class WirelessModule : public ConfigPageModule
+    {
+    public:
+        const char *name() const override
+        {
+            return "wireless";
+        }
+
+        void tick(unsigned long now) override
+        {
+            lastTick = now;
+            wirelessLoop();
+        }
+
+        unsigned long nextDeadline(unsigned long now) override
+        {
+            return lastTick + ESP_CONP_WIRELESS_POLL_MS;
+        }
+
+    private:
+        unsigned long lastTick = 0;
+    };
+
+    inline WirelessModule wirelessModule;
 }
 #endif //ESP_CONFIG_PAGE_WIRELESS_H
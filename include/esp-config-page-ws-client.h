@@ -0,0 +1,19 @@
+#ifndef ESP_CONFIG_PAGE_WS_CLIENT_H
+#define ESP_CONFIG_PAGE_WS_CLIENT_H
+
+#include "esp-config-defines.h"
+
+namespace ESP_CONFIG_PAGE
+{
+    /**
+     * Websocket client of the logging and OTA servers, it is removed if it doesn't log in shortly after connecting.
+     */
+    struct WsClient
+    {
+        int id = -1;
+        unsigned long connectedTime = 0;
+        bool authed = false;
+    };
+}
+
+#endif //ESP_CONFIG_PAGE_WS_CLIENT_H
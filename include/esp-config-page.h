@@ -33,92 +33,326 @@
 #define ESP_CONP_LOGGING_PORT 4000
 #endif
 
+// Browsers revalidate the page with its ETag on every load, use e.g. "private, max-age=86400" to skip revalidation for a day
+#ifndef ESP_CONP_PAGE_CACHE_CONTROL
+#define ESP_CONP_PAGE_CACHE_CONTROL "private, no-cache"
+#endif
+
 #include <Arduino.h>
 #include <LittleFS.h>
 #include <WiFiUdp.h>
+#include <esp-config-defines.h>
+
+#if ESP_CONP_HAS_MODULE(LOGGING)
 #include <WebSockets.h>
 #include <WebSocketsClient.h>
 #include <WebSocketsServer.h>
 #include <esp-config-page-logging.h>
-#include <esp-config-defines.h>
+#endif
+
+#if ESP_CONP_HAS_MODULE(ACTIONS)
 #include <esp-config-page-ca.h>
+#endif
+#if ESP_CONP_HAS_MODULE(ENVIRONMENT)
 #include <esp-config-page-env.h>
+#endif
+#if ESP_CONP_HAS_MODULE(FILES)
 #include <esp-config-page-files.h>
+#endif
+#if ESP_CONP_HAS_MODULE(OTA)
 #include <esp-config-page-ota.h>
+#endif
+#if ESP_CONP_HAS_MODULE(WIRELESS)
 #include <esp-config-page-wireless.h>
+#endif
+#if ESP_CONP_HAS_MODULE(ATTRIBUTES)
 #include <esp-config-page-attributes.h>
+#endif
+#if ESP_CONP_HAS_MODULE(SCHEDULING)
 #include <esp-config-page-scheduling.h>
+#endif
 
 #include "config-html.h"
 
+#if defined(ESP_CONFIG_HTML_BR_LEN) && !defined(ESP_CONP_PAGE_GZIP_ONLY)
+#define ESP_CONP_PAGE_BROTLI
+#endif
+
+#ifndef ESP_CONP_PAGE_BROTLI_ONLY
+#define ESP_CONP_PAGE_GZIP
+#endif
+
+#if !defined(ESP_CONP_PAGE_BROTLI) && !defined(ESP_CONP_PAGE_GZIP)
+#error "ESP_CONP_PAGE_BROTLI_ONLY needs a config-html.h generated with the brotli python module installed."
+#endif
+
 namespace ESP_CONFIG_PAGE
 {
     inline void getInfo()
     {
 #ifdef ESP32
-        String usedBytes = String(LittleFS.usedBytes());
-        String totalBytes = String(LittleFS.totalBytes());
+        size_t usedBytes = LittleFS.usedBytes();
+        size_t totalBytes = LittleFS.totalBytes();
 #elif ESP8266
         FSInfo fsInfo;
         LittleFS.info(fsInfo);
-        String usedBytes = String(fsInfo.usedBytes);
-        String totalBytes = String(fsInfo.totalBytes);
-#endif
-        String freeHeap = String(ESP.getFreeHeap());
-        String otaMaxLength = String(ESP_CONP_WS_BUFFER_SIZE-32);
-        String otaPort = String(ESP32_CONP_OTA_WS_PORT);
-        String loggingPort = String(ESP_CONP_LOGGING_PORT);
-
-        int nameLen = name.length();
-        int infoSize = nameLen + WiFi.macAddress().length() + usedBytes.length() + totalBytes.length() +
-            freeHeap.length() + strlen(__DATE__) + strlen(__TIME__) + otaMaxLength.length() + otaPort.length() +
-            loggingPort.length() + 80;
-
-        char buf[infoSize];
-
-        strcpy(buf, name.c_str());
-        strcat(buf, "+");
-        strcat(buf, WiFi.macAddress().c_str());
-        strcat(buf, "+");
-        strcat(buf, usedBytes.c_str());
-        strcat(buf, "+");
-        strcat(buf, totalBytes.c_str());
-        strcat(buf, "+");
-        strcat(buf, freeHeap.c_str());
-        strcat(buf, "+");
-
-        strcat(buf, WiFi.status() == WL_DISCONNECTED || WiFi.getMode() == WIFI_AP_STA ? "0" : "1");
-        strcat(buf, "+");
-
-        strcat(buf, __DATE__);
-        strcat(buf, " ");
-        strcat(buf, __TIME__);
-        strcat(buf, "+");
+        size_t usedBytes = fsInfo.usedBytes;
+        size_t totalBytes = fsInfo.totalBytes;
+#endif
+
+        ESP_CONFIG_PAGE::server->sendHeader("Authorization", ESP_CONFIG_PAGE::server->header("Authorization"));
+        ResponseWriter writer;
+
+        writer.print(name);
+        writer.print('+');
+        writer.print(WiFi.macAddress());
+        writer.print('+');
+        writer.print((unsigned long) usedBytes);
+        writer.print('+');
+        writer.print((unsigned long) totalBytes);
+        writer.print('+');
+        writer.print((unsigned long) ESP.getFreeHeap());
+        writer.print('+');
+
+        writer.print(WiFi.status() == WL_DISCONNECTED || WiFi.getMode() == WIFI_AP_STA ? "0" : "1");
+        writer.print('+');
+
+        writer.print(__DATE__ " " __TIME__ "+");
 
 #ifdef ESP32_CONP_OTA_USE_WEBSOCKETS
-        strcat(buf, "1+");
+        writer.print("1+");
 #else
-        strcat(buf, "0+");
+        writer.print("0+");
+#endif
+
+        writer.print(ESP_CONP_WS_BUFFER_SIZE-32);
+        writer.print('+');
+        writer.print(ESP32_CONP_OTA_WS_PORT);
+        writer.print('+');
+        writer.print(ESP_CONP_LOGGING_PORT);
+        writer.print('+');
+    }
+
+#if ESP_CONP_METRICS
+    /**
+     * Latency histograms and heap usage, in the Prometheus text format.
+     */
+    inline void getMetrics()
+    {
+        ResponseWriter writer(200, "text/plain; version=0.0.4");
+
+        const uint32_t freeHeap = ESP.getFreeHeap();
+#ifdef ESP32
+        const uint32_t largestBlock = ESP.getMaxAllocHeap();
+        const uint32_t fragmentation = freeHeap == 0 ? 0 : 100 - (uint32_t) ((uint64_t) largestBlock * 100 / freeHeap);
+#elif ESP8266
+        const uint32_t largestBlock = ESP.getMaxFreeBlockSize();
+        const uint32_t fragmentation = ESP.getHeapFragmentation();
 #endif
 
-        strcat(buf, otaMaxLength.c_str());
-        strcat(buf, "+");
-        strcat(buf, otaPort.c_str());
-        strcat(buf, "+");
+        printMetricType(writer, "espconp_heap_free_bytes", "gauge");
+        writer.print("espconp_heap_free_bytes ");
+        writer.print(freeHeap);
+        writer.print('\n');
+        printMetricType(writer, "espconp_heap_largest_free_block_bytes", "gauge");
+        writer.print("espconp_heap_largest_free_block_bytes ");
+        writer.print(largestBlock);
+        writer.print('\n');
+        printMetricType(writer, "espconp_heap_fragmentation_percent", "gauge");
+        writer.print("espconp_heap_fragmentation_percent ");
+        writer.print(fragmentation);
+        writer.print('\n');
+
+        const StringPoolStats pool = stringPool.getStats();
+        printMetricType(writer, "espconp_string_pool_bytes", "gauge");
+        writer.print("espconp_string_pool_bytes{state=\"capacity\"} ");
+        writer.print(pool.capacity);
+        writer.print("\nespconp_string_pool_bytes{state=\"used\"} ");
+        writer.print(pool.used);
+        writer.print("\nespconp_string_pool_bytes{state=\"live\"} ");
+        writer.print(pool.live);
+        writer.print('\n');
+        printMetricType(writer, "espconp_string_pool_compactions_total", "counter");
+        writer.print("espconp_string_pool_compactions_total ");
+        writer.print(pool.compactions);
+        writer.print('\n');
+
+        char labels[96];
+        printMetricType(writer, "espconp_route_latency_seconds", "histogram");
+        for (size_t i = 0; i < routeCount && routeLatency != nullptr; i++)
+        {
+            Route route;
+            memcpy_P(&route, &routeTable[i], sizeof(Route));
+            if (!(enabledRouteModules & (1 << route.module)))
+            {
+                continue;
+            }
 
-        strcat(buf, loggingPort.c_str());
-        strcat(buf, "+");
+            char uri[64];
+            strncpy_P(uri, route.uri, sizeof(uri) - 1);
+            uri[sizeof(uri) - 1] = 0;
+            snprintf(labels, sizeof(labels), "route=\"%s\",method=\"%s\"", uri, methodName(route.method));
+            printHistogram(writer, "espconp_route_latency_seconds", labels, routeLatency[i]);
+        }
 
-        ESP_CONFIG_PAGE::server->sendHeader("Authorization", ESP_CONFIG_PAGE::server->header("Authorization"));
-        ESP_CONFIG_PAGE::server->send(200, "text/plain", buf);
+        for (uint8_t i = 0; i < extraRoutesCount; i++)
+        {
+            snprintf(labels, sizeof(labels), "route=\"%s\",method=\"%s\"", extraRoutes[i]->uri, methodName(extraRoutes[i]->method));
+            printHistogram(writer, "espconp_route_latency_seconds", labels, extraRoutes[i]->latency);
+        }
+
+        printMetricType(writer, "espconp_module_tick_seconds", "histogram");
+        for (uint8_t i = 0; i < registeredModulesCount; i++)
+        {
+            snprintf(labels, sizeof(labels), "module=\"%s\"", registeredModules[i]->name());
+            printHistogram(writer, "espconp_module_tick_seconds", labels, registeredModules[i]->latency);
+        }
+        printHistogram(writer, "espconp_module_tick_seconds", "module=\"logging\"", loggingLoopLatency);
+
+        printMetricType(writer, "espconp_flash_write_seconds", "histogram");
+        printHistogram(writer, "espconp_flash_write_seconds", "source=\"storage\"", flashWriteLatency);
+        printHistogram(writer, "espconp_flash_write_seconds", "source=\"ota\"", otaWriteLatency);
+
+        printMetricType(writer, "espconp_storage_restore_seconds", "histogram");
+        printHistogram(writer, "espconp_storage_restore_seconds", "source=\"env\"", envRestoreLatency);
+        printHistogram(writer, "espconp_storage_restore_seconds", "source=\"attributes\"", attributeRestoreLatency);
+
+        printMetricType(writer, "espconp_websocket_send_seconds", "histogram");
+        printHistogram(writer, "espconp_websocket_send_seconds", "", wsSendLatency);
+
+#if ESP_CONP_HAS_MODULE(LOGGING)
+        const ESP_CONFIG_PAGE_LOGGING::LogStats &logStats = ESP_CONFIG_PAGE_LOGGING::getLogStats();
+        printMetricType(writer, "espconp_log_lines_total", "counter");
+        writer.print("espconp_log_lines_total{result=\"written\"} ");
+        writer.print(logStats.lines);
+        writer.print("\nespconp_log_lines_total{result=\"dropped\"} ");
+        writer.print(logStats.dropped);
+        writer.print("\nespconp_log_lines_total{result=\"truncated\"} ");
+        writer.print(logStats.truncated);
+        writer.print('\n');
+        printMetricType(writer, "espconp_log_frames_total", "counter");
+        writer.print("espconp_log_frames_total ");
+        writer.print(logStats.frames);
+        writer.print('\n');
+        printMetricType(writer, "espconp_log_file_operations_total", "counter");
+        writer.print("espconp_log_file_operations_total{operation=\"write\"} ");
+        writer.print(logStats.fileWrites);
+        writer.print("\nespconp_log_file_operations_total{operation=\"flush\"} ");
+        writer.print(logStats.fileFlushes);
+        writer.print('\n');
+        printMetricType(writer, "espconp_log_client_dropped_total", "counter");
+        writer.print("espconp_log_client_dropped_total{unit=\"lines\"} ");
+        writer.print(logStats.clientDroppedLines);
+        writer.print("\nespconp_log_client_dropped_total{unit=\"frames\"} ");
+        writer.print(logStats.clientDroppedFrames);
+        writer.print('\n');
+        printMetricType(writer, "espconp_log_client_disconnects_total", "counter");
+        writer.print("espconp_log_client_disconnects_total ");
+        writer.print(logStats.clientDisconnects);
+        writer.print('\n');
+#endif
     }
+#endif
 
     void getConfigPage()
     {
+        ESP_CONFIG_PAGE::server->sendHeader("Cache-Control", ESP_CONP_PAGE_CACHE_CONTROL);
+
+#if defined(ESP_CONP_PAGE_BROTLI) && defined(ESP_CONP_PAGE_GZIP)
+        ESP_CONFIG_PAGE::server->sendHeader("Vary", "Accept-Encoding");
+        const bool brotli = acceptsEncoding(ESP_CONFIG_PAGE::server->header("Accept-Encoding"), "br");
+#elif defined(ESP_CONP_PAGE_BROTLI)
+        const bool brotli = true;
+#else
+        const bool brotli = false;
+#endif
+
+#ifdef ESP_CONFIG_HTML_HASH
+        const char *etag = brotli ? "\"" ESP_CONFIG_HTML_HASH "-br\"" : "\"" ESP_CONFIG_HTML_HASH "\"";
+        ESP_CONFIG_PAGE::server->sendHeader("ETag", etag);
+        if (ESP_CONFIG_PAGE::server->header("If-None-Match").indexOf(etag) >= 0)
+        {
+            ESP_CONFIG_PAGE::server->send(304);
+            return;
+        }
+#endif
+
+#ifdef ESP_CONP_PAGE_BROTLI
+        if (brotli)
+        {
+            ESP_CONFIG_PAGE::server->sendHeader("Content-Encoding", "br");
+            ESP_CONFIG_PAGE::server->send_P(200, "text/html", (const char*) ESP_CONFIG_HTML_BR, ESP_CONFIG_HTML_BR_LEN);
+            return;
+        }
+#endif
+
+#ifdef ESP_CONP_PAGE_GZIP
         ESP_CONFIG_PAGE::server->sendHeader("Content-Encoding", "gzip");
         ESP_CONFIG_PAGE::server->send_P(200, "text/html", (const char*) ESP_CONFIG_HTML, ESP_CONFIG_HTML_LEN);
+#endif
     }
 
+    constexpr char routeConfig[] PROGMEM = "/config";
+    constexpr char routeAttributes[] PROGMEM = "/config/attributes";
+    constexpr char routeCustomActions[] PROGMEM = "/config/customa";
+    constexpr char routeEnv[] PROGMEM = "/config/env";
+    constexpr char routeFiles[] PROGMEM = "/config/files";
+    constexpr char routeFilesDelete[] PROGMEM = "/config/files/delete";
+    constexpr char routeFilesDownload[] PROGMEM = "/config/files/download";
+    constexpr char routeInfo[] PROGMEM = "/config/info";
+    constexpr char routeMetrics[] PROGMEM = "/config/metrics";
+    constexpr char routeSave[] PROGMEM = "/config/save";
+    constexpr char routeSchedule[] PROGMEM = "/config/schedule";
+    constexpr char routeScheduleDelete[] PROGMEM = "/config/schedule/delete";
+    constexpr char routeUpdateFilesystem[] PROGMEM = "/config/update/filesystem";
+    constexpr char routeUpdateFirmware[] PROGMEM = "/config/update/firmware";
+    constexpr char routeWifi[] PROGMEM = "/config/wifi";
+
+    /**
+     * Every route served by the library, sorted by uri and method. Routes of modules that were not enabled are skipped.
+     */
+    constexpr Route routes[] PROGMEM = {
+        {routeConfig, HTTP_GET, ROUTE_MODULE_CORE, getConfigPage, nullptr, nullptr, nullptr, false},
+#if ESP_CONP_HAS_MODULE(ATTRIBUTES)
+        {routeAttributes, HTTP_GET, ATTRIBUTES, getAttributes, nullptr, nullptr, nullptr, false},
+        {routeAttributes, HTTP_POST, ATTRIBUTES, setAttribute, nullptr, setAttributePair, abortAttributeBatch, false},
+#endif
+#if ESP_CONP_HAS_MODULE(ACTIONS)
+        {routeCustomActions, HTTP_GET, ACTIONS, getCa, nullptr, nullptr, nullptr, false},
+        {routeCustomActions, HTTP_POST, ACTIONS, tiggerCustomAction, nullptr, nullptr, nullptr, false},
+#endif
+#if ESP_CONP_HAS_MODULE(ENVIRONMENT)
+        {routeEnv, HTTP_GET, ENVIRONMENT, getEnv, nullptr, nullptr, nullptr, false},
+#endif
+#if ESP_CONP_HAS_MODULE(FILES)
+        {routeFiles, HTTP_POST, FILES, getFiles, nullptr, nullptr, nullptr, false},
+        {routeFilesDelete, HTTP_POST, FILES, deleteFile, nullptr, nullptr, nullptr, false},
+        {routeFilesDownload, HTTP_POST, FILES, downloadFile, nullptr, nullptr, nullptr, false},
+#endif
+        {routeInfo, HTTP_GET, ROUTE_MODULE_CORE, getInfo, nullptr, nullptr, nullptr, false},
+#if ESP_CONP_METRICS
+        {routeMetrics, HTTP_GET, ROUTE_MODULE_CORE, getMetrics, nullptr, nullptr, nullptr, false},
+#endif
+#if ESP_CONP_HAS_MODULE(ENVIRONMENT)
+        {routeSave, HTTP_POST, ENVIRONMENT, saveEnv, nullptr, saveEnvPair, abortEnvBatch, false},
+#endif
+#if ESP_CONP_HAS_MODULE(SCHEDULING)
+        {routeSchedule, HTTP_GET, SCHEDULING, getSchedule, nullptr, nullptr, nullptr, false},
+        {routeSchedule, HTTP_POST, SCHEDULING, addScheduleRoute, nullptr, nullptr, nullptr, false},
+        {routeScheduleDelete, HTTP_POST, SCHEDULING, deleteScheduleRoute, nullptr, nullptr, nullptr, false},
+#endif
+#if ESP_CONP_HAS_MODULE(OTA) && !defined(ESP32_CONP_OTA_USE_WEBSOCKETS)
+        {routeUpdateFilesystem, HTTP_POST, OTA, handleUpdateFinished, handleFilesystemUpload, nullptr, nullptr, false},
+        {routeUpdateFirmware, HTTP_POST, OTA, handleUpdateFinished, handleFirmwareUpload, nullptr, nullptr, false},
+#endif
+#if ESP_CONP_HAS_MODULE(WIRELESS)
+        {routeWifi, HTTP_GET, WIRELESS, wifiGet, nullptr, nullptr, nullptr, false},
+        {routeWifi, HTTP_POST, WIRELESS, wifiSet, nullptr, wifiSetPair, abortWifiBatch, true},
+#endif
+    };
+
+    static_assert(routesSorted(routes, sizeof(routes) / sizeof(routes[0])), "Config page routes must be sorted by uri and method.");
+
     /**
      * Init chosen modules for the config page module.
      *
@@ -150,8 +384,9 @@ namespace ESP_CONFIG_PAGE
 
         name = nodeName;
 
-        addServerHandler((char*) F("/config"), HTTP_GET, getConfigPage);
-        addServerHandler((char*) F("/config/info"), HTTP_GET, getInfo);
+        setRouteTable(routes, sizeof(routes) / sizeof(routes[0]));
+        collectRequestHeaders();
+        server->addHandler(new RouteDispatcher());
         server->onNotFound([]()
         {
             ESP_CONFIG_PAGE::server->send(404, "text/html", F("<html><head><title>Page not found</title></head><body><p>Page not found.</p> <a href=\"/config\">Go to root.</a></body></html>"));
@@ -160,39 +395,68 @@ namespace ESP_CONFIG_PAGE
         for (uint8_t i = 0; i < moduleCount; i++)
         {
             const Modules m = modules[i];
+            if (!isModuleCompiled(m))
+            {
+                LOGF("Module %d was left out by ESP_CONP_MODULES, not enabling it.\n", m);
+                continue;
+            }
 
             switch (m)
             {
+#if ESP_CONP_HAS_MODULE(OTA)
             case OTA:
                 {
                     enableOtaModule();
+#ifdef ESP32_CONP_OTA_USE_WEBSOCKETS
+                    registerModule(&otaModule);
+#endif
                     break;
                 }
+#endif
+#if ESP_CONP_HAS_MODULE(WIRELESS)
             case WIRELESS:
                 {
                     enableWirelessModule();
+                    registerModule(&wirelessModule);
                     break;
                 }
+#endif
+#if ESP_CONP_HAS_MODULE(FILES)
             case FILES:
                 {
                     enableFilesModule();
                     break;
                 }
+#endif
+#if ESP_CONP_HAS_MODULE(ACTIONS)
             case ACTIONS:
                 {
                     enableCustomActionsModule();
                     break;
                 }
+#endif
+#if ESP_CONP_HAS_MODULE(ENVIRONMENT)
             case ENVIRONMENT:
                 {
                     enableEnvModule();
                     break;
                 }
+#endif
+#if ESP_CONP_HAS_MODULE(ATTRIBUTES)
             case ATTRIBUTES:
                 {
                     enableAttributesModule();
                     break;
                 }
+#endif
+#if ESP_CONP_HAS_MODULE(SCHEDULING)
+            case SCHEDULING:
+                {
+                    enableSchedulingModule();
+                    registerModule(&schedulingModule);
+                    break;
+                }
+#endif
             default: break;
             }
         }
@@ -202,7 +466,8 @@ namespace ESP_CONFIG_PAGE
 
 
     /**
-     * Initialized all modules in the config page.
+     * Initializes the OTA, wireless, files, custom actions and environment modules, the ones of them compiled in with
+     * ESP_CONP_MODULES. Attributes and scheduling are only enabled when passed in a module list.
      *
      * @param server - Webserver instance to use.
      * @param username - Page authentication username
@@ -211,35 +476,25 @@ namespace ESP_CONFIG_PAGE
      */
     inline void initModules(WEBSERVER_T *server, const String username, const String password, const String nodeName)
     {
-        Modules m[] = {OTA, WIRELESS, FILES, ENVIRONMENT, ACTIONS};
-        initModules(m, 5, server, username, password, nodeName);
-    }
-
-    inline void loop()
-    {
-        if (enabledModules == nullptr)
+        const Modules defaults[] = {OTA, WIRELESS, FILES, ENVIRONMENT, ACTIONS};
+        Modules m[sizeof(defaults) / sizeof(defaults[0])];
+        uint8_t count = 0;
+        for (const Modules module : defaults)
         {
-            return;
-        }
-
-        for (uint8_t i = 0; i < enabledModulesCount; i++)
-        {
-            const Modules m = enabledModules[i];
-            switch (m)
+            if (isModuleCompiled(module))
             {
-            case OTA:
-                {
-                    otaLoop();
-                    break;
-                }
-            case WIRELESS:
-                {
-                    wirelessLoop();
-                    break;
-                }
-            default: break;
+                m[count++] = module;
             }
         }
+        initModules(m, count, server, username, password, nodeName);
+    }
+
+    /**
+     * Ticks the modules that are due, see ConfigPageModule.
+     */
+    inline void loop()
+    {
+        tickModules();
     }
 }
 